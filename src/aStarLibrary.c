@@ -1,4 +1,5 @@
 #include "global_defs.h"
+#include "cellArraySlabs.h"
 
 
 //-----------------------------------------------------------------------------
@@ -12,6 +13,10 @@ void createNoRoutingRestrictions(RoutingRestriction_t * routingRestrictions)  {
   routingRestrictions->restrictionFlag = FALSE;  // FALSE means no routing restriction
   routingRestrictions->centerX = 0;
   routingRestrictions->centerY = 0;
+  routingRestrictions->corridorMap      = NULL;
+  routingRestrictions->corridorMapWidth = 0;
+  routingRestrictions->corridorFlag     = FALSE;
+  routingRestrictions->corridorBox      = (CellBox_t){0, 0, 0, 0};
 
   // Iterate over each routing layer:
   for (int layer = 0; layer < maxRoutingLayers; layer++)  {
@@ -23,6 +28,153 @@ void createNoRoutingRestrictions(RoutingRestriction_t * routingRestrictions)  {
 }  // End of function 'void initializeAllowedRoutingRadii'
 
 
+//-----------------------------------------------------------------------------
+// Name: allocateCorridorRestrictions
+// Desc: Initialize variable 'corridorRestrictions' with no routing restrictions,
+//       and allocate its 'corridorMap' bitmap with one bit for each (x,y)
+//       location in the map. The bitmap is populated for each net by function
+//       createCorridorRestrictions().
+//-----------------------------------------------------------------------------
+void allocateCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const MapInfo_t *mapInfo)  {
+
+  createNoRoutingRestrictions(corridorRestrictions);
+
+  size_t numBytes = ((size_t)mapInfo->mapWidth * mapInfo->mapHeight + 7) / 8;
+  corridorRestrictions->corridorMap = malloc(numBytes * sizeof(unsigned char));
+  if (corridorRestrictions->corridorMap == NULL)  {
+    printf("\n\nERROR: Failed to allocate memory for 'corridorMap' array in function 'allocateCorridorRestrictions'.\n\n");
+    exit(1);
+  }
+  corridorRestrictions->corridorMapWidth = mapInfo->mapWidth;
+
+}  // End of function 'allocateCorridorRestrictions'
+
+
+//-----------------------------------------------------------------------------
+// Name: setCorridorBits
+// Desc: Set bits 'firstBit' through 'lastBit' (inclusive) in bitmap 'corridorMap'.
+//       Whole bytes are set with memset().
+//-----------------------------------------------------------------------------
+void setCorridorBits(unsigned char corridorMap[], size_t firstBit, size_t lastBit)  {
+
+  // Set individual bits until 'firstBit' is at the start of a byte:
+  while ((firstBit <= lastBit) && (firstBit & 7))  {
+    corridorMap[firstBit >> 3] |= (unsigned char)(1 << (firstBit & 7));
+    firstBit++;
+  }
+
+  // Set whole bytes:
+  if (lastBit + 1 >= firstBit + 8)  {
+    size_t numBytes = (lastBit + 1 - firstBit) >> 3;
+    memset(&(corridorMap[firstBit >> 3]), 0xFF, numBytes);
+    firstBit += numBytes << 3;
+  }
+
+  // Set the remaining bits:
+  while (firstBit <= lastBit)  {
+    corridorMap[firstBit >> 3] |= (unsigned char)(1 << (firstBit & 7));
+    firstBit++;
+  }
+
+}  // End of function 'setCorridorBits'
+
+
+//-----------------------------------------------------------------------------
+// Name: expandCorridorBox
+// Desc: Expand 'corridorBox' so that it contains the rectangle of (x,y) locations
+//       from (xMin, yMin) to (xMax, yMax).
+//-----------------------------------------------------------------------------
+void expandCorridorBox(CellBox_t *corridorBox, int xMin, int xMax, int yMin, int yMax)  {
+
+  corridorBox->minX = min(corridorBox->minX, xMin);
+  corridorBox->maxX = max(corridorBox->maxX, xMax);
+  corridorBox->minY = min(corridorBox->minY, yMin);
+  corridorBox->maxY = max(corridorBox->maxY, yMax);
+
+}  // End of function 'expandCorridorBox'
+
+
+//-----------------------------------------------------------------------------
+// Name: createCorridorRestrictions
+// Desc: Populate 'corridorRestrictions', which must have been allocated with
+//       function allocateCorridorRestrictions(), so that findPath() can route
+//       only within 'radiusCells' cells of a net's previous (contiguous) path,
+//       'contigPathCoords', whose length is 'contigPathLength'. The corridor is
+//       a square band around each cell of the path, plus the start- and end-
+//       terminals. Routing is allowed on each layer that the previous path
+//       used, and on the layers immediately above and below these layers.
+//-----------------------------------------------------------------------------
+void createCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const Coordinate_t contigPathCoords[],
+                                int contigPathLength, Coordinate_t startCoord, Coordinate_t endCoord,
+                                int radiusCells, const MapInfo_t *mapInfo)  {
+
+  const int width  = mapInfo->mapWidth;
+  const int height = mapInfo->mapHeight;
+
+  // Start with an empty corridor on every layer:
+  memset(corridorRestrictions->corridorMap, 0, ((size_t)width * height + 7) / 8);
+  for (int layer = 0; layer < maxRoutingLayers; layer++)  {
+    corridorRestrictions->allowedLayers[layer]       = FALSE;
+    corridorRestrictions->allowedRadiiMicrons[layer] = 0.0;  // Corridor replaces the radius-based restriction
+    corridorRestrictions->allowedRadiiCells[layer]   = 0.0;
+  }  // End of for-loop for index 'layer'
+  corridorRestrictions->corridorBox = (CellBox_t){width - 1, 0, height - 1, 0};
+
+  //
+  // Iterate over the start-terminal (index -1), each cell in the previous path, and the
+  // end-terminal (index contigPathLength):
+  //
+  int prevX = -1, prevY = -1;
+  for (int pathIndex = -1; pathIndex <= contigPathLength; pathIndex++)  {
+    Coordinate_t coord;
+    if (pathIndex == -1)
+      coord = startCoord;
+    else if (pathIndex == contigPathLength)
+      coord = endCoord;
+    else
+      coord = contigPathCoords[pathIndex];
+
+    // Allow routing on this cell's layer and its adjacent layers:
+    for (int z = max(0, coord.Z - 1); z <= min(mapInfo->numLayers - 1, coord.Z + 1); z++)  {
+      corridorRestrictions->allowedLayers[z] = TRUE;
+    }
+
+    // Vias don't change the (x,y) location, so the band has already been marked:
+    if ((coord.X == prevX) && (coord.Y == prevY))  {
+      continue;
+    }
+    prevX = coord.X;
+    prevY = coord.Y;
+
+    // Mark the square band of cells around this (x,y) location:
+    const int xMin = max(0, coord.X - radiusCells);
+    const int xMax = min(width - 1, coord.X + radiusCells);
+    const int yMin = max(0, coord.Y - radiusCells);
+    const int yMax = min(height - 1, coord.Y + radiusCells);
+    for (int y = yMin; y <= yMax; y++)  {
+      setCorridorBits(corridorRestrictions->corridorMap, (size_t)y * width + xMin, (size_t)y * width + xMax);
+    }  // End of for-loop for index 'y'
+    expandCorridorBox(&(corridorRestrictions->corridorBox), xMin, xMax, yMin, yMax);
+  }  // End of for-loop for index 'pathIndex'
+
+  corridorRestrictions->restrictionFlag = TRUE;
+  corridorRestrictions->corridorFlag    = TRUE;
+
+}  // End of function 'createCorridorRestrictions'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCorridorRestrictions
+// Desc: Free the memory allocated by function allocateCorridorRestrictions().
+//-----------------------------------------------------------------------------
+void freeCorridorRestrictions(RoutingRestriction_t *corridorRestrictions)  {
+
+  free(corridorRestrictions->corridorMap);  corridorRestrictions->corridorMap = NULL;
+  corridorRestrictions->corridorFlag = FALSE;
+
+}  // End of function 'freeCorridorRestrictions'
+
+
 //-----------------------------------------------------------------------------
 // Name: evaporateCongestion
 // Desc: At each cell in the cellInfo matrix, reduce the congestion value by
@@ -30,7 +182,7 @@ void createNoRoutingRestrictions(RoutingRestriction_t * routingRestrictions)  {
 //       of 'evaporationRate' could range from 0 to 100. The resulting 
 //       congestion is always rounded down, so it could reach zero. If the
 //       result is indeed zero congestion, then eliminate the traversing path
-//       from the cell.
+//       from the cell in the same pass. Cells without congestion are skipped.
 //
 //       Congestion from path-number N is not evaporated, where N is the
 //       path-number of the universal repellent. The value of N given by:
@@ -46,94 +198,59 @@ void evaporateCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
   // Define the path number of the universal repellent net:
   const int universal_repellent_pathNum = mapInfo->numPaths + mapInfo->numPseudoPaths;
 
-  // printf("DEBUG: In function 'evaporateCongestion', retainFactor = %5.3f\n", retainFactor);
-
-  // Define an array that will hold the number of cells whose congestion memory will
-  // later need to be re-allocated because they contain zero-congestion values:
-  int numZeroCongestionCells[num_threads];
-
-  // Define an array that holds Boolean flags indicating whether a warning message has
-  // been printed that tells user that there are more zero-congestion elements than this
-  // function could delete due to memory constraints.
-  char warningMessagePrinted[num_threads];
-
-  // Define a 2-dimensional array that holds the locations of congestion values
-  // that evaporate to zero. The first dimension is necessary because each
-  // thread needs its own array to avoid memory conflicts:
-  Coordinate_t * zeroCongestionCells[num_threads];
-
-  // Allocate memory for the 2nd dimension of each of the arrays defined above. The number
-  // of array elements is 20% of the number of cells in the map, divided by the number of
-  // threads. If this number is not sufficient to flag each zero-congestion position,
-  // then such elements will not be eliminated from element in this call to
-  // evaporateCongestion. But they're likely to be eliminated in subsequent calls after
-  // future Acorn iterations.
-  int maxDeletionsPerThread = (int)(0.20 * mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers / num_threads);
-  for (int i = 0; i < num_threads; i++)  {
-    zeroCongestionCells[i] = malloc(maxDeletionsPerThread * sizeof(Coordinate_t));
-    numZeroCongestionCells[i] = 0;     // Initialize array elements to zero
-    warningMessagePrinted[i]  = FALSE; // Initialize array elements to FALSE
-  }  // End of for-loop for index 'i'
-
-
   // printf("DEBUG: In function 'evaporateCongestion', retainFactor = %5.3f\n", retainFactor);
 
   // Iterate over all X/Y/Z locations and reduce the congestion values at each
-  // cell. For congestion values that become zero, store their X/Y/Z coordinates
-  // so that we can later eliminate these values and re-allocate (reduce)
-  // the memory for such arrays. (Note that we cannot re-allocate memory in
-  // the multi-threaded for-loops below because it would corrupt the memory.)
-  #pragma omp parallel for collapse(3) schedule(dynamic, 1) if (num_threads > 1)
-  for (int z = 0; z < mapInfo->numLayers; z++)  {
+  // cell. Congestion values that become zero are eliminated from the cell in the
+  // same pass, and the cell's 'congestion' array is compacted into a smaller slab
+  // block, if possible. This is safe in the multi-threaded for-loops below because
+  // each thread modifies only its own cells, and because the slab allocator keeps
+  // separate free-lists for each thread. Each thread processes a complete column
+  // of cells at a time, because the work for most cells is trivial. The loops
+  // follow the order of the cells in memory.
+  #pragma omp parallel for schedule(dynamic, 1) if (num_threads > 1)
+  for (int x = 0; x < mapInfo->mapWidth; x++ )  {
     for (int y = 0; y < mapInfo->mapHeight; y++)  {
-      for (int x = 0; x < mapInfo->mapWidth; x++ )  {
-        int thread_num = omp_get_thread_num();
+      for (int z = 0; z < mapInfo->numLayers; z++)  {
 
-        // If cell is not walkable, then skip it:
-        if (cellInfo[x][y][z].forbiddenTraceBarrier)  {
+        // If cell is not walkable or has no congestion, then skip it:
+        if (cellInfo[x][y][z].forbiddenTraceBarrier || (cellInfo[x][y][z].numTraversingPaths == 0))  {
           continue;
         }
 
         // At cell (x, y, z), determine how many paths have congestion at this cell:
-        unsigned int num_traversing_paths;
-        num_traversing_paths = cellInfo[x][y][z].numTraversingPaths;
-
-        // printf("DEBUG: (thread %2d) Cell (%d,%d,%d) has %d congestion elements.\n", thread_num, x, y, z, num_traversing_paths);
+        const int old_num_indices = cellInfo[x][y][z].numTraversingPaths;
 
-        unsigned int original_congestion, new_congestion;
+        // printf("DEBUG: (thread %2d) Cell (%d,%d,%d) has %d congestion elements.\n", omp_get_thread_num(), x, y, z, old_num_indices);
 
         // Define a Boolean flag that, if TRUE, flags the current (x,y,z) cell as having at
         // least one congestion index that has evaporated to zero.
         char cell_contains_zeroCongestion_element = FALSE;
 
         // For each traversing path, get the associated congestion and reduce it by 'retainFactor':
-        for (int pathIndex = 0; pathIndex < num_traversing_paths; pathIndex++)  {
-
+        for (int pathIndex = 0; pathIndex < old_num_indices; pathIndex++)  {
 
           // Check that the path-number of the congestion is *not* that of
           // the the universal repellent, which we don't want to evaporate:
-          if (cellInfo[x][y][z].congestion[pathIndex].pathNum != universal_repellent_pathNum)  {
+          if (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum != universal_repellent_pathNum)  {
 
             // Get current congestion, i.e., number path-traversals multiplied by 100:
-            original_congestion = cellInfo[x][y][z].congestion[pathIndex].pathTraversalsTimes100;
-  
+            const unsigned int original_congestion = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathTraversalsTimes100;
+
             // Calculate new congestion for this cell by multiplying the current
             // congestion by 'retainFactor', and truncating to the next lowest integer:
-            new_congestion = (unsigned) (original_congestion * retainFactor);
+            const unsigned int new_congestion = (unsigned) (original_congestion * retainFactor);
 
             // printf("DEBUG:    (thread %2d) Index %d: Congestion reduced from %d to %d at (%d,%d,%d)\n",
-            //        thread_num, pathIndex, original_congestion, new_congestion, x, y, z);
+            //        omp_get_thread_num(), pathIndex, original_congestion, new_congestion, x, y, z);
 
             // Assign the new congestion to the appropriate location in the cellInfo matrix:
             assignCongestionByPathIndex(&(cellInfo[x][y][z]), pathIndex, new_congestion);
 
-
             // If the congestion has evaporated to zero, then flag this cell
-            // so we can later eliminate it from memory:
+            // so we can eliminate it from memory:
             if (new_congestion == 0)  {
               cell_contains_zeroCongestion_element = TRUE;
-              // printf("DEBUG:       (thread %2d) For index %d at (%d,%d,%d), original_congestion = %d, new_congestion = %d\n",
-              //         thread_num, pathIndex, x, y, z, original_congestion, new_congestion);
             }  // End of if-block for new_congestion == 0
 
           }  // End of if-block for pathNum != universal repellent
@@ -141,148 +258,274 @@ void evaporateCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
         }  // End of for-block for index 'pathIndex'
 
         //
-        // If the cell at (x,y,z) was found to contain at least one element with
-        // zero congestion, then record the x/y/z values:
+        // If the cell at (x,y,z) contains at least one element with zero congestion,
+        // then move the non-zero elements 'down' over the zero-elements, preserving
+        // their order, and shrink the array:
         //
         if (cell_contains_zeroCongestion_element)  {
-          // printf("DEBUG: (thread %2d) Cell at (%d,%d,%d) has at least one zero-congestion element.\n", thread_num, x, y, z);
-
-          // Confirm that we haven't flagged more cells than we've allocated memory for:
-          if (numZeroCongestionCells[thread_num] < maxDeletionsPerThread)  {
-
-            // Store the x/y/z/index parameters that have zero congestion so we can later
-            // eliminate them from memory:
-            zeroCongestionCells[thread_num][numZeroCongestionCells[thread_num]].X = x;
-            zeroCongestionCells[thread_num][numZeroCongestionCells[thread_num]].Y = y;
-            zeroCongestionCells[thread_num][numZeroCongestionCells[thread_num]].Z = z;
-
-            // Increment the number of cells detected by this thread that contain
-            // zero-congestion elements (and which we'll later eliminate):
-            numZeroCongestionCells[thread_num]++;
-
-            // printf("DEBUG:   (thread %2d) Cell at (%d,%d,%d) was flagged for deletion (#%d in this thread).\n",
-            //         thread_num, x, y, z, numZeroCongestionCells[thread_num]);
-          }  // End of if-block for numZeroCongestionCells < maxDeletionsPerThread
-
-          else if (! warningMessagePrinted[thread_num])  {
-            printf("\nWARNING: (thread %2d) The number of cells with congestion that evaporated to zero reached %'d in thread %d\n",
-                     thread_num, maxDeletionsPerThread, thread_num);
-            printf(  "WARNING: (thread %2d) which is the maximum number that can be deleted in a single iteration. More\n", thread_num);
-            printf(  "WARNING: (thread %2d) zero-congestion values will naturally be deleted in subsequent iterations\n", thread_num);
-            printf(  "WARNING: (thread %2d) to save memory/RAM.\n\n", thread_num);
-
-            // Set the Boolean flag to TRUE to avoid printing out more of the above warnings.
-            warningMessagePrinted[thread_num] = TRUE;
-          }  // End of else/if block to print warning message
+
+          int new_num_indices = 0;
+          for (int pathIndex = 0; pathIndex < old_num_indices; pathIndex++)  {
+            if (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathTraversalsTimes100 != 0)  {
+              if (new_num_indices != pathIndex)  {
+                cellCongestion(&(cellInfo[x][y][z]))[new_num_indices] = cellCongestion(&(cellInfo[x][y][z]))[pathIndex];
+              }
+              new_num_indices++;
+            }
+          }  // End of for-loop for index 'pathIndex'
+
+          // printf("DEBUG: (thread %2d) Cell at (%d,%d,%d) reduced from %d to %d congestion elements.\n",
+          //        omp_get_thread_num(), x, y, z, old_num_indices, new_num_indices);
+
+          // Update the 'cellInfo' matrix with the new (reduced) number of congestion
+          // indices for this cell, and compact the 'congestion' array into a smaller
+          // slab block if the new number of indices fits in one. The array's handle is
+          // set to zero if there is no longer any congestion at (x,y,z):
+          cellInfo[x][y][z].congestionHandle = resizeCongestion(cellInfo[x][y][z].congestionHandle, old_num_indices, new_num_indices);
+          cellInfo[x][y][z].numTraversingPaths = new_num_indices;
+
         }  // End of if-block for (cell_contains_zeroCongestion_element == TRUE)
 
-      }  // End of loop for index 'x'
+      }  // End of loop for index 'z'
     }  // End of loop for index 'y'
-  }  // End of loop for index 'z'
-  //
-  // The above line represents the end of parallel processing
-  //
+  }  // End of loop for index 'x'
 
-  //
-  // In single-threaded mode, iterate over the two-dimensional
-  // zeroCongestionCells[][] array and re-allocate memory for
-  // cells and indices that are zero.
-  //
-  int x, y, z;  // Coordinates of cells that contain zero-congestion values
-  for (int thread = 0; thread < num_threads; thread++)  {
-    // printf("DEBUG: Processing the %d cells from thread %d that contain zero-congestion elements...\n",
-    //         numZeroCongestionCells[thread], thread);
+}  // End of function 'evaporateCongestion'
 
-    for (int i = 0; i < numZeroCongestionCells[thread]; i++)  {
 
-      // Get the x/y/z/index values corresponding to zero congestion:
-      x = zeroCongestionCells[thread][i].X;
-      y = zeroCongestionCells[thread][i].Y;
-      z = zeroCongestionCells[thread][i].Z;
+//-----------------------------------------------------------------------------
+// Name: updateCongestionSummaries
+// Desc: For each cell in the map, summarize the TRACE congestion of non-pseudo
+//       nets in the flat array 'congestionSummary', which must contain
+//       (mapWidth x mapHeight x numLayers) elements. Each summary holds the
+//       penalties that calc_congestion_penalty() and calc_corner_congestion()
+//       would calculate for this congestion using the current values of
+//       'mapInfo->traceCongestionMultiplier' and the trace cost-multipliers,
+//       so the summaries must be rebuilt whenever these values or the
+//       congestion in the map change.
+//-----------------------------------------------------------------------------
+void updateCongestionSummaries(CongestionSummary_t *congestionSummary, const MapInfo_t *mapInfo,
+                               CellInfo_t ***cellInfo, const InputValues_t *user_inputs, int num_threads)  {
 
-      // At cell (x,y,z), determine how many congestion indices exist at this cell:
-      int old_num_indices = cellInfo[x][y][z].numTraversingPaths;
+  #pragma omp parallel for collapse(2) schedule(dynamic, 1) if (num_threads > 1)
+  for (int x = 0; x < mapInfo->mapWidth; x++)  {
+    for (int y = 0; y < mapInfo->mapHeight; y++)  {
+      for (int z = 0; z < mapInfo->numLayers; z++)  {
 
-      // printf("DEBUG: Processing cell #%d from thread %d at (%d,%d,%d). old_num_indices = %d.\n",
-      //         i, thread, x, y, z, old_num_indices);
+        CongestionSummary_t *summary = &(congestionSummary[(x * mapInfo->mapHeight + y) * mapInfo->numLayers + z]);
+        summary->pathBloomFilter  = 0;
+        summary->traceCongestion  = 0;
+        summary->cornerCongestion = 0;
+        summary->DR_subset        = 0;
+        summary->isValid          = TRUE;
 
-      // Define variable that will contain the new (but reduced) number of congestion
-      // indices for this (x,y,z) cell. Initially, this value is set to the old value
-      // (but it will later be decremented when we find congestion values of zero).
-      int new_num_indices = old_num_indices;
+        const int DR_num = cellInfo[x][y][z].designRuleSet;
+        const int cost_zone_multiplier = user_inputs->traceCostMultiplier[cellInfo[x][y][z].traceCostMultiplierIndex];
+        int foundTraceCongestion = FALSE; // Flag that is set when the first non-pseudo TRACE congestion is found
 
-      // Iterate over the congestion indices to find zero-values:
-      int pathIndex = 0;
-      while (pathIndex < new_num_indices)  {
+        for (int path_index = 0; path_index < cellInfo[x][y][z].numTraversingPaths; path_index++)  {
 
-        // Get the new (post-evaporation) congestion value:
-        int new_congestion = cellInfo[x][y][z].congestion[pathIndex].pathTraversalsTimes100;
+          const Congestion_t *congestion = &(cellCongestion(&(cellInfo[x][y][z]))[path_index]);
 
-        // Check whether the new congestion is zero or non-zero:
-        if (new_congestion != 0)  {
-          // Congestion is not zero, so increment pathIndex so we can move on to
-          // the next traversing path:
-          pathIndex++;
-        }
-        else  {
-          // New congestion is zero, so eliminate this traversing path from this cell:
+          // Skip congestion from pseudo-nets, and congestion from vias:
+          if (user_inputs->isPseudoNet[congestion->pathNum] || (congestion->shapeType != TRACE))  {
+            continue;
+          }
+
+          // The summary is not usable if the cell contains TRACE congestion from more than
+          // one design-rule subset:
+          if (foundTraceCongestion && (congestion->DR_subset != summary->DR_subset))  {
+            summary->isValid = FALSE;
+          }
+          summary->DR_subset = congestion->DR_subset;
+          foundTraceCongestion = TRUE;
+
+          summary->pathBloomFilter |= 1U << (congestion->pathNum % 32);
+
+          // Calculate the penalties with the same expressions as in functions calc_congestion_penalty()
+          // and calc_corner_congestion() so that the sums are identical to the results of scanning:
+          const int subset_shapeType = congestion->DR_subset * NUM_SHAPE_TYPES   +   TRACE;
+          summary->traceCongestion  += (int)(congestion->pathTraversalsTimes100
+                                             * mapInfo->traceCongestionMultiplier
+                                             * user_inputs->detour_distance[DR_num][subset_shapeType][DR_num][subset_shapeType]
+                                             * cost_zone_multiplier);
+          summary->cornerCongestion += (int)(congestion->pathTraversalsTimes100
+                                             * mapInfo->traceCongestionMultiplier
+                                             * cost_zone_multiplier
+                                             * user_inputs->detour_distance[DR_num][subset_shapeType][DR_num][subset_shapeType]);
+
+        }  // End of for-loop for index 'path_index'
+      }  // End of for-loop for index 'z'
+    }  // End of for-loop for index 'y'
+  }  // End of for-loop for index 'x'
 
-          // printf("DEBUG: Congestion at (%d,%d,%d) for path index %d evaporated to zero, so eliminating this traversing path\n",
-          //        x, y, z, pathIndex);
-          // printf("       and moving subsequent path indices 'down' by one...\n");
+}  // End of function 'updateCongestionSummaries'
 
-          // For each of the subsequent paths that traverse this cell, move the
-          // path number and its congestion 'down' by 1. That is, reduce the index
-          // values for these subsequent paths:
-          for (int oldPathIndex = pathIndex + 1; oldPathIndex < new_num_indices; oldPathIndex++)  {
 
-            // Assign path number, DR_subset, shape type, and congestion to (oldPathIndex - 1):
-            cellInfo[x][y][z].congestion[oldPathIndex - 1].pathNum                = cellInfo[x][y][z].congestion[oldPathIndex].pathNum;
-            cellInfo[x][y][z].congestion[oldPathIndex - 1].DR_subset              = cellInfo[x][y][z].congestion[oldPathIndex].DR_subset;
-            cellInfo[x][y][z].congestion[oldPathIndex - 1].shapeType              = cellInfo[x][y][z].congestion[oldPathIndex].shapeType;
-            cellInfo[x][y][z].congestion[oldPathIndex - 1].pathTraversalsTimes100 = cellInfo[x][y][z].congestion[oldPathIndex].pathTraversalsTimes100;
+//-----------------------------------------------------------------------------
+// Name: updateCellRoutingInfo
+// Desc: Copy the static routing attributes of each cell on the routing layers
+//       from the 'cellInfo' matrix into the flat array 'cellRoutingInfo', which
+//       must contain (mapWidth x mapHeight x numLayers) elements. The array
+//       must be rebuilt whenever the design-rule zones, cost zones, barriers or
+//       pin-swap zones in the 'cellInfo' matrix change.
+//-----------------------------------------------------------------------------
+void updateCellRoutingInfo(CellRoutingInfo_t *cellRoutingInfo, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
+
+  for (int x = 0; x < mapInfo->mapWidth; x++)  {
+    for (int y = 0; y < mapInfo->mapHeight; y++)  {
+      for (int z = 0; z < mapInfo->numLayers; z++)  {
+
+        CellRoutingInfo_t *routingInfo = &(cellRoutingInfo[((size_t)x * mapInfo->mapHeight + y) * mapInfo->numLayers + z]);
+        routingInfo->designRuleSet              = cellInfo[x][y][z].designRuleSet;
+        routingInfo->traceCostMultiplierIndex   = cellInfo[x][y][z].traceCostMultiplierIndex;
+        routingInfo->viaUpCostMultiplierIndex   = cellInfo[x][y][z].viaUpCostMultiplierIndex;
+        routingInfo->viaDownCostMultiplierIndex = cellInfo[x][y][z].viaDownCostMultiplierIndex;
+        routingInfo->forbiddenTraceBarrier      = cellInfo[x][y][z].forbiddenTraceBarrier;
+        routingInfo->forbiddenUpViaBarrier      = cellInfo[x][y][z].forbiddenUpViaBarrier;
+        routingInfo->forbiddenDownViaBarrier    = cellInfo[x][y][z].forbiddenDownViaBarrier;
+        routingInfo->swap_zone                  = cellInfo[x][y][z].swap_zone;
+        routingInfo->nearBarrier                = (cellInfo[x][y][z].forbiddenProximityBarrier != 0);
+        routingInfo->nearPinSwap                = (cellInfo[x][y][z].forbiddenProximityPinSwap != 0);
+
+      }  // End of for-loop for index 'z'
+    }  // End of for-loop for index 'y'
+  }  // End of for-loop for index 'x'
 
-            // printf("DEBUG:     Moved path number %d and congestion %d from path index %d to %d at (%d,%d,%d).\n",
-            //         temp_path_number, temp_congestion, oldPathIndex, oldPathIndex-1, x, y, z);
+}  // End of function 'updateCellRoutingInfo'
 
-          }  // End of for-loop for index 'oldPathIndex'
-          // printf("DEBUG:     Done moving subsequent path indices 'down' by one.\n");
 
-          // Reduce the new number of congestion indices by 1:
-          new_num_indices--;
+//-----------------------------------------------------------------------------
+// Name: allocateDirtyTiles
+// Desc: Allocate the per-tile arrays of 'dirtyTiles' for the map described by
+//       'mapInfo', and initialize the congestion of each tile to zero. The
+//       memory must later be freed by function freeDirtyTiles().
+//-----------------------------------------------------------------------------
+void allocateDirtyTiles(DirtyTiles_t *dirtyTiles, const MapInfo_t *mapInfo)  {
+
+  dirtyTiles->numTilesX = (mapInfo->mapWidth  + dirtyTileSize - 1) / dirtyTileSize;
+  dirtyTiles->numTilesY = (mapInfo->mapHeight + dirtyTileSize - 1) / dirtyTileSize;
+  dirtyTiles->numLayers = mapInfo->numLayers;
+  dirtyTiles->numTiles  = dirtyTiles->numTilesX * dirtyTiles->numTilesY * dirtyTiles->numLayers;
+  dirtyTiles->numDirtyTiles = 0;
+
+  dirtyTiles->congestionCost = calloc(dirtyTiles->numTiles, sizeof(double));
+  dirtyTiles->isDirty        = calloc(dirtyTiles->numTiles, sizeof(unsigned char));
+  if ((dirtyTiles->congestionCost == NULL) || (dirtyTiles->isDirty == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for %'d tiles in function 'allocateDirtyTiles'.\n\n", dirtyTiles->numTiles);
+    exit(1);
+  }
 
-          // Update the 'cellInfo' matrix with the new (reduced) number of congestion
-          // indices for this cell:
-          cellInfo[x][y][z].numTraversingPaths = new_num_indices;
+}  // End of function 'allocateDirtyTiles'
 
-          // Re-allocate (or free) memory for 'congestion[x][y][z]' array so the array
-          // requires 1 fewer element:
-          if (new_num_indices)  {
-            cellInfo[x][y][z].congestion = realloc(cellInfo[x][y][z].congestion,
-                                            new_num_indices * sizeof(Congestion_t));
+
+//-----------------------------------------------------------------------------
+// Name: updateDirtyTiles
+// Desc: Sum the congestion in each tile of 'dirtyTiles', weighting TRACE
+//       congestion by 'mapInfo->traceCongestionMultiplier' and via congestion
+//       by 'mapInfo->viaCongestionMultiplier'. A tile is flagged as dirty if
+//       this sum changed by more than 'tolerancePercent' percent of the larger
+//       of the new and previous sums since the previous call to this function.
+//       Because the sums include the congestion multipliers, changes of these
+//       multipliers also mark tiles as dirty.
+//-----------------------------------------------------------------------------
+void updateDirtyTiles(DirtyTiles_t *dirtyTiles, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                      const float tolerancePercent, int num_threads)  {
+
+  int numDirtyTiles = 0;
+
+  #pragma omp parallel for schedule(dynamic, 1) reduction(+:numDirtyTiles) if (num_threads > 1)
+  for (int tileIndex = 0; tileIndex < dirtyTiles->numTiles; tileIndex++)  {
+
+    const int tileX = tileIndex % dirtyTiles->numTilesX;
+    const int tileY = (tileIndex / dirtyTiles->numTilesX) % dirtyTiles->numTilesY;
+    const int z     = tileIndex / (dirtyTiles->numTilesX * dirtyTiles->numTilesY);
+
+    const int maxX = min(mapInfo->mapWidth,  (tileX + 1) * dirtyTileSize);
+    const int maxY = min(mapInfo->mapHeight, (tileY + 1) * dirtyTileSize);
+
+    double traceCongestion = 0.0;
+    double viaCongestion   = 0.0;
+    for (int x = tileX * dirtyTileSize; x < maxX; x++)  {
+      for (int y = tileY * dirtyTileSize; y < maxY; y++)  {
+        for (int path_index = 0; path_index < cellInfo[x][y][z].numTraversingPaths; path_index++)  {
+          if (cellCongestion(&(cellInfo[x][y][z]))[path_index].shapeType == TRACE)  {
+            traceCongestion += cellCongestion(&(cellInfo[x][y][z]))[path_index].pathTraversalsTimes100;
           }
           else  {
-            // There is no longer any congestion at (x,y,z), so free the
-            // memory in the 1-dimensional 'congestion' matrix for this
-            // (x,y,z) location:
-            free(cellInfo[x][y][z].congestion);
-            cellInfo[x][y][z].congestion = NULL; // Set pointer to NULL as a precaution
+            viaCongestion   += cellCongestion(&(cellInfo[x][y][z]))[path_index].pathTraversalsTimes100;
           }
+        }  // End of for-loop for index 'path_index'
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
 
-        }  // End of else-block to handle case where new_congestion is zero
+    const double newCost = traceCongestion * mapInfo->traceCongestionMultiplier
+                           + viaCongestion * mapInfo->viaCongestionMultiplier;
+    const double oldCost = dirtyTiles->congestionCost[tileIndex];
 
-      }  // End of while-loop for (pathIndex < new_num_indices)
+    dirtyTiles->isDirty[tileIndex] = (fabs(newCost - oldCost) > 0.01 * tolerancePercent * max(newCost, oldCost));
+    dirtyTiles->congestionCost[tileIndex] = newCost;
+    numDirtyTiles += dirtyTiles->isDirty[tileIndex];
 
-    }  // End of for-loop for index 'i'
-  }  // End of for-loop for index 'thread'
+  }  // End of for-loop for index 'tileIndex'
+
+  dirtyTiles->numDirtyTiles = numDirtyTiles;
+
+}  // End of function 'updateDirtyTiles'
+
+
+//-----------------------------------------------------------------------------
+// Name: boxContainsDirtyTile
+// Desc: Return TRUE if any tile that overlaps the box between the coordinates
+//       'boxMin' and 'boxMax' (inclusive) is flagged as dirty in 'dirtyTiles'.
+//-----------------------------------------------------------------------------
+int boxContainsDirtyTile(const DirtyTiles_t *dirtyTiles, const Coordinate_t boxMin, const Coordinate_t boxMax)  {
+
+  for (int z = boxMin.Z; z <= boxMax.Z; z++)  {
+    for (int tileY = boxMin.Y / dirtyTileSize; tileY <= boxMax.Y / dirtyTileSize; tileY++)  {
+      for (int tileX = boxMin.X / dirtyTileSize; tileX <= boxMax.X / dirtyTileSize; tileX++)  {
+        if (dirtyTiles->isDirty[(z * dirtyTiles->numTilesY + tileY) * dirtyTiles->numTilesX + tileX])  {
+          return(TRUE);
+        }
+      }  // End of for-loop for index 'tileX'
+    }  // End of for-loop for index 'tileY'
+  }  // End of for-loop for index 'z'
+
+  return(FALSE);
+
+}  // End of function 'boxContainsDirtyTile'
+
+
+//-----------------------------------------------------------------------------
+// Name: pathTouchesDirtyTile
+// Desc: Return TRUE if any of the 'pathLength' cells in 'pathCoords' lies in a
+//       tile that is flagged as dirty in 'dirtyTiles'.
+//-----------------------------------------------------------------------------
+int pathTouchesDirtyTile(const DirtyTiles_t *dirtyTiles, const Coordinate_t pathCoords[], const int pathLength)  {
 
-  // Free the memory that was allocated in this function:
-  for (int i = 0; i < num_threads; i++)  {
-    free(zeroCongestionCells[i]);
-    zeroCongestionCells[i] = NULL;
+  for (int i = 0; i < pathLength; i++)  {
+    const int tileIndex = (pathCoords[i].Z * dirtyTiles->numTilesY + pathCoords[i].Y / dirtyTileSize) * dirtyTiles->numTilesX
+                          + pathCoords[i].X / dirtyTileSize;
+    if (dirtyTiles->isDirty[tileIndex])  {
+      return(TRUE);
+    }
   }  // End of for-loop for index 'i'
 
-}  // End of function 'evaporateCongestion'
+  return(FALSE);
+
+}  // End of function 'pathTouchesDirtyTile'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDirtyTiles
+// Desc: Free the memory allocated by function allocateDirtyTiles().
+//-----------------------------------------------------------------------------
+void freeDirtyTiles(DirtyTiles_t *dirtyTiles)  {
+
+  free(dirtyTiles->congestionCost);  dirtyTiles->congestionCost = NULL;
+  free(dirtyTiles->isDirty);         dirtyTiles->isDirty        = NULL;
+
+}  // End of function 'freeDirtyTiles'
 
 
 //-----------------------------------------------------------------------------
@@ -343,7 +586,7 @@ void directionToText(const int routeDir, char * routeDescription)  {
 //
 //       If an entry with 'pathNum', 'shapeType', and 'DR_subset' does not
 //       already exist in this cell, then re-allocate memory to increase the
-//       array length of cellInfo[x][y][z].congestion[i].
+//       array length of cellCongestion(&(cellInfo[x][y][z]))[i].
 //-----------------------------------------------------------------------------
 void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
                    unsigned short shapeType, unsigned congestionPenalty)  {
@@ -354,6 +597,10 @@ void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
     return;
   }
 
+  // The 'congestion' array is about to be modified, so it must not be shared
+  // with another map:
+  unshareCongestion(cellInfo);
+
   // Check whether the 'pathNum' path with shape-type 'shapeType' and design-rule
   // subset 'DR_subset' already traverses the current cell.
   const int pathIndex = getIndexOfTraversingPath(cellInfo, pathNum, DR_subset, shapeType);
@@ -362,7 +609,7 @@ void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
 
     // 'pathNum' path already traverses current cell, so simply augment the
     // congestion associated with this path:
-    const unsigned original_congestion = cellInfo->congestion[pathIndex].pathTraversalsTimes100;
+    const unsigned original_congestion = cellCongestion(cellInfo)[pathIndex].pathTraversalsTimes100;
 
     // printf("  DEBUG: Path number %d with shape-type %d and DR_subset %d already traverses (%d,%d,%d) with pathTraversalsTimes100 = %d,\n",
     //        pathNum, shapeType, DR_subset, x, y, z, original_congestion);
@@ -409,36 +656,20 @@ void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
 
   // If this is the first congestion added at this cell), then allocate
   // memory to accommodate 1 element. If this location already
-  // contained congestion from other path-crossings, then
-  // re-allocate memory of the 'congestion[x][y][z]' array so it can
+  // contained congestion from other path-crossings, then grow the
+  // 'congestion[x][y][z]' array by one element. The array moves to a
+  // larger slab block only if its current block is full:
   // printf("DEBUG: Address of cellInfo[%d][%d][%d].congestion is %p.\n", x, y, z, cellInfo[x][y][z].congestion);
-  // printf("DEBUG: sizeof(Congestion_t) is %d.\n", (int) sizeof(Congestion_t));
-  // printf("DEBUG: About to re-allocate memory in 'cellInfo[][][].congestion' matrix...\n");
-  if (original_num_paths == 0)  {
-    cellInfo->congestion = malloc(new_num_paths * sizeof(Congestion_t));
-    // printf("DEBUG: Memory allocated for cellInfo[%d][%d][%d].congestion at address %p\n", x, y, z, cellInfo[x][y][z].congestion);
-    if (cellInfo->congestion == 0)  {
-      printf("\n\nERROR: Failed to allocate memory for congestion in 'cellInfo' matrix in function 'addCongestion'.\n\n");
-      exit(1);
-    }  // End of if-block
-  }  // End of if-block
-  else  {
-    cellInfo->congestion = realloc(cellInfo->congestion, new_num_paths * sizeof(Congestion_t));
-    // printf("DEBUG: Memory reallocated for cellInfo[%d][%d][%d].congestion at address %p\n", x, y, z, cellInfo[x][y][z].congestion);
-    if (cellInfo->congestion == 0)  {
-      printf("\n\nERROR: Failed to re-allocate memory for congestion in 'cellInfo' matrix in function 'addCongestion'.\n\n");
-      exit(1);
-    }  // End of if-block
-  }  // End of if/else block
+  cellInfo->congestionHandle = resizeCongestion(cellInfo->congestionHandle, original_num_paths, new_num_paths);
   // printf("DEBUG: In function 'addCongestion', successfully re-allocated memory for congestion in the 'cellInfo' matrix for path %d at (%d,%d,%d), with new_num_paths=%d.\n", pathNum, x, y, z, new_num_paths);
 
   // Add congestionPenalty, path number, and path type  to 'cellInfo' matrix. Note that the path index
   // is equal to 'original_num_paths', since the index range is zero to (new_num_paths-1),
   // and original_num_paths is equal to new_num_paths-1.
-  cellInfo->congestion[original_num_paths].pathTraversalsTimes100 = congestionPenalty;
-  cellInfo->congestion[original_num_paths].pathNum                = pathNum;
-  cellInfo->congestion[original_num_paths].DR_subset              = DR_subset;
-  cellInfo->congestion[original_num_paths].shapeType              = shapeType;
+  cellCongestion(cellInfo)[original_num_paths].pathTraversalsTimes100 = congestionPenalty;
+  cellCongestion(cellInfo)[original_num_paths].pathNum                = pathNum;
+  cellCongestion(cellInfo)[original_num_paths].DR_subset              = DR_subset;
+  cellCongestion(cellInfo)[original_num_paths].shapeType              = shapeType;
 
   // printf("  DEBUG: cellInfo[%d][%d][%d].congestion[%d].pathTraversalsTimes100 set to %d.\n",
   //         x, y, z, original_num_paths, congestionPenalty);
@@ -462,31 +693,219 @@ void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
 }  // End of function 'addCongestion'
 
 
+//-----------------------------------------------------------------------------
+// Name: radixHeapBucketNumber
+// Desc: Return the number of the radix-heap bucket for an entry with F-cost
+//       'key', given the most recently extracted F-cost, 'lastKey'. Keys that
+//       equal 'lastKey' go into bucket 0. Other keys go into the bucket whose
+//       number is the position (counting from 1) of the most significant bit
+//       in which 'key' differs from 'lastKey'. Keys smaller than 'lastKey' can
+//       only result from a heuristic that is not consistent. They are also
+//       placed in bucket 0, from which they are extracted next.
+//-----------------------------------------------------------------------------
+static int radixHeapBucketNumber(unsigned long key, unsigned long lastKey)  {
+
+  if (key <= lastKey)
+    return(0);
+  else
+    return(64 - __builtin_clzl(key ^ lastKey));
+
+}  // End of function 'radixHeapBucketNumber'
+
+
+//-----------------------------------------------------------------------------
+// Name: appendToRadixHeapBucket
+// Desc: Append an entry to a radix-heap bucket, doubling the memory allocated
+//       for the bucket if it is full.
+//-----------------------------------------------------------------------------
+static void appendToRadixHeapBucket(RadixHeapBucket_t *bucket, unsigned long Fcost, Coordinate_t coord)  {
+
+  if (bucket->numEntries == bucket->maxEntries)  {
+    bucket->maxEntries = max(64, 2 * bucket->maxEntries);
+    bucket->entry = realloc(bucket->entry, bucket->maxEntries * sizeof(RadixHeapEntry_t));
+    if (bucket->entry == NULL)  {
+      printf("\n\nERROR: Failed to reallocate memory for %d entries of a radix-heap bucket in function 'appendToRadixHeapBucket'.\n\n",
+             bucket->maxEntries);
+      exit(1);
+    }
+  }  // End of if-block for full bucket
+
+  bucket->entry[bucket->numEntries].Fcost = Fcost;
+  bucket->entry[bucket->numEntries].coord = coord;
+  bucket->numEntries++;
+
+}  // End of function 'appendToRadixHeapBucket'
+
+
+//-----------------------------------------------------------------------------
+// Name: initializeRadixHeap
+// Desc: Initialize a newly created radix heap with empty buckets that have no
+//       memory allocated to them.
+//-----------------------------------------------------------------------------
+void initializeRadixHeap(RadixHeap_t *heap)  {
+
+  heap->lastKey = 0;
+  for (int bucketNum = 0; bucketNum < numRadixHeapBuckets; bucketNum++)  {
+    heap->bucket[bucketNum].entry      = NULL;
+    heap->bucket[bucketNum].numEntries = 0;
+    heap->bucket[bucketNum].maxEntries = 0;
+  }
+
+}  // End of function 'initializeRadixHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: emptyRadixHeap
+// Desc: Remove all entries from a radix heap without freeing the memory of its
+//       buckets, which is re-used by the next search.
+//-----------------------------------------------------------------------------
+void emptyRadixHeap(RadixHeap_t *heap)  {
+
+  heap->lastKey = 0;
+  for (int bucketNum = 0; bucketNum < numRadixHeapBuckets; bucketNum++)  {
+    heap->bucket[bucketNum].numEntries = 0;
+  }
+
+}  // End of function 'emptyRadixHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeRadixHeap
+// Desc: Free the memory of the buckets in a radix heap.
+//-----------------------------------------------------------------------------
+void freeRadixHeap(RadixHeap_t *heap)  {
+
+  for (int bucketNum = 0; bucketNum < numRadixHeapBuckets; bucketNum++)  {
+    free(heap->bucket[bucketNum].entry);
+  }
+  initializeRadixHeap(heap);
+
+}  // End of function 'freeRadixHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: pushRadixHeap
+// Desc: Add a cell with F-cost 'Fcost' to a radix-heap Open List.
+//-----------------------------------------------------------------------------
+void pushRadixHeap(RadixHeap_t *heap, unsigned long Fcost, Coordinate_t coord)  {
+
+  int bucketNum = radixHeapBucketNumber(Fcost, heap->lastKey);
+  appendToRadixHeapBucket(&(heap->bucket[bucketNum]), Fcost, coord);
+
+}  // End of function 'pushRadixHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: peekRadixHeap
+// Desc: Return a pointer to the entry with the lowest F-cost in a radix-heap
+//       Open List, or NULL if the Open List is empty. Outdated entries, i.e.,
+//       entries for cells whose value in the 'whichList' array is
+//       'onClosedList', are discarded along the way. The 'whichList' array is
+//       indexed with the strides of 'pathFinding'. When bucket 0 is empty, the
+//       lowest non-empty bucket is redistributed into lower buckets around its
+//       smallest key. The returned entry is removed by calling popRadixHeap().
+//-----------------------------------------------------------------------------
+const RadixHeapEntry_t * peekRadixHeap(RadixHeap_t *heap, const PathFinding_t *pathFinding,
+                                       const unsigned short whichList[], unsigned short onClosedList)  {
+
+  RadixHeapBucket_t *bucket_0 = &(heap->bucket[0]);
+
+  do  {
+    // Discard outdated entries from the end of bucket 0, and return the first entry
+    // that is still valid:
+    while (bucket_0->numEntries > 0)  {
+      const RadixHeapEntry_t *top = &(bucket_0->entry[bucket_0->numEntries - 1]);
+      if (whichList[pathFindingCoordIndex(pathFinding, top->coord)] != onClosedList)  {
+        return(top);
+      }
+      bucket_0->numEntries--;
+    }  // End of while-loop for (numEntries > 0)
+
+    // Bucket 0 is empty, so find the lowest-numbered bucket that is not empty:
+    int bucketNum = 1;
+    while ((bucketNum < numRadixHeapBuckets) && (heap->bucket[bucketNum].numEntries == 0))  {
+      bucketNum++;
+    }
+    if (bucketNum == numRadixHeapBuckets)  {
+      return(NULL);  // The Open List is empty
+    }
+    RadixHeapBucket_t *bucket = &(heap->bucket[bucketNum]);
+
+    // Find the smallest F-cost among the valid entries in this bucket:
+    unsigned long minKey = ULONG_MAX;
+    int numValidEntries = 0;
+    for (int i = 0; i < bucket->numEntries; i++)  {
+      if (whichList[pathFindingCoordIndex(pathFinding, bucket->entry[i].coord)] != onClosedList)  {
+        minKey = min(minKey, bucket->entry[i].Fcost);
+        numValidEntries++;
+      }
+    }  // End of for-loop for index 'i'
+
+    // Move the valid entries into lower-numbered buckets, relative to the new 'lastKey'
+    // value. Each of these entries differs from 'minKey' in a lower bit than 'bucketNum-1',
+    // so none of them returns to the current bucket:
+    if (numValidEntries > 0)  {
+      heap->lastKey = minKey;
+      for (int i = 0; i < bucket->numEntries; i++)  {
+        if (whichList[pathFindingCoordIndex(pathFinding, bucket->entry[i].coord)] != onClosedList)  {
+          pushRadixHeap(heap, bucket->entry[i].Fcost, bucket->entry[i].coord);
+        }
+      }  // End of for-loop for index 'i'
+    }  // End of if-block for (numValidEntries > 0)
+    bucket->numEntries = 0;
+
+  } while (1);  // End of do/while-loop
+
+}  // End of function 'peekRadixHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: popRadixHeap
+// Desc: Remove the entry that was most recently returned by peekRadixHeap()
+//       from a radix-heap Open List.
+//-----------------------------------------------------------------------------
+void popRadixHeap(RadixHeap_t *heap)  {
+
+  heap->bucket[0].numEntries--;
+
+}  // End of function 'popRadixHeap'
+
+
 //-----------------------------------------------------------------------------
 // Name: initializePathFindingArrays
-// Desc: Initialize all elements in the various path-finding arrays to values
-//       appropriate for the beginning of function 'findPath()'.
+// Desc: Prepare the path-finding arrays for the beginning of function
+//       'findPath()' by advancing the search-generation. Because the values
+//       in the 'whichList' array are stamped with the generation that wrote
+//       them, this makes every cell 'notOpenOrClosedList' without touching
+//       the array. The 'whichList' array is cleared only when the generation
+//       number exceeds 'maxSearchGeneration' and must wrap around to 1.
+//       The 'sortNumber' array is not cleared because findPath() reads it
+//       only for cells that are on the Open List of the current search. For
+//       the radix-heap engine, the buckets are emptied without freeing their
+//       memory, which is re-used by the next search.
 //-----------------------------------------------------------------------------
 void initializePathFindingArrays(PathFinding_t *pathFinding, const MapInfo_t *mapInfo)  {
 
-  const char notOpenOrClosedList = -1;  // Denotes that cell is not yet on the Open or Closed List
-
   // printf("DEBUG: Entered 'initializePathFindingArrays' with pathFinding address = %p\n", pathFinding);
-  int i, j, k;
 
-  for (i = 0; i < (mapInfo->mapWidth+1) ; i++)  {
-    for (j = 0; j < (mapInfo->mapHeight+1); j++)  {
-      for (k = 0; k < (mapInfo->numLayers+1); k++)  {
-        // Initialize whichList elements so all cells are neither on the Open
-        // nor the Closed list.
+  if (pathFinding->searchGeneration < maxSearchGeneration)  {
+    pathFinding->searchGeneration++;
+  }
+  else  {
+    // We got here, so the generation number would overflow the 16-bit 'whichList'
+    // elements. Clear every element to zero, which matches no generation from 1
+    // to 'maxSearchGeneration', and re-start the generation number at 1:
+    memset(pathFinding->whichList, 0, sizeof(unsigned short) * pathFinding->numCells);
+    if (pathFinding->whichList_reverse != NULL)  {
+      memset(pathFinding->whichList_reverse, 0, sizeof(unsigned short) * pathFinding->numCells);
+    }
 
-        // printf("DEBUG: About to set whichList[%d][%d][%d] to %d\n", i, j, k, notOpenOrClosedList);
+    pathFinding->searchGeneration = 1;
+  }  // End of if/else-block for (searchGeneration < maxSearchGeneration)
 
-        pathFinding->whichList[i][j][k] = notOpenOrClosedList;
-        pathFinding->sortNumber[i][j][k] = 0;
-      }  // End of for-loop for index 'k'
-    }  // End of for-loop for index 'j'
-   }  // End of for-loop for index 'i'
+  if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+    emptyRadixHeap(&(pathFinding->radixHeap));
+  }
 
 }  // End of function 'initializePathFindingArrays'
 
@@ -610,6 +1029,48 @@ int allowedDirection(const int deltaX, const int deltaY, const int deltaZ, const
 }  // End of function 'allowedDirection'
 
 
+//-----------------------------------------------------------------------------
+// Name: calcAllowedTransitionMasks
+// Desc: Populate the 'minimumRoutingDirections' and 'allowedTransitionMask'
+//       look-up tables in 'pathFinding' for path 'pathNum'. For each pair of
+//       design-rule sets (parent cell, child cell), the tables hold the result
+//       of calcMinimumAllowedDirection() and a bitmask in which bit 'i' is set
+//       if allowedDirection() permits the transition (allowedDeltaX[i],
+//       allowedDeltaY[i], allowedDeltaZ[i]). The tables depend only on the
+//       path's design-rule subsets and the order of the transitions, so they
+//       are calculated once per call to findPath() instead of once per child
+//       cell.
+//-----------------------------------------------------------------------------
+void calcAllowedTransitionMasks(PathFinding_t *pathFinding, const int pathNum, const InputValues_t *user_inputs,
+                                const int num_transitions, const int allowedDeltaX[], const int allowedDeltaY[],
+                                const int allowedDeltaZ[])  {
+
+  for (int parent_DR_num = 0; parent_DR_num < user_inputs->numDesignRuleSets; parent_DR_num++)  {
+    int parent_DR_subset = user_inputs->designRuleSubsetMap[pathNum][parent_DR_num];
+    int parent_allowedRoutingDirections = user_inputs->designRules[parent_DR_num][parent_DR_subset].routeDirections;
+
+    for (int child_DR_num = 0; child_DR_num < user_inputs->numDesignRuleSets; child_DR_num++)  {
+      int child_DR_subset = user_inputs->designRuleSubsetMap[pathNum][child_DR_num];
+      int child_allowedRoutingDirections = user_inputs->designRules[child_DR_num][child_DR_subset].routeDirections;
+
+      int minimum_allowedRoutingDirections = calcMinimumAllowedDirection(parent_allowedRoutingDirections,
+                                                                         child_allowedRoutingDirections);
+
+      unsigned int mask = 0;
+      for (int i = 0; i < num_transitions; i++)  {
+        if (allowedDirection(abs(allowedDeltaX[i]), abs(allowedDeltaY[i]), abs(allowedDeltaZ[i]), minimum_allowedRoutingDirections))  {
+          mask |= 1u << i;
+        }
+      }  // End of for-loop for index 'i'
+
+      pathFinding->minimumRoutingDirections[parent_DR_num][child_DR_num] = minimum_allowedRoutingDirections;
+      pathFinding->allowedTransitionMask[parent_DR_num][child_DR_num]    = mask;
+    }  // End of for-loop for index 'child_DR_num'
+  }  // End of for-loop for index 'parent_DR_num'
+
+}  // End of function 'calcAllowedTransitionMasks'
+
+
 //-----------------------------------------------------------------------------
 // Name: calc_heuristic
 // Desc: Calculate the heuristic function, H, which is an estimated cost between
@@ -751,40 +1212,116 @@ unsigned long int calc_heuristic(const int currentX, const int currentY, const i
 }  // End of function 'calc_heuristic'
 
 
+//
+// Value of an empty slot in the hash table of a DRCPairSet_t structure. No pair of
+// paths and shape-types has this key, because path numbers are less than 1024.
+//
+#define emptyDRCPairKey 0xFFFFFFFFu
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateDRCPairSet
+// Desc: Allocate an empty set of design-rule violations with an initial hash
+//       table of 'numSlots' slots, which is rounded up to a power of 2. The
+//       table is enlarged as needed. The memory must later be freed with
+//       function freeDRCPairSet().
+//-----------------------------------------------------------------------------
+void allocateDRCPairSet(DRCPairSet_t *DRCs, int numSlots)  {
+
+  DRCs->numSlots = 16;
+  DRCs->hashShift = 28;
+  while (DRCs->numSlots < numSlots)  {
+    DRCs->numSlots *= 2;
+    DRCs->hashShift--;
+  }
+
+  DRCs->keys         = malloc(DRCs->numSlots * sizeof(unsigned int));
+  DRCs->touchedSlots = malloc(DRCs->numSlots * sizeof(int));
+  if ((DRCs->keys == NULL) || (DRCs->touchedSlots == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for a set of %d design-rule violations.\n", DRCs->numSlots);
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit(1);
+  }
+  for (int slot = 0; slot < DRCs->numSlots; slot++)  {
+    DRCs->keys[slot] = emptyDRCPairKey;
+  }
+  DRCs->numKeys = 0;
+
+}  // End of function 'allocateDRCPairSet'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDRCPairSet
+// Desc: Free the memory allocated by function allocateDRCPairSet().
+//-----------------------------------------------------------------------------
+void freeDRCPairSet(DRCPairSet_t *DRCs)  {
+
+  free(DRCs->keys);          DRCs->keys = NULL;
+  free(DRCs->touchedSlots);  DRCs->touchedSlots = NULL;
+  DRCs->numKeys = 0;
+  DRCs->numSlots = 0;
+
+}  // End of function 'freeDRCPairSet'
+
+
+//-----------------------------------------------------------------------------
+// Name: clearDRCPairSet
+// Desc: Remove all design-rule violations from set 'DRCs'. Only the slots that
+//       were filled are emptied.
+//-----------------------------------------------------------------------------
+void clearDRCPairSet(DRCPairSet_t *DRCs)  {
+
+  for (int i = 0; i < DRCs->numKeys; i++)  {
+    DRCs->keys[DRCs->touchedSlots[i]] = emptyDRCPairKey;
+  }
+  DRCs->numKeys = 0;
+
+}  // End of function 'clearDRCPairSet'
+
+
 //-----------------------------------------------------------------------------
-// Name: record_DRC_by_index
-// Desc: Set bit number 'index' in the stream of bytes that make up character
-//       array 'DRCs[]'. Bit #0 is the least-significant bit in the first
-//       element/byte of the array, bit #1 is the 2nd least significant bit,
-//       bit #8 is the least-significant bit of the 2nd element/byte, etc, etc.
+// Name: find_DRC_slot
+// Desc: Return the slot number in the hash table of 'DRCs' that holds 'key',
+//       or the empty slot at which the search for 'key' ended if 'key' is not
+//       in the set. Collisions are resolved by linear probing.
 //-----------------------------------------------------------------------------
-static void record_DRC_by_index(char DRCs[], int index)  {
+static inline int find_DRC_slot(const DRCPairSet_t *DRCs, unsigned int key)  {
+
+  // Use Fibonacci hashing to spread consecutive keys across the table:
+  int slot = (int)((key * 2654435769u) >> DRCs->hashShift);
+  while ((DRCs->keys[slot] != key) && (DRCs->keys[slot] != emptyDRCPairKey))  {
+    slot = (slot + 1) & (DRCs->numSlots - 1);
+  }
+
+  return(slot);
 
-  // printf("DEBUG: Entered function 'record_DRC_by_index' with index = %d.\n", index);
+}  // End of function 'find_DRC_slot'
 
-  int byte_number = index / 8;
-  short remainder = index % 8;
 
-  // Create a 1-byte mask based on the remainder value:
-  //  remainder value       mask value (binary)
-  //  ---------------       -------------------
-  //         0         (msb)  0 0 0 0 0 0 0 1  (lsb)
-  //         1                0 0 0 0 0 0 1 0
-  //         2                0 0 0 0 0 1 0 0
-  //         3                0 0 0 0 1 0 0 0
-  //         4                0 0 0 1 0 0 0 0
-  //         5                0 0 1 0 0 0 0 0
-  //         6                0 1 0 0 0 0 0 0
-  //         7                1 0 0 0 0 0 0 0
-  unsigned char mask = 1 << remainder;
+//-----------------------------------------------------------------------------
+// Name: enlarge_DRC_pair_set
+// Desc: Double the number of slots in the hash table of 'DRCs', and re-insert
+//       the keys in the order they were originally added.
+//-----------------------------------------------------------------------------
+static void enlarge_DRC_pair_set(DRCPairSet_t *DRCs)  {
+
+  unsigned int *oldKeys = DRCs->keys;
+  int *oldTouchedSlots = DRCs->touchedSlots;
+  const int numKeys = DRCs->numKeys;
+
+  allocateDRCPairSet(DRCs, 2 * DRCs->numSlots);
+  for (int i = 0; i < numKeys; i++)  {
+    const unsigned int key = oldKeys[oldTouchedSlots[i]];
+    const int slot = find_DRC_slot(DRCs, key);
+    DRCs->keys[slot] = key;
+    DRCs->touchedSlots[DRCs->numKeys] = slot;
+    DRCs->numKeys++;
+  }
 
-  // Set the appropriate bit of byte number 'byte_number' by
-  // doing a binary OR operation of this byte's previous value
-  // and the 'mask' value:
-  // printf("DEBUG: Writing to element #%d of array DRCs[]. mask = %d\n", byte_number, mask);
-  DRCs[byte_number] = DRCs[byte_number] | mask;
+  free(oldKeys);
+  free(oldTouchedSlots);
 
-}  // End of function 'record_DRC_by_index'
+}  // End of function 'enlarge_DRC_pair_set'
 
 
 //-----------------------------------------------------------------------------
@@ -793,10 +1330,11 @@ static void record_DRC_by_index(char DRCs[], int index)  {
 //       a path number (path_1) and its shape-type (shapeType_1), plus an
 //       offending path number (path_2) and its shape-type (shapeType_2).
 //       Each combination of these 4 input variables is mapped to a unique
-//       bit 'index', which is returned by this function.
+//       bit 'index', which is returned by this function. The index is also
+//       the key of the combination in a DRCPairSet_t structure.
 //-----------------------------------------------------------------------------
-static int calc_DRC_bit_index(unsigned int numPaths, int path_1, int shapeType_1,
-                              int path_2, int shapeType_2)  {
+static unsigned int calc_DRC_bit_index(unsigned int numPaths, int path_1, int shapeType_1,
+                                       int path_2, int shapeType_2)  {
 
   // printf("DEBUG: Entered function calc_DRC_bit_index with numPaths=%d, path_1=%d, shapeType_1=%d, path_2=%d, shape_type_2=%d\n",
   //        numPaths, path_1, shapeType_1, path_2, shapeType_2);
@@ -821,18 +1359,19 @@ static int calc_DRC_bit_index(unsigned int numPaths, int path_1, int shapeType_1
     shapeType_2 = temp;
   }  // End of if-block for (path_2 > path_1)
 
-  // Calculate the index value:
-  int index = 0;  // Initialize the value that will be returned.
-  // The following for-loop calculates the index values in a 2x2 symmetric matrix above
-  // the row corresponding to the DRC interaction:
-  for (int row = 0; row <= path_2*NUM_SHAPE_TYPES + shapeType_2 - 1; row++)  {
-    // Add to 'index' the number of cells that we skip before getting to the
-    // cell of interest:
-    index = index + NUM_SHAPE_TYPES * (numPaths - (row/3) - 1);
-  }  // End of for-loop
+  // Calculate the index value. The bits are arranged as the upper triangle of a symmetric
+  // matrix with one row and one column for each combination of path and shape-type. Row
+  // (path, shapeType) holds NUM_SHAPE_TYPES * (numPaths - path - 1) bits, one for each
+  // combination with a larger path number. First, count the bits in the NUM_SHAPE_TYPES
+  // rows of each path less than path_2, which is the sum of an arithmetic series:
+  const unsigned int numPaths_2 = path_2;
+  unsigned int index = NUM_SHAPE_TYPES * NUM_SHAPE_TYPES * (numPaths_2 * (numPaths - 1)  -  numPaths_2 * (numPaths_2 - 1) / 2);
+
+  // Add the bits in the rows of path_2 above the row of shapeType_2:
+  index += NUM_SHAPE_TYPES * shapeType_2 * (numPaths - path_2 - 1);
 
   // Calculate the offset in the final row and add to 'index':
-  index = index + NUM_SHAPE_TYPES * (path_1 - path_2 - 1)    +    shapeType_1;
+  index += NUM_SHAPE_TYPES * (path_1 - path_2 - 1)    +    shapeType_1;
 
   // printf("DEBUG: Exiting function calc_DRC_bit_index with index = %d\n", index);
 
@@ -846,78 +1385,45 @@ static int calc_DRC_bit_index(unsigned int numPaths, int path_1, int shapeType_1
 // Name: record_DRC_by_paths
 // Desc: Record the design-rule violation between path number (path_1) and its
 //       shape-type (shapeType_1) and offending path number (path_2) and its
-//       shape-type (shapeType_2).
+//       shape-type (shapeType_2) in the set 'DRCs'.
 //-----------------------------------------------------------------------------
-void record_DRC_by_paths(int numPaths, char DRCs[], int path_1, int shapeType_1,
+void record_DRC_by_paths(int numPaths, DRCPairSet_t *DRCs, int path_1, int shapeType_1,
                          int path_2, int shapeType_2)  {
 
-  // Determine the index based on the path numbers and shape-types:
-  int index = calc_DRC_bit_index(numPaths, path_1, shapeType_1, path_2, shapeType_2);
-
-  // Set the bit to '1' in the 'DRCs[]' array corresponding to the path numbers
-  // and shape-types:
-  record_DRC_by_index(DRCs, index);
-
-}  // End of function 'record_DRC_by_paths'
-
-
-//-----------------------------------------------------------------------------
-// Name: read_DRC_by_index
-// Desc: Read bit number 'index' in the stream of bytes that make up character
-//       array 'DRCs[]'. Bit #0 is the least-significant bit in the first
-//       element/byte of the array, bit #1 is the 2nd least significant bit,
-//       bit #8 is the least-significant bit of the 2nd element/byte, etc, etc.
-//-----------------------------------------------------------------------------
-static unsigned char read_DRC_by_index(char DRCs[], int index)  {
-
-  int byte_number = index / 8;
-  short remainder = index % 8;
+  // Keep the hash table no more than half full, so that searches remain short:
+  if (2 * (DRCs->numKeys + 1) > DRCs->numSlots)  {
+    enlarge_DRC_pair_set(DRCs);
+  }
 
-  // Create a 1-byte mask based on the remainder value:
-  //  remainder value       mask value (binary)
-  //  ---------------       -------------------
-  //         0         (msb)  0 0 0 0 0 0 0 1  (lsb)
-  //         1                0 0 0 0 0 0 1 0
-  //         2                0 0 0 0 0 1 0 0
-  //         3                0 0 0 0 1 0 0 0
-  //         4                0 0 0 1 0 0 0 0
-  //         5                0 0 1 0 0 0 0 0
-  //         6                0 1 0 0 0 0 0 0
-  //         7                1 0 0 0 0 0 0 0
-  unsigned char mask = 1 << remainder;
+  // Determine the key based on the path numbers and shape-types:
+  const unsigned int key = calc_DRC_bit_index(numPaths, path_1, shapeType_1, path_2, shapeType_2);
 
-  // Extract the appropriate bit of byte number 'byte_number' by
-  // doing a binary AND operation of this byte's  value and
-  // the 'mask' value. This AND operation returns a '1' if the
-  // requested bit is '1', and returns '0' if the requested bit
-  // is zero.
-  // printf("DEBUG: In function 'read_DRC_by_index(),' accessing element %d of array DRCs[]. mask=%d\n", byte_number, mask);
-  unsigned char result = (DRCs[byte_number] & mask) >> remainder;
-  return(result);
+  // Add the key to the set if it's not already there:
+  const int slot = find_DRC_slot(DRCs, key);
+  if (DRCs->keys[slot] == emptyDRCPairKey)  {
+    DRCs->keys[slot] = key;
+    DRCs->touchedSlots[DRCs->numKeys] = slot;
+    DRCs->numKeys++;
+  }
 
-}  // End of function 'read_DRC_by_index'
+}  // End of function 'record_DRC_by_paths'
 
 
 //-----------------------------------------------------------------------------
 // Name: check_for_DRC
-// Desc: Read the 'DRCs[]' array to determine whether a design-rule violation
+// Desc: Read the set 'DRCs' to determine whether a design-rule violation
 //       has previously been recorded between path number (path_1) and its
 //       shape-type (shapeType_1), and offending path number (path_2) and its
 //       shape-type (shapeType_2).
 //-----------------------------------------------------------------------------
-unsigned char check_for_DRC(char DRCs[], unsigned int numPaths, int path_1, int shapeType_1,
+unsigned char check_for_DRC(const DRCPairSet_t *DRCs, unsigned int numPaths, int path_1, int shapeType_1,
                             int path_2, int shapeType_2)  {
 
-  unsigned char result;
-
-  // Determine the index based on the path numbers and shape-types:
-  int index = calc_DRC_bit_index(numPaths, path_1, shapeType_1, path_2, shapeType_2);
+  // Determine the key based on the path numbers and shape-types:
+  const unsigned int key = calc_DRC_bit_index(numPaths, path_1, shapeType_1, path_2, shapeType_2);
 
-  // Read the bit in the 'DRCs[]' array corresponding to the path numbers
-  // and shape-types:
-  result = read_DRC_by_index(DRCs, index);
-
-  return(result);
+  // Search the set for the key:
+  return(DRCs->keys[find_DRC_slot(DRCs, key)] == key);
 
 }  // End of function 'check_for_DRC'
 
@@ -1840,8 +2346,11 @@ unsigned long calc_distance_G_cost(int x, int y, int z, int parentX, int parentY
 
   unsigned long addedGCost = 0;  // G-cost value to be returned from this function
 
+  // Static routing attributes of the target cell at (x,y,z):
+  const CellRoutingInfo_t targetRouting = getCellRoutingInfo(mapInfo, cellInfo, x, y, z);
+
   // 'target_cell_pin_swappable_zone' is 0 if not in a swap-zone, or non-zero if in a swap-zone:
-  int target_cell_pin_swappable_zone = cellInfo[x][y][z].swap_zone;
+  int target_cell_pin_swappable_zone = targetRouting.swap_zone;
   #ifdef DEBUG_calc_distance_G_cost
   // DEBUG code follows:
   if (DEBUG_ON)  {
@@ -1850,9 +2359,9 @@ unsigned long calc_distance_G_cost(int x, int y, int z, int parentX, int parentY
   #endif
 
   // Get indices of cost-multipliers for the target cell at (x,y,z).
-  int target_trace_cost_multiplier_index = cellInfo[x][y][z].traceCostMultiplierIndex;
-  int viaUp_cost_multiplier_index        = cellInfo[x][y][z].viaUpCostMultiplierIndex;
-  int viaDown_cost_multiplier_index      = cellInfo[x][y][z].viaDownCostMultiplierIndex;
+  int target_trace_cost_multiplier_index = targetRouting.traceCostMultiplierIndex;
+  int viaUp_cost_multiplier_index        = targetRouting.viaUpCostMultiplierIndex;
+  int viaDown_cost_multiplier_index      = targetRouting.viaDownCostMultiplierIndex;
 
   #ifdef DEBUG_calc_distance_G_cost
   // DEBUG code follows:
@@ -1942,8 +2451,8 @@ unsigned long calc_distance_G_cost(int x, int y, int z, int parentX, int parentY
     }  // End of else-block in which deltaX=1 and deltaY=2
 
     // Get cost-multiplier indices for the two intermediate cells:
-    int cell1_cost_multiplier_index = cellInfo[x1][y1][z1].traceCostMultiplierIndex;
-    int cell2_cost_multiplier_index = cellInfo[x2][y2][z2].traceCostMultiplierIndex;
+    int cell1_cost_multiplier_index = getCellRoutingInfo(mapInfo, cellInfo, x1, y1, z1).traceCostMultiplierIndex;
+    int cell2_cost_multiplier_index = getCellRoutingInfo(mapInfo, cellInfo, x2, y2, z2).traceCostMultiplierIndex;
 
 
     // Calculate G-costs for various combinations of knight's moves. In each case, the G-cost is calculated thus:
@@ -2158,19 +2667,19 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
     // Check whether the congestion should be considered. Congestion should be considered if:
     //  (a) recognizeSelfCongestion is TRUE or the congestion is not from 'path', AND
     //  (b) excludeCongestion is FALSE, OR the congestion is not from 'excludePathNum':
-    int congestion_pathNum = cellInfo[x][y][parentZ].congestion[path_index].pathNum;
+    int congestion_pathNum = cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].pathNum;
     #ifdef DEBUG_calc_via_congestion
     if (DEBUG_ON)  {
       printf("DEBUG:   %3d: Parent cell (%d,%d,%d) contains congestion from path=%d, subset=%d, shapeType=%d, pathTraversalsTimes100=%'d.\n",
-             path_index, x, y, parentZ, congestion_pathNum, cellInfo[x][y][parentZ].congestion[path_index].DR_subset,
-             cellInfo[x][y][parentZ].congestion[path_index].shapeType, cellInfo[x][y][parentZ].congestion[path_index].pathTraversalsTimes100);
+             path_index, x, y, parentZ, congestion_pathNum, cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].DR_subset,
+             cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].shapeType, cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].pathTraversalsTimes100);
     }
     #endif
     if (   (recognizeSelfCongestion || (congestion_pathNum != path))           // Item (a) above
         && ((! excludeCongestion) || (congestion_pathNum != excludePathNum)))  // Item (b) above
     {
-      int congestion_DR_subset = cellInfo[x][y][parentZ].congestion[path_index].DR_subset;
-      int congestion_shapeType = cellInfo[x][y][parentZ].congestion[path_index].shapeType;
+      int congestion_DR_subset = cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].DR_subset;
+      int congestion_shapeType = cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].shapeType;
 
       #ifdef DEBUG_calc_via_congestion
       if (DEBUG_ON)  {
@@ -2220,7 +2729,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
             // 'pathNum' is a diff-pair path, and the 'congestion_pathNum' is its diff-pair
             // partner, so add more congestion from the foreign path (by a factor of VIA_CONGESTION_FACTOR):
             added_congestion = DIFF_PAIR_PARTNER_VIA_CONGESTION_FACTOR
-                                    * (int)(cellInfo[x][y][parentZ].congestion[path_index].pathTraversalsTimes100
+                                    * (int)(cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].pathTraversalsTimes100
                                     * mapInfo->viaCongestionMultiplier
                                     * user_inputs->detour_distance[parent_DR_num][routing_subset_shapeType][parent_DR_num][congestion_subset_shapeType]
                                     * (parent_via_cost_multiplier + target_via_cost_multiplier)/2);
@@ -2228,7 +2737,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
           else  {
             // 'pathNum' and 'congestion_pathNum' are not diff-pair partners, so add the
             // normal amount of congestion-related G-cost:
-            added_congestion = (int)(cellInfo[x][y][parentZ].congestion[path_index].pathTraversalsTimes100
+            added_congestion = (int)(cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].pathTraversalsTimes100
                                     * mapInfo->viaCongestionMultiplier
                                     * user_inputs->detour_distance[parent_DR_num][routing_subset_shapeType][parent_DR_num][congestion_subset_shapeType]
                                     * (parent_via_cost_multiplier + target_via_cost_multiplier)/2);
@@ -2245,7 +2754,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
             printf("DEBUG: In calc_via_congestion: Path index %d that traverses parent cell (%d,%d,%d) is path number %d (subset %d, shapeType %d)\n",
                     path_index, x, y, parentZ, congestion_pathNum, congestion_DR_subset, congestion_shapeType);
             printf("DEBUG:    cellInfo[%d][%d][%d].congestion[%d].pathTraversalsTimes100 = %d\n", x, y, parentZ, path_index,
-                   cellInfo[x][y][parentZ].congestion[path_index].pathTraversalsTimes100);
+                   cellCongestion(&(cellInfo[x][y][parentZ]))[path_index].pathTraversalsTimes100);
             printf("DEBUG:    congestionMultiplier = %.7f\n", mapInfo->congestionMultiplier);
             printf("DEBUG:    detour_distance[%d][%d][%d][%d] = %6.3f\n", parent_DR_num, routing_subset_shapeType, parent_DR_num,
                    congestion_subset_shapeType, user_inputs->detour_distance[parent_DR_num][routing_subset_shapeType][parent_DR_num][congestion_subset_shapeType]);
@@ -2278,12 +2787,12 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
     // Check whether the congestion should be considered. Congestion should be considered if:
     //  (a) recognizeSelfCongestion is TRUE or the congestion is not from 'path', AND
     //  (b) excludeCongestion is FALSE, OR the congestion is not from 'excludePathNum':
-    int congestion_pathNum = cellInfo[x][y][targetZ].congestion[path_index].pathNum;
+    int congestion_pathNum = cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].pathNum;
     #ifdef DEBUG_calc_via_congestion
     if (DEBUG_ON)  {
       printf("DEBUG:   %3d: Target cell (%d,%d,%d) contains congestion from path=%d, subset=%d, shapeType=%d, pathTraversalsTimes100=%'d.\n",
-             path_index, x, y, targetZ, congestion_pathNum, cellInfo[x][y][targetZ].congestion[path_index].DR_subset,
-             cellInfo[x][y][targetZ].congestion[path_index].shapeType, cellInfo[x][y][targetZ].congestion[path_index].pathTraversalsTimes100);
+             path_index, x, y, targetZ, congestion_pathNum, cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].DR_subset,
+             cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].shapeType, cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].pathTraversalsTimes100);
     }
     #endif
     if (   (recognizeSelfCongestion || (congestion_pathNum != path))           // Item (a) above
@@ -2291,8 +2800,8 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
     {
 
       // Check whether the congestion has the same shape-type and design-rule subset as the target:
-      int congestion_DR_subset = cellInfo[x][y][targetZ].congestion[path_index].DR_subset;
-      int congestion_shapeType = cellInfo[x][y][targetZ].congestion[path_index].shapeType;
+      int congestion_DR_subset = cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].DR_subset;
+      int congestion_shapeType = cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].shapeType;
 
       #ifdef DEBUG_calc_via_congestion
       if (DEBUG_ON)  {
@@ -2341,7 +2850,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
             // 'pathNum' is a diff-pair path, and the 'congestion_pathNum' is its diff-pair
             // partner, so add more congestion from the foreign path (by a factor of VIA_CONGESTION_FACTOR):
             added_congestion = DIFF_PAIR_PARTNER_VIA_CONGESTION_FACTOR
-                                    * (int)(cellInfo[x][y][targetZ].congestion[path_index].pathTraversalsTimes100
+                                    * (int)(cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].pathTraversalsTimes100
                                     * mapInfo->viaCongestionMultiplier
                                     * user_inputs->detour_distance[target_DR_num][routing_subset_shapeType][target_DR_num][congestion_subset_shapeType]
                                     * (parent_via_cost_multiplier + target_via_cost_multiplier)/2);
@@ -2349,7 +2858,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
           else  {
             // 'pathNum' and 'congestion_pathNum' are not diff-pair partners, so add the
             // normal amount of congestion-related G-cost:
-            added_congestion = (int)(cellInfo[x][y][targetZ].congestion[path_index].pathTraversalsTimes100
+            added_congestion = (int)(cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].pathTraversalsTimes100
                                     * mapInfo->viaCongestionMultiplier
                                     * user_inputs->detour_distance[target_DR_num][routing_subset_shapeType][target_DR_num][congestion_subset_shapeType]
                                     * (parent_via_cost_multiplier + target_via_cost_multiplier)/2);
@@ -2365,7 +2874,7 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
             printf("DEBUG: In calc_via_congestion: Path index %d that traverses target cell (%d,%d,%d) is path number %d (subset %d, shapeType %d)\n",
                    path_index, x, y, targetZ, congestion_pathNum, congestion_DR_subset, congestion_shapeType);
             printf("DEBUG:    cellInfo[%d][%d][%d].congestion[%d].pathTraversalsTimes100 = %d\n", x, y, targetZ, path_index,
-                   cellInfo[x][y][targetZ].congestion[path_index].pathTraversalsTimes100);
+                   cellCongestion(&(cellInfo[x][y][targetZ]))[path_index].pathTraversalsTimes100);
             printf("DEBUG:    congestionMultiplier = %.7f\n", mapInfo->congestionMultiplier);
             printf("DEBUG:    detour_distance[%d][%d][%d][%d] = %6.3f\n", target_DR_num, routing_subset_shapeType, target_DR_num,
                    congestion_subset_shapeType, user_inputs->detour_distance[target_DR_num][routing_subset_shapeType][target_DR_num][congestion_subset_shapeType]);
@@ -2400,8 +2909,11 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
 //       traversed. Function accounts for whether the congestion is due
 //       to foreign paths of the same design-rule subset and shape-type.
 //       X/Y coordinates are relative to the parent cell. All cells are
-//       assumed to be on the same layer 'z'. Congestion is recognized
-//       consistent with the following table:
+//       assumed to be on the same layer 'z'. If 'congestionSummary' is not
+//       NULL, then the penalty of a corner cell is taken from its summary
+//       unless the summary contains congestion from a net in bit-mask
+//       'summaryExclusionMask'. Congestion is recognized consistent with
+//       the following table:
 //
 //==============================================================================================
 // congestion_path  |  Path = Normal Net       Path = Diff-pair Net    Path = Pseudo-Net
@@ -2427,7 +2939,8 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
                            const int x, const int y, const int criteria_X_delta, const int criteria_Y_delta,
                            const int corn1_X_delta,    const int corn1_Y_delta,
                            const int corn2_X_delta,    const int corn2_Y_delta,
-                           const int excludeCongestion, const int excludePathNum, const int recognizeSelfCongestion)  {
+                           const int excludeCongestion, const int excludePathNum, const int recognizeSelfCongestion,
+                           const CongestionSummary_t *congestionSummary, const unsigned int summaryExclusionMask)  {
 
   #ifdef DEBUG_calc_corner_congestion
   // DEBUG code follows:
@@ -2528,18 +3041,37 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
       int cell_1_cost_zone_multiplier = user_inputs->traceCostMultiplier[cellInfo[x1][y1][z].traceCostMultiplierIndex];
       int cell_2_cost_zone_multiplier = user_inputs->traceCostMultiplier[cellInfo[x2][y2][z].traceCostMultiplierIndex];
 
+      // If the congestion summary of a corner cell can be used, then take that cell's penalty
+      // from the summary and skip the scan of its traversing paths:
+      int scan_count1 = path_count1; // Number of traversing paths to scan at corner cell #1
+      int scan_count2 = path_count2; // Number of traversing paths to scan at corner cell #2
+      if (congestionSummary)  {
+        const CongestionSummary_t *summary1 = &(congestionSummary[(x1 * mapInfo->mapHeight + y1) * mapInfo->numLayers + z]);
+        const CongestionSummary_t *summary2 = &(congestionSummary[(x2 * mapInfo->mapHeight + y2) * mapInfo->numLayers + z]);
+        if (summary1->isValid && (! (summary1->pathBloomFilter & summaryExclusionMask)))  {
+          if (summary1->DR_subset == DR_subset_1)
+            penalty1 = summary1->cornerCongestion;
+          scan_count1 = 0;
+        }
+        if (summary2->isValid && (! (summary2->pathBloomFilter & summaryExclusionMask)))  {
+          if (summary2->DR_subset == DR_subset_2)
+            penalty2 = summary2->cornerCongestion;
+          scan_count2 = 0;
+        }
+      }  // End of if-block for congestionSummary being non-NULL
+
       // Iterate over the paths that traverse cell #1:
       #ifdef DEBUG_calc_corner_congestion
       if (DEBUG_ON)  {
         printf("\nDEBUG: (thread %2d) Iterating over traversing paths at corner-cell #1 at (%d,%d,%d):\n", omp_get_thread_num(), x1, y1, z);
       }
       #endif
-      for (path_index = 0; path_index < path_count1; path_index++)  {
+      for (path_index = 0; path_index < scan_count1; path_index++)  {
 
         // Check whether the congestion should be considered. Congestion should be considered if:
         //  (a) recognizeSelfCongestion is TRUE or the congestion is not from 'path', AND
         //  (b) excludeCongestion is FALSE, OR the congestion is not from 'excludePathNum':
-        int congestion_pathNum = cellInfo[x1][y1][z].congestion[path_index].pathNum;
+        int congestion_pathNum = cellCongestion(&(cellInfo[x1][y1][z]))[path_index].pathNum;
 
         #ifdef DEBUG_calc_corner_congestion
         if (DEBUG_ON)  {
@@ -2552,8 +3084,8 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
         {
 
           // Check whether the congestion has the same shape-type and design-rule subset as the target:
-          int congestion_DR_subset = cellInfo[x1][y1][z].congestion[path_index].DR_subset;
-          int congestion_shapeType = cellInfo[x1][y1][z].congestion[path_index].shapeType;
+          int congestion_DR_subset = cellCongestion(&(cellInfo[x1][y1][z]))[path_index].DR_subset;
+          int congestion_shapeType = cellCongestion(&(cellInfo[x1][y1][z]))[path_index].shapeType;
 
           #ifdef DEBUG_calc_corner_congestion
           if (DEBUG_ON)  {
@@ -2596,7 +3128,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
               #ifdef DEBUG_calc_corner_congestion
               if (DEBUG_ON)  {
                 printf("DEBUG: (thread %2d) *** Adding corner congestion from (%d,%d,%d)! pathTraversalsTimes100 = %d\n",
-                       omp_get_thread_num(), x1, y1, z, cellInfo[x1][y1][z].congestion[path_index].pathTraversalsTimes100);
+                       omp_get_thread_num(), x1, y1, z, cellCongestion(&(cellInfo[x1][y1][z]))[path_index].pathTraversalsTimes100);
               }
               #endif
 
@@ -2608,7 +3140,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
                 // 'path' is a diff-pair path, and the 'congestion_pathNum' is its diff-pair
                 // partner, so add more congestion from the foreign path (by a factor of DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR):
                 added_congestion = DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR
-                                   * (int)(cellInfo[x1][y1][z].congestion[path_index].pathTraversalsTimes100
+                                   * (int)(cellCongestion(&(cellInfo[x1][y1][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                    * mapInfo->traceCongestionMultiplier
 //                                 * mapInfo->viaCongestionMultiplier
@@ -2618,7 +3150,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
               else  {
                 // 'pathNum' and 'congestion_pathNum' are not diff-pair partners, so add the
                 // normal amount of congestion-related G-cost:
-                added_congestion = (int)(cellInfo[x1][y1][z].congestion[path_index].pathTraversalsTimes100
+                added_congestion = (int)(cellCongestion(&(cellInfo[x1][y1][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                    * mapInfo->traceCongestionMultiplier
 //                                 * mapInfo->viaCongestionMultiplier
@@ -2653,12 +3185,12 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
         printf("\nDEBUG: (thread %2d) Iterating over traversing paths at corner-cell #2 at (%d,%d,%d):\n", omp_get_thread_num(), x2, y2, z);
       }
       #endif
-      for (path_index = 0; path_index < path_count2; path_index++)  {
+      for (path_index = 0; path_index < scan_count2; path_index++)  {
 
         // Check whether the congestion should be considered. Congestion should be considered if:
         //  (a) recognizeSelfCongestion is TRUE or the congestion is not from 'path', AND
         //  (b) excludeCongestion is FALSE, OR the congestion is not from 'excludePathNum':
-        int congestion_pathNum = cellInfo[x2][y2][z].congestion[path_index].pathNum;
+        int congestion_pathNum = cellCongestion(&(cellInfo[x2][y2][z]))[path_index].pathNum;
 
         #ifdef DEBUG_calc_corner_congestion
         if (DEBUG_ON)  {
@@ -2671,8 +3203,8 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
         {
 
           // Check whether the congestion has the same shape-type and design-rule subset as the target:
-          int congestion_DR_subset = cellInfo[x2][y2][z].congestion[path_index].DR_subset;
-          int congestion_shapeType = cellInfo[x2][y2][z].congestion[path_index].shapeType;
+          int congestion_DR_subset = cellCongestion(&(cellInfo[x2][y2][z]))[path_index].DR_subset;
+          int congestion_shapeType = cellCongestion(&(cellInfo[x2][y2][z]))[path_index].shapeType;
 
           #ifdef DEBUG_calc_corner_congestion
           if (DEBUG_ON)  {
@@ -2715,7 +3247,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
               #ifdef DEBUG_calc_corner_congestion
               if (DEBUG_ON)  {
                 printf("DEBUG: (thread %2d) *** Adding corner congestion from (%d,%d,%d)! pathTraversalsTimes100 = %d\n",
-                       omp_get_thread_num(), x2, y2, z, cellInfo[x2][y2][z].congestion[path_index].pathTraversalsTimes100);
+                       omp_get_thread_num(), x2, y2, z, cellCongestion(&(cellInfo[x2][y2][z]))[path_index].pathTraversalsTimes100);
               }
               #endif
 
@@ -2727,7 +3259,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
                 // 'pathNum' is a diff-pair path, and the 'congestion_pathNum' is its diff-pair
                 // partner, so add more congestion from the foreign path (by a factor of DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR):
                 added_congestion = DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR
-                                   * (int)(cellInfo[x2][y2][z].congestion[path_index].pathTraversalsTimes100
+                                   * (int)(cellCongestion(&(cellInfo[x2][y2][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                    * mapInfo->traceCongestionMultiplier
 //                                 * mapInfo->viaCongestionMultiplier
@@ -2737,7 +3269,7 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
               else  {
                 // 'pathNum' and 'congestion_pathNum' are not diff-pair partners, so add the
                 // normal amount of congestion-related G-cost:
-                added_congestion = (int)(cellInfo[x2][y2][z].congestion[path_index].pathTraversalsTimes100
+                added_congestion = (int)(cellCongestion(&(cellInfo[x2][y2][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                    * mapInfo->traceCongestionMultiplier
 //                                 * mapInfo->viaCongestionMultiplier
@@ -2882,23 +3414,43 @@ long calc_congestion_penalty(const int x, const int y, const int z,
     }
   }  // End of block for error-checking
 
+  // Static routing attributes of the destination cell at (x,y,z):
+  const CellRoutingInfo_t targetRouting = getCellRoutingInfo(mapInfo, cellInfo, x, y, z);
+
   // If cell (x,y,z) is in a pin-swappable zone, then return zero congestion penalty:
-  if (cellInfo[x][y][z].swap_zone)
+  if (targetRouting.swap_zone)
     return(0);
 
   // Extract the design-rule subset number (0 to 15), which will be used for calculating
   // the congestion penalty:
-  const unsigned short target_DR_num    = cellInfo[x][y][z].designRuleSet; // Get the design rule # for destination cell at (x,y,z)
-  const unsigned short parent_DR_num    = cellInfo[parentX][parentY][parentZ].designRuleSet; // Get the design rule # for parent cell at (parentX,parentY,parentZ)
+  const unsigned short target_DR_num    = targetRouting.designRuleSet; // Get the design rule # for destination cell at (x,y,z)
+  const unsigned short parent_DR_num    = getCellRoutingInfo(mapInfo, cellInfo, parentX, parentY, parentZ).designRuleSet; // Get the design rule # for parent cell at (parentX,parentY,parentZ)
   const unsigned short target_DR_subset = user_inputs->designRuleSubsetMap[pathNum][target_DR_num]; // Get the DR subset number of destination cell
   const unsigned short parent_DR_subset = user_inputs->designRuleSubsetMap[pathNum][parent_DR_num]; // Get the DR subset number of parent cell
 
   // Determine the cost-zone multiplier for the target cell:
-  int target_cost_zone_multiplier = user_inputs->traceCostMultiplier[cellInfo[x][y][z].traceCostMultiplierIndex];
+  int target_cost_zone_multiplier = user_inputs->traceCostMultiplier[targetRouting.traceCostMultiplierIndex];
 
   int penalty = 0;  // Congestion penalty between parent and destination
   int path_index;  // Temporary variable for path index
 
+  // Determine whether the per-cell congestion summaries can be used instead of scanning the cells'
+  // congestion arrays. This is possible only for the TRACE congestion of non-pseudo nets. A cell
+  // whose summary might include congestion from the routed net (unless 'recognizeSelfCongestion' is
+  // TRUE), from 'excludePathNum', or from the net's diff-pair partner must still be scanned, because
+  // such congestion is either ignored or weighted differently:
+  const CongestionSummary_t *congestionSummary = NULL;
+  unsigned int summaryExclusionMask = 0;
+  if (mapInfo->congestionSummary && (shapeType == TRACE) && (! user_inputs->isPseudoNet[pathNum]))  {
+    congestionSummary = mapInfo->congestionSummary;
+    if (! recognizeSelfCongestion)
+      summaryExclusionMask |= 1U << (pathNum % 32);
+    if (excludeCongestion)
+      summaryExclusionMask |= 1U << (excludePathNum % 32);
+    if (user_inputs->isDiffPair[pathNum])
+      summaryExclusionMask |= 1U << (user_inputs->diffPairPartner[pathNum] % 32);
+  }
+
   // If (x,y,z) is directly above or below the parent cell (i.e., in z-direction),
   // then calculate the via-related congestion calculated using function
   // 'calc_via_congestion':
@@ -2936,14 +3488,23 @@ long calc_congestion_penalty(const int x, const int y, const int z,
     // Calculate the congestion penalty associated with the destination cell
     // at location (x,y,z), excluding any cells between the parent and destination.
 
-    // Determine how many paths traverse the destination cell:
-    const unsigned int dest_path_count = cellInfo[x][y][z].numTraversingPaths; // Path count associated with destination cell (x,y,z)
+    // Determine how many paths traverse the destination cell. If the cell's congestion summary
+    // can be used, then the penalty is taken from the summary and the cell is not scanned:
+    unsigned int dest_path_count = cellInfo[x][y][z].numTraversingPaths; // Path count associated with destination cell (x,y,z)
+    if (congestionSummary && dest_path_count)  {
+      const CongestionSummary_t *targetSummary = &(congestionSummary[(x * mapInfo->mapHeight + y) * mapInfo->numLayers + z]);
+      if (targetSummary->isValid && (! (targetSummary->pathBloomFilter & summaryExclusionMask)))  {
+        if (targetSummary->DR_subset == target_DR_subset)
+          penalty += targetSummary->traceCongestion;
+        dest_path_count = 0;
+      }
+    }
 
     // Check all paths that traverse destination cell:
     for (path_index = 0; path_index < dest_path_count; path_index++)  {
 
       // Get the path number of the congestion for the current path index:
-      int congestion_pathNum   = cellInfo[x][y][z].congestion[path_index].pathNum;
+      int congestion_pathNum   = cellCongestion(&(cellInfo[x][y][z]))[path_index].pathNum;
 
       #ifdef DEBUG_calc_congestion_penalty
       if (DEBUG_ON)  {
@@ -2959,8 +3520,8 @@ long calc_congestion_penalty(const int x, const int y, const int z,
       {
 
         // Check whether the congestion has the same shape-type and design-rule subset as the target:
-        int congestion_DR_subset = cellInfo[x][y][z].congestion[path_index].DR_subset;
-        int congestion_shapeType = cellInfo[x][y][z].congestion[path_index].shapeType;
+        int congestion_DR_subset = cellCongestion(&(cellInfo[x][y][z]))[path_index].DR_subset;
+        int congestion_shapeType = cellCongestion(&(cellInfo[x][y][z]))[path_index].shapeType;
 
         #ifdef DEBUG_calc_congestion_penalty
         if (DEBUG_ON)  {
@@ -3008,7 +3569,7 @@ long calc_congestion_penalty(const int x, const int y, const int z,
               // 'pathNum' is a diff-pair path, and the 'congestion_pathNum' is its diff-pair
               // partner, so add more congestion from the foreign path (by a factor of DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR):
               added_congestion += DIFF_PAIR_PARTNER_TRACE_CONGESTION_FACTOR
-                                          * (int)(cellInfo[x][y][z].congestion[path_index].pathTraversalsTimes100
+                                          * (int)(cellCongestion(&(cellInfo[x][y][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                           * mapInfo->traceCongestionMultiplier
 //                                        * mapInfo->viaCongestionMultiplier
@@ -3018,7 +3579,7 @@ long calc_congestion_penalty(const int x, const int y, const int z,
             else  {
               // 'pathNum' and 'congestion_pathNum' are not diff-pair partners, so add the
               // normal amount of congestion-related G-cost:
-              added_congestion += (int)(cellInfo[x][y][z].congestion[path_index].pathTraversalsTimes100
+              added_congestion += (int)(cellCongestion(&(cellInfo[x][y][z]))[path_index].pathTraversalsTimes100
 // The following line was commented out and replaced with the subsequent line as an experiment on 6/12/2024:
                                           * mapInfo->traceCongestionMultiplier
 //                                        * mapInfo->viaCongestionMultiplier
@@ -3035,7 +3596,7 @@ long calc_congestion_penalty(const int x, const int y, const int z,
             if (DEBUG_ON)  {
               printf("DEBUG: (thread %2d) In calc_congestion_penalty, cumulative congestion_penalty is %'lu.\n", omp_get_thread_num(), congestion_penalty);
               printf("DEBUG: (thread %2d)   cellInfo[%d][%d][%d].congestion[%d].pathTraversalsTimes100 = %d\n", omp_get_thread_num(), x, y, z,
-                     path_index, cellInfo[x][y][z].congestion[path_index].pathTraversalsTimes100);
+                     path_index, cellCongestion(&(cellInfo[x][y][z]))[path_index].pathTraversalsTimes100);
               printf("DEBUG: (thread %2d)   mapInfo->congestionMultiplier = %6.3f\n", omp_get_thread_num(), mapInfo->congestionMultiplier);
               printf("DEBUG: (thread %2d)   detour_distance[%d][%d][%d][%d] = %6.3f\n", omp_get_thread_num(), target_DR_num,
                      routing_subset_shapeType, target_DR_num, congestion_subset_shapeType,
@@ -3074,53 +3635,35 @@ long calc_congestion_penalty(const int x, const int y, const int z,
     //   |  |15|  |16|  |
     //  --------------------
 
-    // Cell #1 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -1, 2,   -1, 1,   0, 1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #2 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  1, 2,    0, 1,   1, 1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #3 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -2, 1,   -1, 1,  -1, 0,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #4 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -1, 1,   -1, 0,   0, 1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #6 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  1, 1,    0, 1,   1, 0,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #7 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  2, 1,    1, 1,   1, 0,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #10 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -2,-1,   -1, 0,  -1,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #11 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -1,-1,   -1, 0,   0,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #13 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  1,-1,    1, 0,   0,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #14 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  2,-1,    1, 0,   1,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
-
-    // Cell #15 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                 -1,-2,   -1,-1,   0,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
+    // Only one of the 12 cells above can be the child cell, so the two corner-cells between the
+    // parent and child are derived directly from (deltaX, deltaY). For a diagonal jump, the corner
+    // cells are (deltaX, 0) and (0, deltaY). For a knight's jump, they are the two cells adjacent
+    // to the middle of the jump:
+    const int deltaX = x - parentX;
+    const int deltaY = y - parentY;
+    if (deltaX && deltaY)  {
+      int corn1_X_delta, corn1_Y_delta, corn2_X_delta, corn2_Y_delta;
+      if (abs(deltaY) == 2)  {
+        // Cells #1, 2, 15, and 16 in diagram above:
+        corn1_X_delta = deltaX;      corn1_Y_delta = deltaY / 2;
+        corn2_X_delta = 0;           corn2_Y_delta = deltaY / 2;
+      }
+      else if (abs(deltaX) == 2)  {
+        // Cells #3, 7, 10, and 14 in diagram above:
+        corn1_X_delta = deltaX / 2;  corn1_Y_delta = deltaY;
+        corn2_X_delta = deltaX / 2;  corn2_Y_delta = 0;
+      }
+      else  {
+        // Cells #4, 6, 11, and 13 in diagram above:
+        corn1_X_delta = deltaX;      corn1_Y_delta = 0;
+        corn2_X_delta = 0;           corn2_Y_delta = deltaY;
+      }
 
-    // Cell #16 in diagram above:
-    penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
-                                                  1,-2,    0,-1,   1,-1,      excludeCongestion, excludePathNum, recognizeSelfCongestion);
+      penalty += calc_corner_congestion(pathNum, shapeType, cellInfo, user_inputs, mapInfo, parentX, parentY, parentZ, x, y,
+                                        deltaX, deltaY,   corn1_X_delta, corn1_Y_delta,   corn2_X_delta, corn2_Y_delta,
+                                        excludeCongestion, excludePathNum, recognizeSelfCongestion,
+                                        congestionSummary, summaryExclusionMask);
+    }  // End of if-block for child cell not being directly north, south, east, or west of parent cell
 
 
     #ifdef DEBUG_calc_congestion_penalty
@@ -3246,15 +3789,109 @@ void initializePathfinder(int numPaths, int *pathLengths, Coordinate_t *pathCoor
 }  // End of function 'initializePathfinder'
 
 
+//-----------------------------------------------------------------------------
+// Name: cellInfoNumColumns
+// Desc: Return the number of (x,y) locations for which the block of elements of
+//       a 3D cellInfo array must have room, given the memory layout in
+//       'mapInfo->cellInfoLayout'. With the TILED_LAYOUT, the map is padded to a
+//       whole number of tiles in each direction.
+//-----------------------------------------------------------------------------
+static size_t cellInfoNumColumns(const MapInfo_t *mapInfo)  {
+
+  if (mapInfo->cellInfoLayout == TILED_LAYOUT)  {
+    const size_t tileSize  = 1 << cellInfoTileBits;
+    const size_t numTilesX = (mapInfo->mapWidth  + tileSize - 1) >> cellInfoTileBits;
+    const size_t numTilesY = (mapInfo->mapHeight + tileSize - 1) >> cellInfoTileBits;
+    return(numTilesX * numTilesY * tileSize * tileSize);
+  }
+  else  {
+    return((size_t)mapInfo->mapWidth * mapInfo->mapHeight);
+  }
+
+}  // End of function 'cellInfoNumColumns'
+
+
+//-----------------------------------------------------------------------------
+// Name: cellInfoColumnIndex
+// Desc: Return the position of location (x,y) among the columns of the
+//       (numLayers + 1) elements in the block of elements of a 3D cellInfo
+//       array. With the Z_INNERMOST_LAYOUT, the columns are ordered by 'x' and
+//       then by 'y'. With the TILED_LAYOUT, the map is divided into square
+//       tiles of 2^cellInfoTileBits cells, which are ordered by their X- and
+//       then Y-coordinates, and the columns of each tile are adjacent in memory.
+//       Cells within a few cells of each other on a layer are then usually
+//       within a few kilobytes of each other, rather than a whole row apart.
+//-----------------------------------------------------------------------------
+static size_t cellInfoColumnIndex(const MapInfo_t *mapInfo, int x, int y)  {
+
+  if (mapInfo->cellInfoLayout == TILED_LAYOUT)  {
+    const size_t tileMask  = (1 << cellInfoTileBits) - 1;
+    const size_t numTilesY = (mapInfo->mapHeight + tileMask) >> cellInfoTileBits;
+    const size_t tile = (x >> cellInfoTileBits) * numTilesY + (y >> cellInfoTileBits);
+    return((tile << (2 * cellInfoTileBits)) + ((x & tileMask) << cellInfoTileBits) + (y & tileMask));
+  }
+  else  {
+    return((size_t)x * mapInfo->mapHeight + y);
+  }
+
+}  // End of function 'cellInfoColumnIndex'
+
+
+//-----------------------------------------------------------------------------
+// Name: linkCellInfoBlocks
+// Desc: Point each row and column of the 3D cellInfo array into the blocks
+//       'columns' and 'cells', so that the array can be addressed as
+//       cellInfo[x][y][z] for the dimensions and memory layout in 'mapInfo'.
+//       The dynamically allocated elements of each cell are initialized to NULL.
+//-----------------------------------------------------------------------------
+static void linkCellInfoBlocks(CellInfo_t ***cellInfo, CellInfo_t **columns, CellInfo_t *cells,
+                               const MapInfo_t *mapInfo)  {
+
+  const size_t numLayersPlusOne = mapInfo->numLayers + 1;
+
+  for (int i = 0; i < mapInfo->mapWidth; i++)  {
+    cellInfo[i] = &(columns[(size_t)i * mapInfo->mapHeight]);
+
+    for (int j = 0; j < mapInfo->mapHeight; j++ )  {
+      cellInfo[i][j] = &(cells[cellInfoColumnIndex(mapInfo, i, j) * numLayersPlusOne]);
+
+      // For each element in the 3rd dimension, initialize the handles of the
+      // 'congestion' and 'pathCenters' arrays to zero, and initialize
+      // elements 'numTraversingPaths' and 'numTraversingPathCenters' to zero.
+      for (int k = 0; k <= mapInfo->numLayers; k++)  {
+        cellInfo[i][j][k].congestionHandle  = 0;
+        cellInfo[i][j][k].pathCentersHandle = 0;
+        cellInfo[i][j][k].numTraversingPaths = 0;
+        cellInfo[i][j][k].numTraversingPathCenters = 0;
+        cellInfo[i][j][k].congestionIsShared   = FALSE;
+        cellInfo[i][j][k].pathCentersAreShared = FALSE;
+      }
+
+    }  // End of 'j' for-loop
+  }  // End of 'i' for-loop
+
+}  // End of function 'linkCellInfoBlocks'
+
+
 //-----------------------------------------------------------------------------
 // Name: allocateCellInfo
-// Desc: Allocates memory for the 3D cellInfo array.
+// Desc: Allocates memory for the 3D cellInfo array. The elements are
+//       allocated as one contiguous block, in which the (numLayers + 1)
+//       layers of each (x,y) location are adjacent. The (x,y) locations are
+//       arranged in the block according to 'mapInfo->cellInfoLayout'. The
+//       pointers for the X- and Y-dimensions are also allocated as single
+//       blocks, so that the array is addressed as cellInfo[x][y][z] using only
+//       3 calls to malloc(), regardless of the map's size.
 //-----------------------------------------------------------------------------
 CellInfo_t *** allocateCellInfo(MapInfo_t *mapInfo)  {
 
   // printf("DEBUG: About to allocate memory for 3D 'cellInfo' structure from (0,0,0) to (%d,%d,%d)\n",
   //        mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers);
 
+  const size_t numLayersPlusOne = mapInfo->numLayers + 1;
+  const size_t numColumns = (size_t)mapInfo->mapWidth * mapInfo->mapHeight;
+  const size_t numCellColumns = cellInfoNumColumns(mapInfo);
+
   // Dynamically allocate memory from large heap space for 3D 'cellInfo' array:
   CellInfo_t ***cellInfo = malloc(sizeof(CellInfo_t **) * mapInfo->mapWidth);
   if (cellInfo == 0) {
@@ -3264,41 +3901,29 @@ CellInfo_t *** allocateCellInfo(MapInfo_t *mapInfo)  {
     printf(    "       Please inform the software developer of this fatal error.\n\n");
     exit (1);
   }
-  // For each row in 'cellInfo' matrix, malloc space for its buckets
-  // and add it to the array of arrays:
-  for (int i = 0; i < mapInfo->mapWidth; i++)  {
-    cellInfo[i] = malloc(mapInfo->mapHeight * sizeof(CellInfo_t *));
-    if (cellInfo[i] == 0) {
-      printf("\n\nERROR: Failed to allocate memory for the Y-direction of a 'cellInfo' matrix\n");
-      printf(    "       with dimensions %d cells wide by %d cells high by %d routing layers. \n",
-              mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers);
-      printf(    "       Please inform the software developer of this fatal error.\n\n");
-      exit (1);
-    }
 
-    // For each cell in 2D 'cellInfo' matrix, malloc space for a 3rd dimension:
-    for (int j = 0; j < mapInfo->mapHeight; j++ )  {
-      cellInfo[i][j] = malloc((mapInfo->numLayers + 1) * sizeof(CellInfo_t));
-      if (cellInfo[i][j] == 0) {
-        printf("\n\nERROR: Failed to allocate memory for the Z-direction of a 'cellInfo' matrix\n");
-        printf(    "       with dimensions %d cells wide by %d cells high by %d routing layers. \n",
-                mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers);
-        printf(    "       Please inform the software developer of this fatal error.\n\n");
-        exit (1);
-      }
+  // Allocate one block for the Y-direction pointers of every row in 'cellInfo' matrix:
+  CellInfo_t **columns = malloc(sizeof(CellInfo_t *) * numColumns);
+  if (columns == 0) {
+    printf("\n\nERROR: Failed to allocate memory for the Y-direction of a 'cellInfo' matrix\n");
+    printf(    "       with dimensions %d cells wide by %d cells high by %d routing layers. \n",
+            mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers);
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit (1);
+  }
 
-      // For each element in the 3rd dimension, initialize the pointers for
-      // elements 'congestion' and 'pathCenters' to NULL, and initialize
-      // elements 'numTraversingPaths' and 'numTraversingPathCenters' to zero.
-      for (int k = 0; k <= mapInfo->numLayers; k++)  {
-        cellInfo[i][j][k].congestion  = NULL;
-        cellInfo[i][j][k].pathCenters = NULL;
-        cellInfo[i][j][k].numTraversingPaths = 0;
-        cellInfo[i][j][k].numTraversingPathCenters = 0;
-      }
+  // Allocate one block for all elements of the 'cellInfo' matrix:
+  CellInfo_t *cells = malloc(sizeof(CellInfo_t) * numCellColumns * numLayersPlusOne);
+  if (cells == 0) {
+    printf("\n\nERROR: Failed to allocate memory for the Z-direction of a 'cellInfo' matrix\n");
+    printf(    "       with dimensions %d cells wide by %d cells high by %d routing layers. \n",
+            mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers);
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit (1);
+  }
 
-    }  // End of 'j' for-loop
-  }  // End of 'i' for-loop
+  // Point each row and column of the 'cellInfo' matrix into the above blocks:
+  linkCellInfoBlocks(cellInfo, columns, cells, mapInfo);
 
   // Return the pointer to the calling function:
   return cellInfo;
@@ -3354,19 +3979,25 @@ void initializeCellInfo(CellInfo_t ***cellInfo, MapInfo_t *mapInfo)  {
         // free the 'congestion' array and reset the number of traversing
         // paths to zero:
         if (cellInfo[i][j][k].numTraversingPaths)  {
-          free(cellInfo[i][j][k].congestion);
-          cellInfo[i][j][k].congestion         = NULL;
+          if (! cellInfo[i][j][k].congestionIsShared)  {
+            freeCongestion(cellInfo[i][j][k].congestionHandle, cellInfo[i][j][k].numTraversingPaths);
+          }
+          cellInfo[i][j][k].congestionHandle   = 0;
           cellInfo[i][j][k].numTraversingPaths = 0;
         }
+        cellInfo[i][j][k].congestionIsShared = FALSE;
 
         // If the current (i,j,k) coordinate contains any traversing path-centers,
         // then free the 'pathCenters' array and reset the number of traversing
         // path-centers to zero:
         if (cellInfo[i][j][k].numTraversingPathCenters)  {
-          free(cellInfo[i][j][k].pathCenters);
-          cellInfo[i][j][k].pathCenters              = NULL;
+          if (! cellInfo[i][j][k].pathCentersAreShared)  {
+            freePathCenters(cellInfo[i][j][k].pathCentersHandle, cellInfo[i][j][k].numTraversingPathCenters);
+          }
+          cellInfo[i][j][k].pathCentersHandle        = 0;
           cellInfo[i][j][k].numTraversingPathCenters = 0;
         }
+        cellInfo[i][j][k].pathCentersAreShared = FALSE;
 
         // cellInfoSize++;
       }  // End of for-loop for index 'k'
@@ -3414,10 +4045,13 @@ void reInitializeCellInfo(const MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
         cellInfo[x][y][z].via_above_DRC_flag              = FALSE;
 
         if(cellInfo[x][y][z].numTraversingPathCenters)  {
-          free(cellInfo[x][y][z].pathCenters);
-          cellInfo[x][y][z].pathCenters = NULL; // Set pointer to NULL as a precaution
+          if (! cellInfo[x][y][z].pathCentersAreShared)  {
+            freePathCenters(cellInfo[x][y][z].pathCentersHandle, cellInfo[x][y][z].numTraversingPathCenters);
+          }
+          cellInfo[x][y][z].pathCentersHandle = 0; // Set handle to zero as a precaution
           cellInfo[x][y][z].numTraversingPathCenters = 0;
         }  // End of if-block
+        cellInfo[x][y][z].pathCentersAreShared = FALSE;
       }  // End of for-loop for index 'x'
     }  // End of for-loop for index 'y'
   }  // End of for-loop for index 'z'
@@ -3462,6 +4096,7 @@ void initializeRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapIn
     routability->lateral_path_lengths_mm[i]    = 0.0;
     routability->path_DRC_cells[i]             = 0;
     routability->randomize_congestion[i]       = FALSE;
+    routability->bidirectional_search[i]       = FALSE;
     routability->one_path_traversal[i]         = 0;
     routability->num_vias[i]                   = 0;
     routability->recent_path_DRC_fraction[i]   = 0.0;
@@ -3615,6 +4250,8 @@ void initializeRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapIn
       // elements; they are written by function findPath()!
       routability->path_elapsed_time[i]          = 0;
       routability->path_explored_cells[i]        = 0;
+      routability->path_search_min[i]            = (Coordinate_t){0};
+      routability->path_search_max[i]            = (Coordinate_t){0};
 
     }  // End of for-loop for index 'i' (0 to max_routed_nets)
 
@@ -3630,115 +4267,104 @@ void initializeRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapIn
 }  // End of function 'initializeRoutability'
 
 
+//-----------------------------------------------------------------------------
+// Name: setPathFindingWindow
+// Desc: Set the strides and offset of the 3D path-finding arrays so that they
+//       span only the cells from 'windowMin' to 'windowMax' (inclusive). The
+//       arrays keep their allocated size, but cells within a small window are
+//       stored in a compact block at the beginning of each array. Because the
+//       'whichList' array is stamped with the search-generation, no element
+//       needs to be cleared when the window changes between searches.
+//-----------------------------------------------------------------------------
+void setPathFindingWindow(PathFinding_t *pathFinding, Coordinate_t windowMin, Coordinate_t windowMax)  {
+
+  const size_t dimX = windowMax.X - windowMin.X + 1;
+  const size_t dimY = windowMax.Y - windowMin.Y + 1;
+  const size_t dimZ = windowMax.Z - windowMin.Z + 1;
+
+  if (pathFinding->layout == LAYER_MAJOR_LAYOUT)  {
+    pathFinding->strideY = 1;
+    pathFinding->strideX = dimY;
+    pathFinding->strideZ = dimX * dimY;
+  }
+  else  {
+    pathFinding->strideZ = 1;
+    pathFinding->strideY = dimZ;
+    pathFinding->strideX = dimY * dimZ;
+  }  // End of if/else-block for (layout == LAYER_MAJOR_LAYOUT)
+
+  pathFinding->windowOffset = windowMin.X * pathFinding->strideX  +  windowMin.Y * pathFinding->strideY
+                                +  windowMin.Z * pathFinding->strideZ;
+
+}  // End of function 'setPathFindingWindow'
+
+
 //-----------------------------------------------------------------------------
 // Name: allocatePathFindingArrays
 // Desc: Allocates memory for the large arrays used by the path-finding
-//       function, findPath().
+//       function, findPath(). Each 3D array is allocated as one contiguous
+//       block, with the memory layout specified by 'layout', which can be
+//       Z_INNERMOST_LAYOUT or LAYER_MAJOR_LAYOUT. The 'openListEngine'
+//       parameter (BINARY_HEAP_ENGINE or RADIX_HEAP_ENGINE) selects the data
+//       structure for the Open List. The radix heap needs neither the
+//       'sortNumber' nor the 'openList' array, so they are not allocated.
 //-----------------------------------------------------------------------------
-void allocatePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo)  {
+void allocatePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo, unsigned char layout,
+                               unsigned char openListEngine)  {
 
   // printf("DEBUG: Entered allocatePathFindingArrays in thread %d with pathFinding address = %p\n", omp_get_thread_num(), pathFinding);
 
-  int i, j;  // Indices for coordinates in 3D map
+  // Dimensions of the 3D arrays, which include one extra cell in each direction:
+  const size_t dimX = mapInfo->mapWidth  + 1;
+  const size_t dimY = mapInfo->mapHeight + 1;
+  const size_t dimZ = mapInfo->numLayers + 1;
+
+  //
+  // Define the strides between adjacent cells in each direction, based on the requested
+  // memory layout. With LAYER_MAJOR_LAYOUT, each routing layer is a contiguous (x,y)
+  // plane, with Y-values adjacent in memory. Otherwise, the layers of each (x,y)
+  // location are adjacent in memory, matching the layout of the 3D 'cellInfo' array.
+  // Initially, the arrays span the whole map:
+  //
+  pathFinding->layout   = layout;
+  pathFinding->numCells = dimX * dimY * dimZ;
+  Coordinate_t mapMin = {0, 0, 0, FALSE};
+  Coordinate_t mapMax = {mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers, FALSE};
+  setPathFindingWindow(pathFinding, mapMin, mapMax);
 
   //
   // Allocate memory for 3D matrices that span the length, width, and height/thickness
   // of the 3-dimensional map:
   //
-
-  // 1st dimension of 'whichList' array:
-  pathFinding->whichList    = malloc(sizeof(char **) * (mapInfo->mapWidth+1) );
+  pathFinding->whichList = malloc(sizeof(unsigned short) * pathFinding->numCells);
   if (pathFinding->whichList == 0) {
     printf("Error: Failed to allocate memory for 'whichList' matrix.\n");
     exit(1);
   }  // End of if-block
 
-  // 1st dimension of 'parentCoords' array:
-  pathFinding->parentCoords = malloc(sizeof(Coordinate_t **) * (mapInfo->mapWidth+1) );
-  if (pathFinding->parentCoords == 0) {
-    printf("Error: Failed to allocate memory for 'parentCoords' matrix.\n");
+  pathFinding->parentDirection = malloc(sizeof(unsigned char) * pathFinding->numCells);
+  if (pathFinding->parentDirection == 0) {
+    printf("Error: Failed to allocate memory for 'parentDirection' matrix.\n");
     exit(1);
   }  // End of if-block
 
-  // 1st dimension of 'Gcost' array:
-  pathFinding->Gcost = malloc(sizeof(unsigned long **) * (mapInfo->mapWidth+1) );
+  pathFinding->Gcost = malloc(sizeof(unsigned long) * pathFinding->numCells);
   if (pathFinding->Gcost == 0) {
     printf("Error: Failed to allocate memory for 'Gcost' matrix.\n");
     exit(1);
   }  // End of if-block
 
-  // 1st dimension of 'sortNumber' array:
-  pathFinding->sortNumber = malloc(sizeof(int **) * (mapInfo->mapWidth+1) );
-  if (pathFinding->sortNumber == 0) {
-    printf("Error: Failed to allocate memory for 'sortNumber' matrix.\n");
-    exit(1);
-  }  // End of if-block
-
-
-  // Iterate over the 1st dimension to allocate memory for 2nd dimension:
-  for (i = 0; i < (mapInfo->mapWidth+1) ; i++)  {
-
-    // 2nd dimension of 'whichList' array:
-    pathFinding->whichList[i] = malloc(sizeof(char *) * (mapInfo->mapHeight+1));
-    if (pathFinding->whichList[i] == 0) {
-      printf("Error: Failed to allocate memory for 'whichList' matrix.\n");
-      exit(1);
-    }  // End of if-block
-
-    // 2nd dimension of 'parentCoords' array:
-    pathFinding->parentCoords[i] = malloc(sizeof(Coordinate_t *) * (mapInfo->mapHeight+1));
-    if (pathFinding->parentCoords[i] == 0) {
-      printf("Error: Failed to allocate memory for 'parentCoords' matrix.\n");
-      exit(1);
-    }  // End of if-block
-
-    // 2nd dimension of 'Gcost' array:
-    pathFinding->Gcost[i] = malloc(sizeof(unsigned long *) * (mapInfo->mapHeight+1));
-    if (pathFinding->Gcost[i] == 0) {
-      printf("Error: Failed to allocate memory for 'Gcost' matrix.\n");
-      exit(1);
-    }  // End of if-block
-
-    // 2nd dimension of 'sortNumber' array:
-    pathFinding->sortNumber[i] = malloc(sizeof(int *) * (mapInfo->mapHeight+1));
-    if (pathFinding->sortNumber[i] == 0) {
+  pathFinding->openListEngine = openListEngine;
+  if (openListEngine == BINARY_HEAP_ENGINE)  {
+    pathFinding->sortNumber = malloc(sizeof(int) * pathFinding->numCells);
+    if (pathFinding->sortNumber == 0) {
       printf("Error: Failed to allocate memory for 'sortNumber' matrix.\n");
       exit(1);
     }  // End of if-block
-
-    // Iterate over the 2nd dimension to allocate memory for 3rd dimension:
-    for (j = 0; j < (mapInfo->mapHeight+1); j++)  {
-
-      // 3rd dimension of 'whichList' array:
-      pathFinding->whichList[i][j] = malloc(sizeof(char) * (mapInfo->numLayers+1) );
-      if (pathFinding->whichList[i][j] == 0)  {
-        printf("Error: Failed to allocate memory for 'whichList' matrix.\n");
-        exit(1);
-      }  // End of if-block
-
-      // 3rd dimension of 'parentCoords' array:
-      pathFinding->parentCoords[i][j] = malloc(sizeof(Coordinate_t) * (mapInfo->numLayers+1) );
-      if (pathFinding->parentCoords[i][j] == 0)  {
-        printf("Error: Failed to allocate memory for 'parentCoords' matrix.\n");
-        exit(1);
-      }  // End of if-block
-
-      // 3rd dimension of 'Gcost' array:
-      pathFinding->Gcost[i][j] = malloc(sizeof(unsigned long) * (mapInfo->numLayers+1) );
-      if (pathFinding->Gcost[i][j] == 0)  {
-        printf("Error: Failed to allocate memory for 'Gcost' matrix.\n");
-        exit(1);
-      }  // End of if-block
-
-      // 3rd dimension of 'sortNumber' array:
-      pathFinding->sortNumber[i][j] = malloc(sizeof(int) * (mapInfo->numLayers+1) );
-      if (pathFinding->sortNumber[i][j] == 0)  {
-        printf("Error: Failed to allocate memory for 'sortNumber' matrix.\n");
-        exit(1);
-      }  // End of if-block
-
-    }  // End of for-loop for index 'j'
-  }  // End of for-loop for index 'i'
+  }
+  else  {
+    pathFinding->sortNumber = NULL;
+  }  // End of if/else-block for (openListEngine == BINARY_HEAP_ENGINE)
 
   //
   // Now that we're done allocating memory for 3D arrays, allocate memory
@@ -3766,16 +4392,76 @@ void allocatePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo)
     exit(1);
   }
 
-  // Allocate memory for 'openList' array:
-  pathFinding->openList = malloc(sizeof(int) * (mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers + 2) );
-  if (pathFinding->openList == 0) {
-    printf("\n\nError: Failed to allocate memory for 'openList' array.\n\n");
-    exit(1);
+  if (openListEngine == BINARY_HEAP_ENGINE)  {
+    // Allocate memory for 'openList' array:
+    pathFinding->openList = malloc(sizeof(int) * (mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers + 2) );
+    if (pathFinding->openList == 0) {
+      printf("\n\nError: Failed to allocate memory for 'openList' array.\n\n");
+      exit(1);
+    }
   }
+  else  {
+    pathFinding->openList = NULL;
+  }  // End of if/else-block for (openListEngine == BINARY_HEAP_ENGINE)
+
+  // Start with empty radix-heap buckets. Memory for the buckets is allocated
+  // by findPath() as entries are added:
+  initializeRadixHeap(&(pathFinding->radixHeap));
+
+  // The arrays for the backward search tree are allocated only if findPath() runs
+  // a bidirectional search:
+  pathFinding->whichList_reverse       = NULL;
+  pathFinding->parentDirection_reverse = NULL;
+  pathFinding->Gcost_reverse           = NULL;
+  initializeRadixHeap(&(pathFinding->radixHeap_reverse));
+
+  // Idle threads are lent to bidirectional searches only while the calling function
+  // provides a counter of such threads:
+  pathFinding->spareSearchThreads = NULL;
+
+  // Set the search-generation to its maximum value so that the first call to
+  // initializePathFindingArrays() clears the newly allocated 'whichList' array:
+  pathFinding->searchGeneration = maxSearchGeneration;
 
 }  // End of function 'allocatePathFindingArrays'
 
 
+//-----------------------------------------------------------------------------
+// Name: allocateReversePathFindingArrays
+// Desc: Allocates memory for the 3D arrays of the backward search tree, which
+//       are used only by the bidirectional search in findPath(). The arrays
+//       have the same size and strides as the forward arrays. The
+//       'whichList_reverse' array is cleared to zero, which matches no
+//       search-generation. This function does nothing if the arrays were
+//       already allocated.
+//-----------------------------------------------------------------------------
+void allocateReversePathFindingArrays(PathFinding_t *pathFinding)  {
+
+  if (pathFinding->whichList_reverse != NULL)  {
+    return;
+  }
+
+  pathFinding->whichList_reverse = calloc(pathFinding->numCells, sizeof(unsigned short));
+  if (pathFinding->whichList_reverse == 0) {
+    printf("Error: Failed to allocate memory for 'whichList_reverse' matrix.\n");
+    exit(1);
+  }  // End of if-block
+
+  pathFinding->parentDirection_reverse = malloc(sizeof(unsigned char) * pathFinding->numCells);
+  if (pathFinding->parentDirection_reverse == 0) {
+    printf("Error: Failed to allocate memory for 'parentDirection_reverse' matrix.\n");
+    exit(1);
+  }  // End of if-block
+
+  pathFinding->Gcost_reverse = malloc(sizeof(unsigned long) * pathFinding->numCells);
+  if (pathFinding->Gcost_reverse == 0) {
+    printf("Error: Failed to allocate memory for 'Gcost_reverse' matrix.\n");
+    exit(1);
+  }  // End of if-block
+
+}  // End of function 'allocateReversePathFindingArrays'
+
+
 //-----------------------------------------------------------------------------
 // Name: endPathfinder
 // Desc: Free memory in the arrays that are used for storing path coordinates.
@@ -3796,36 +4482,51 @@ void endPathfinder(int numPaths, Coordinate_t *pathCoords[],
 
 
 //-----------------------------------------------------------------------------
-// Name: freeMemory_cellInfo
-// Desc: Free memory that was allocated dynamically in function
-//       'allocateCellInfo'.
+// Name: freeCellInfoContents
+// Desc: Free the 'congestion' and 'pathCenters' arrays that were allocated
+//       dynamically in each cell of the 3D cellInfo array, without freeing
+//       the array itself.
 //-----------------------------------------------------------------------------
-void freeMemory_cellInfo(MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
+void freeCellInfoContents(const MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
 
   // Free memory in 3-dimensional cellInfo array:
   for (int x = 0; x < mapInfo->mapWidth; x++)  {
 
-    // For each cell in 2D 'cellInfo' matrix, free space for the 3rd dimension:
     for (int y = 0; y < mapInfo->mapHeight; y++ )  {
 
       // For each cell in 3D 'CellInfo' matrix, free any structure elements that
       // were dynamically allocated:
       for (int z = 0; z <= mapInfo->numLayers; z++)  {
-        // if (cellInfo[x][y][z].congestion != NULL)  {
-        //   printf("DEBUG: Memory freed for cellInfo[%d][%d][%d].congestion at address %p\n", x, y, z, cellInfo[x][y][z].congestion);
-        // }
-        free(cellInfo[x][y][z].congestion);    cellInfo[x][y][z].congestion = NULL;
-        free(cellInfo[x][y][z].pathCenters);   cellInfo[x][y][z].pathCenters = NULL;
+        // Arrays that are shared with another map are owned by that map:
+        if (! cellInfo[x][y][z].congestionIsShared)  {
+          freeCongestion(cellInfo[x][y][z].congestionHandle, cellInfo[x][y][z].numTraversingPaths);
+        }
+        if (! cellInfo[x][y][z].pathCentersAreShared)  {
+          freePathCenters(cellInfo[x][y][z].pathCentersHandle, cellInfo[x][y][z].numTraversingPathCenters);
+        }
+        cellInfo[x][y][z].congestionHandle  = 0;   cellInfo[x][y][z].congestionIsShared   = FALSE;
+        cellInfo[x][y][z].pathCentersHandle = 0;   cellInfo[x][y][z].pathCentersAreShared = FALSE;
       }  // End of 'z' for-loop
-
-      free(cellInfo[x][y]);
-      cellInfo[x][y] = NULL;
     }  // End of 'y' for-loop
-
-    free(cellInfo[x]);
-    cellInfo[x] = NULL;
   }  // End of 'x' for-loop
 
+}  // End of function 'freeCellInfoContents'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeMemory_cellInfo
+// Desc: Free memory that was allocated dynamically in function
+//       'allocateCellInfo'.
+//-----------------------------------------------------------------------------
+void freeMemory_cellInfo(MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
+
+  // Free the memory of the elements in each cell:
+  freeCellInfoContents(mapInfo, cellInfo);
+
+  // Free the contiguous blocks of elements and Y-direction pointers, which begin at
+  // the first cell and the first column, respectively:
+  free(cellInfo[0][0]);
+  free(cellInfo[0]);
   free(cellInfo);
   cellInfo = NULL;
 
@@ -3839,25 +4540,11 @@ void freeMemory_cellInfo(MapInfo_t *mapInfo, CellInfo_t ***cellInfo)  {
 //-----------------------------------------------------------------------------
 void freePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo)  {
 
-  int i, j;  // Indices for coordinates in 3D map
-
   //
-  // Free memory for 3-dimensional arrays:
+  // Free memory for 3-dimensional arrays, each of which is a single block:
   //
-  for (i = 0; i < (mapInfo->mapWidth + 1); i++)  {
-    for (j = 0; j < (mapInfo->mapHeight + 1); j++ )  {
-      free(pathFinding->whichList[i][j]);         pathFinding->whichList[i][j]    = NULL;
-      free(pathFinding->parentCoords[i][j]);      pathFinding->parentCoords[i][j] = NULL;
-      free(pathFinding->Gcost[i][j]);             pathFinding->Gcost[i][j]        = NULL;
-      free(pathFinding->sortNumber[i][j]);        pathFinding->sortNumber[i][j]   = NULL;
-    }  // End of 'j' for-loop
-    free(pathFinding->whichList[i]);              pathFinding->whichList[i]       = NULL;
-    free(pathFinding->parentCoords[i]);           pathFinding->parentCoords[i]    = NULL;
-    free(pathFinding->Gcost[i]);                  pathFinding->Gcost[i]           = NULL;
-    free(pathFinding->sortNumber[i]);             pathFinding->sortNumber[i]      = NULL;
-  }  // End of 'i' for-loop
   free(pathFinding->whichList);                   pathFinding->whichList          = NULL;
-  free(pathFinding->parentCoords);                pathFinding->parentCoords       = NULL;
+  free(pathFinding->parentDirection);             pathFinding->parentDirection    = NULL;
   free(pathFinding->Gcost);                       pathFinding->Gcost              = NULL;
   free(pathFinding->sortNumber);                  pathFinding->sortNumber         = NULL;
 
@@ -3870,9 +4557,217 @@ void freePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo)  {
   free(pathFinding->Hcost);                       pathFinding->Hcost              = NULL;
   free(pathFinding->openList);                    pathFinding->openList           = NULL;
 
+  // Free memory for the buckets of the radix heap:
+  freeRadixHeap(&(pathFinding->radixHeap));
+
+  // Free memory for the backward search tree of the bidirectional search, if it
+  // was allocated:
+  free(pathFinding->whichList_reverse);           pathFinding->whichList_reverse       = NULL;
+  free(pathFinding->parentDirection_reverse);     pathFinding->parentDirection_reverse = NULL;
+  free(pathFinding->Gcost_reverse);               pathFinding->Gcost_reverse           = NULL;
+  freeRadixHeap(&(pathFinding->radixHeap_reverse));
+
 }  // End of function 'freePathFindingArrays'
 
 
+//-----------------------------------------------------------------------------
+// Name: initializeSubMapPool
+// Desc: Initialize an empty pool of sub-map memory. No memory is allocated
+//       until a sub-map is requested from the pool.
+//-----------------------------------------------------------------------------
+void initializeSubMapPool(SubMapPool_t *subMapPool)  {
+
+  for (int i = 0; i < 2; i++)  {
+    subMapPool->cellInfo[i]             = NULL;
+    subMapPool->cellInfoColumns[i]      = NULL;
+    subMapPool->cellInfoCells[i]        = NULL;
+    subMapPool->maxCellInfoWidth[i]     = 0;
+    subMapPool->maxCellInfoColumns[i]   = 0;
+    subMapPool->maxCellInfoCells[i]     = 0;
+    subMapPool->pathFindingAllocated[i] = FALSE;
+    subMapPool->maxOpenListItems[i]     = 0;
+  }  // End of for-loop for index 'i'
+
+}  // End of function 'initializeSubMapPool'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePooledCellInfo
+// Desc: Return a 3D cellInfo array with the dimensions of 'subMapInfo', using
+//       the memory of element 'index' of 'subMapPool'. The pool's memory is
+//       enlarged only if it is smaller than the requested array. As with
+//       allocateCellInfo(), the elements must be initialized before they're
+//       used. The array is returned to the pool with releasePooledCellInfo().
+//-----------------------------------------------------------------------------
+CellInfo_t *** allocatePooledCellInfo(SubMapPool_t *subMapPool, int index, const MapInfo_t *subMapInfo)  {
+
+  const size_t numColumns = (size_t)subMapInfo->mapWidth * subMapInfo->mapHeight;
+  const size_t numCells   = cellInfoNumColumns(subMapInfo) * (subMapInfo->numLayers + 1);
+
+  if (subMapInfo->mapWidth > subMapPool->maxCellInfoWidth[index])  {
+    free(subMapPool->cellInfo[index]);
+    subMapPool->cellInfo[index] = malloc(sizeof(CellInfo_t **) * subMapInfo->mapWidth);
+    if (subMapPool->cellInfo[index] == NULL)  {
+      printf("\n\nERROR: Failed to allocate memory for the X-direction of a pooled 'cellInfo' matrix with a width of %d cells.\n",
+             subMapInfo->mapWidth);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+    subMapPool->maxCellInfoWidth[index] = subMapInfo->mapWidth;
+  }  // End of if-block for enlarging the X-direction pointers
+
+  if (numColumns > subMapPool->maxCellInfoColumns[index])  {
+    free(subMapPool->cellInfoColumns[index]);
+    subMapPool->cellInfoColumns[index] = malloc(sizeof(CellInfo_t *) * numColumns);
+    if (subMapPool->cellInfoColumns[index] == NULL)  {
+      printf("\n\nERROR: Failed to allocate memory for the Y-direction of a pooled 'cellInfo' matrix with %lu columns.\n",
+             numColumns);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+    subMapPool->maxCellInfoColumns[index] = numColumns;
+  }  // End of if-block for enlarging the Y-direction pointers
+
+  if (numCells > subMapPool->maxCellInfoCells[index])  {
+    free(subMapPool->cellInfoCells[index]);
+    subMapPool->cellInfoCells[index] = malloc(sizeof(CellInfo_t) * numCells);
+    if (subMapPool->cellInfoCells[index] == NULL)  {
+      printf("\n\nERROR: Failed to allocate memory for the %lu elements of a pooled 'cellInfo' matrix.\n", numCells);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+    subMapPool->maxCellInfoCells[index] = numCells;
+  }  // End of if-block for enlarging the block of elements
+
+  linkCellInfoBlocks(subMapPool->cellInfo[index], subMapPool->cellInfoColumns[index],
+                     subMapPool->cellInfoCells[index], subMapInfo);
+
+  return(subMapPool->cellInfo[index]);
+
+}  // End of function 'allocatePooledCellInfo'
+
+
+//-----------------------------------------------------------------------------
+// Name: releasePooledCellInfo
+// Desc: Return to its pool a 3D cellInfo array that was obtained from function
+//       allocatePooledCellInfo(). The dynamically allocated elements of each
+//       cell are freed, but the array itself is kept by the pool.
+//-----------------------------------------------------------------------------
+void releasePooledCellInfo(const MapInfo_t *subMapInfo, CellInfo_t ***cellInfo)  {
+
+  freeCellInfoContents(subMapInfo, cellInfo);
+
+}  // End of function 'releasePooledCellInfo'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePooledPathFindingArrays
+// Desc: Return the path-finding arrays of element 'index' of 'subMapPool',
+//       prepared for routing in a map with the dimensions of 'subMapInfo'.
+//       The arrays are allocated with allocatePathFindingArrays() only if
+//       they don't yet exist or are too small for the map. Otherwise, they are
+//       re-used without being cleared, because findPath() relies on the
+//       search-generation stamps in the 'whichList' array.
+//-----------------------------------------------------------------------------
+PathFinding_t * allocatePooledPathFindingArrays(SubMapPool_t *subMapPool, int index, MapInfo_t *subMapInfo,
+                                                unsigned char layout, unsigned char openListEngine)  {
+
+  PathFinding_t *pathFinding = &(subMapPool->pathFinding[index]);
+
+  const size_t numCells = (size_t)(subMapInfo->mapWidth + 1) * (subMapInfo->mapHeight + 1) * (subMapInfo->numLayers + 1);
+  const size_t numOpenListItems = (size_t)subMapInfo->mapWidth * subMapInfo->mapHeight * subMapInfo->numLayers + 2;
+
+  if (   (! subMapPool->pathFindingAllocated[index])
+      || (numCells > pathFinding->numCells)
+      || (numOpenListItems > subMapPool->maxOpenListItems[index]))  {
+
+    if (subMapPool->pathFindingAllocated[index])  {
+      freePathFindingArrays(pathFinding, subMapInfo);
+    }
+    allocatePathFindingArrays(pathFinding, subMapInfo, layout, openListEngine);
+    subMapPool->pathFindingAllocated[index] = TRUE;
+    subMapPool->maxOpenListItems[index]     = numOpenListItems;
+  }
+  else  {
+    // The arrays are large enough, so span them over the new map:
+    Coordinate_t mapMin = {0, 0, 0, FALSE};
+    Coordinate_t mapMax = {subMapInfo->mapWidth, subMapInfo->mapHeight, subMapInfo->numLayers, FALSE};
+    setPathFindingWindow(pathFinding, mapMin, mapMax);
+  }  // End of if/else-block for allocating the path-finding arrays
+
+  return(pathFinding);
+
+}  // End of function 'allocatePooledPathFindingArrays'
+
+
+//-----------------------------------------------------------------------------
+// Name: getSubMapPoolMemory
+// Desc: Return the number of bytes allocated in the 'cellInfo' matrices and
+//       path-finding arrays of 'subMapPool', excluding the buckets of the
+//       radix heaps and the dynamically allocated elements of each cell.
+//-----------------------------------------------------------------------------
+size_t getSubMapPoolMemory(const SubMapPool_t *subMapPool)  {
+
+  size_t numBytes = 0;
+
+  for (int i = 0; i < 2; i++)  {
+    numBytes += subMapPool->maxCellInfoWidth[i]   * sizeof(CellInfo_t **)
+              + subMapPool->maxCellInfoColumns[i] * sizeof(CellInfo_t *)
+              + subMapPool->maxCellInfoCells[i]   * sizeof(CellInfo_t);
+
+    if (subMapPool->pathFindingAllocated[i])  {
+      const PathFinding_t *pathFinding = &(subMapPool->pathFinding[i]);
+
+      // Bytes per cell in the 3D arrays:
+      size_t bytesPerCell = sizeof(unsigned short) + sizeof(unsigned char) + sizeof(unsigned long);
+      if (pathFinding->sortNumber != NULL)  {
+        bytesPerCell += sizeof(int);
+      }
+      if (pathFinding->whichList_reverse != NULL)  {
+        bytesPerCell += sizeof(unsigned short) + sizeof(unsigned char) + sizeof(unsigned long);
+      }
+
+      // Bytes per item in the 1-dimensional arrays:
+      size_t bytesPerItem = sizeof(Coordinate_t) + 2 * sizeof(unsigned long);
+      if (pathFinding->openList != NULL)  {
+        bytesPerItem += sizeof(int);
+      }
+
+      numBytes += pathFinding->numCells * bytesPerCell  +  subMapPool->maxOpenListItems[i] * bytesPerItem;
+    }  // End of if-block for pathFindingAllocated
+  }  // End of for-loop for index 'i'
+
+  return(numBytes);
+
+}  // End of function 'getSubMapPoolMemory'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeSubMapPool
+// Desc: Free the memory that was allocated for a pool of sub-map memory by
+//       functions allocatePooledCellInfo() and
+//       allocatePooledPathFindingArrays().
+//-----------------------------------------------------------------------------
+void freeSubMapPool(SubMapPool_t *subMapPool)  {
+
+  for (int i = 0; i < 2; i++)  {
+    free(subMapPool->cellInfo[i]);         subMapPool->cellInfo[i]        = NULL;
+    free(subMapPool->cellInfoColumns[i]);  subMapPool->cellInfoColumns[i] = NULL;
+    free(subMapPool->cellInfoCells[i]);    subMapPool->cellInfoCells[i]   = NULL;
+    subMapPool->maxCellInfoWidth[i]   = 0;
+    subMapPool->maxCellInfoColumns[i] = 0;
+    subMapPool->maxCellInfoCells[i]   = 0;
+
+    if (subMapPool->pathFindingAllocated[i])  {
+      freePathFindingArrays(&(subMapPool->pathFinding[i]), NULL);
+      subMapPool->pathFindingAllocated[i] = FALSE;
+    }
+    subMapPool->maxOpenListItems[i] = 0;
+  }  // End of for-loop for index 'i'
+
+}  // End of function 'freeSubMapPool'
+
+
 //-----------------------------------------------------------------------------
 // Name: freeMemory_mapInfo
 // Desc: Free the memory that was allocated in function 'allocateMapInfo'.
@@ -11,6 +11,54 @@
 void createNoRoutingRestrictions(RoutingRestriction_t * routingRestrictions);
 
 
+//-----------------------------------------------------------------------------
+// Name: allocateCorridorRestrictions
+// Desc: Initialize variable 'corridorRestrictions' with no routing restrictions,
+//       and allocate its 'corridorMap' bitmap with one bit for each (x,y)
+//       location in the map. The bitmap is populated for each net by function
+//       createCorridorRestrictions().
+//-----------------------------------------------------------------------------
+void allocateCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const MapInfo_t *mapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: setCorridorBits
+// Desc: Set bits 'firstBit' through 'lastBit' (inclusive) in bitmap 'corridorMap'.
+//       Whole bytes are set with memset().
+//-----------------------------------------------------------------------------
+void setCorridorBits(unsigned char corridorMap[], size_t firstBit, size_t lastBit);
+
+
+//-----------------------------------------------------------------------------
+// Name: expandCorridorBox
+// Desc: Expand 'corridorBox' so that it contains the rectangle of (x,y) locations
+//       from (xMin, yMin) to (xMax, yMax).
+//-----------------------------------------------------------------------------
+void expandCorridorBox(CellBox_t *corridorBox, int xMin, int xMax, int yMin, int yMax);
+
+
+//-----------------------------------------------------------------------------
+// Name: createCorridorRestrictions
+// Desc: Populate 'corridorRestrictions', which must have been allocated with
+//       function allocateCorridorRestrictions(), so that findPath() can route
+//       only within 'radiusCells' cells of a net's previous (contiguous) path,
+//       'contigPathCoords', whose length is 'contigPathLength'. The corridor is
+//       a square band around each cell of the path, plus the start- and end-
+//       terminals. Routing is allowed on each layer that the previous path
+//       used, and on the layers immediately above and below these layers.
+//-----------------------------------------------------------------------------
+void createCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const Coordinate_t contigPathCoords[],
+                                int contigPathLength, Coordinate_t startCoord, Coordinate_t endCoord,
+                                int radiusCells, const MapInfo_t *mapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCorridorRestrictions
+// Desc: Free the memory allocated by function allocateCorridorRestrictions().
+//-----------------------------------------------------------------------------
+void freeCorridorRestrictions(RoutingRestriction_t *corridorRestrictions);
+
+
 //-----------------------------------------------------------------------------
 // Name: evaporateCongestion
 // Desc: At each cell in the cellInfo matrix, reduce the congestion value by
@@ -18,7 +66,7 @@ void createNoRoutingRestrictions(RoutingRestriction_t * routingRestrictions);
 //       of 'evaporationRate' could range from 0 to 100. The resulting 
 //       congestion is always rounded down, so it could reach zero. If the
 //       result is indeed zero congestion, then eliminate the traversing path
-//       from the cell.
+//       from the cell in the same pass. Cells without congestion are skipped.
 //
 //       Congestion from path-number N is not evaporated, where N is the
 //       path-number of the universal repellent. The value of N given by:
@@ -28,6 +76,78 @@ void evaporateCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
                          const float evaporationRate, int num_threads);
 
 
+//-----------------------------------------------------------------------------
+// Name: updateCongestionSummaries
+// Desc: For each cell in the map, summarize the TRACE congestion of non-pseudo
+//       nets in the flat array 'congestionSummary', which must contain
+//       (mapWidth x mapHeight x numLayers) elements. Each summary holds the
+//       penalties that calc_congestion_penalty() and calc_corner_congestion()
+//       would calculate for this congestion using the current values of
+//       'mapInfo->traceCongestionMultiplier' and the trace cost-multipliers,
+//       so the summaries must be rebuilt whenever these values or the
+//       congestion in the map change.
+//-----------------------------------------------------------------------------
+void updateCongestionSummaries(CongestionSummary_t *congestionSummary, const MapInfo_t *mapInfo,
+                               CellInfo_t ***cellInfo, const InputValues_t *user_inputs, int num_threads);
+
+
+//-----------------------------------------------------------------------------
+// Name: updateCellRoutingInfo
+// Desc: Copy the static routing attributes of each cell on the routing layers
+//       from the 'cellInfo' matrix into the flat array 'cellRoutingInfo', which
+//       must contain (mapWidth x mapHeight x numLayers) elements. The array
+//       must be rebuilt whenever the design-rule zones, cost zones, barriers or
+//       pin-swap zones in the 'cellInfo' matrix change.
+//-----------------------------------------------------------------------------
+void updateCellRoutingInfo(CellRoutingInfo_t *cellRoutingInfo, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateDirtyTiles
+// Desc: Allocate the per-tile arrays of 'dirtyTiles' for the map described by
+//       'mapInfo', and initialize the congestion of each tile to zero. The
+//       memory must later be freed by function freeDirtyTiles().
+//-----------------------------------------------------------------------------
+void allocateDirtyTiles(DirtyTiles_t *dirtyTiles, const MapInfo_t *mapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: updateDirtyTiles
+// Desc: Sum the congestion in each tile of 'dirtyTiles', weighting TRACE
+//       congestion by 'mapInfo->traceCongestionMultiplier' and via congestion
+//       by 'mapInfo->viaCongestionMultiplier'. A tile is flagged as dirty if
+//       this sum changed by more than 'tolerancePercent' percent of the larger
+//       of the new and previous sums since the previous call to this function.
+//       Because the sums include the congestion multipliers, changes of these
+//       multipliers also mark tiles as dirty.
+//-----------------------------------------------------------------------------
+void updateDirtyTiles(DirtyTiles_t *dirtyTiles, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                      const float tolerancePercent, int num_threads);
+
+
+//-----------------------------------------------------------------------------
+// Name: boxContainsDirtyTile
+// Desc: Return TRUE if any tile that overlaps the box between the coordinates
+//       'boxMin' and 'boxMax' (inclusive) is flagged as dirty in 'dirtyTiles'.
+//-----------------------------------------------------------------------------
+int boxContainsDirtyTile(const DirtyTiles_t *dirtyTiles, const Coordinate_t boxMin, const Coordinate_t boxMax);
+
+
+//-----------------------------------------------------------------------------
+// Name: pathTouchesDirtyTile
+// Desc: Return TRUE if any of the 'pathLength' cells in 'pathCoords' lies in a
+//       tile that is flagged as dirty in 'dirtyTiles'.
+//-----------------------------------------------------------------------------
+int pathTouchesDirtyTile(const DirtyTiles_t *dirtyTiles, const Coordinate_t pathCoords[], const int pathLength);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDirtyTiles
+// Desc: Free the memory allocated by function allocateDirtyTiles().
+//-----------------------------------------------------------------------------
+void freeDirtyTiles(DirtyTiles_t *dirtyTiles);
+
+
 //-----------------------------------------------------------------------------
 // Name: directionToText
 // Desc: Given a direction, routeDir, this function generates a text string
@@ -57,12 +177,62 @@ void addCongestion(CellInfo_t *cellInfo, int pathNum, unsigned short DR_subset,
 
 //-----------------------------------------------------------------------------
 // Name: initializePathFindingArrays
-// Desc: Initialize all elements in the various path-finding arrays to values
-//       appropriate for the beginning of function 'findPath()'.
+// Desc: Prepare the path-finding arrays for the beginning of function
+//       'findPath()' by advancing the search-generation. The 'whichList'
+//       array is fully cleared only when the generation number wraps.
 //-----------------------------------------------------------------------------
 void initializePathFindingArrays(PathFinding_t *pathFinding, const MapInfo_t *mapInfo);
 
 
+//-----------------------------------------------------------------------------
+// Name: initializeRadixHeap
+// Desc: Initialize a newly created radix heap with empty buckets that have no
+//       memory allocated to them.
+//-----------------------------------------------------------------------------
+void initializeRadixHeap(RadixHeap_t *heap);
+
+
+//-----------------------------------------------------------------------------
+// Name: emptyRadixHeap
+// Desc: Remove all entries from a radix heap without freeing the memory of its
+//       buckets, which is re-used by the next search.
+//-----------------------------------------------------------------------------
+void emptyRadixHeap(RadixHeap_t *heap);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeRadixHeap
+// Desc: Free the memory of the buckets in a radix heap.
+//-----------------------------------------------------------------------------
+void freeRadixHeap(RadixHeap_t *heap);
+
+
+//-----------------------------------------------------------------------------
+// Name: pushRadixHeap
+// Desc: Add a cell with F-cost 'Fcost' to a radix-heap Open List.
+//-----------------------------------------------------------------------------
+void pushRadixHeap(RadixHeap_t *heap, unsigned long Fcost, Coordinate_t coord);
+
+
+//-----------------------------------------------------------------------------
+// Name: peekRadixHeap
+// Desc: Return a pointer to the entry with the lowest F-cost in a radix-heap
+//       Open List, or NULL if the Open List is empty. Outdated entries for
+//       cells whose 'whichList' value is 'onClosedList' are discarded along
+//       the way.
+//-----------------------------------------------------------------------------
+const RadixHeapEntry_t * peekRadixHeap(RadixHeap_t *heap, const PathFinding_t *pathFinding,
+                                       const unsigned short whichList[], unsigned short onClosedList);
+
+
+//-----------------------------------------------------------------------------
+// Name: popRadixHeap
+// Desc: Remove the entry that was most recently returned by peekRadixHeap()
+//       from a radix-heap Open List.
+//-----------------------------------------------------------------------------
+void popRadixHeap(RadixHeap_t *heap);
+
+
 //-----------------------------------------------------------------------------
 // Name: calcMinimumAllowedDirection
 // Desc: Given two routing directions, routeDir_1 and routeDir_2, this function
@@ -97,6 +267,23 @@ int calcMinimumAllowedDirection(const int routeDir_1, const int routeDir_2);
 int allowedDirection(const int deltaX, const int deltaY, const int deltaZ, const int allowedDir);
 
 
+//-----------------------------------------------------------------------------
+// Name: calcAllowedTransitionMasks
+// Desc: Populate the 'minimumRoutingDirections' and 'allowedTransitionMask'
+//       look-up tables in 'pathFinding' for path 'pathNum'. For each pair of
+//       design-rule sets (parent cell, child cell), the tables hold the result
+//       of calcMinimumAllowedDirection() and a bitmask in which bit 'i' is set
+//       if allowedDirection() permits the transition (allowedDeltaX[i],
+//       allowedDeltaY[i], allowedDeltaZ[i]). The tables depend only on the
+//       path's design-rule subsets and the order of the transitions, so they
+//       are calculated once per call to findPath() instead of once per child
+//       cell.
+//-----------------------------------------------------------------------------
+void calcAllowedTransitionMasks(PathFinding_t *pathFinding, const int pathNum, const InputValues_t *user_inputs,
+                                const int num_transitions, const int allowedDeltaX[], const int allowedDeltaY[],
+                                const int allowedDeltaZ[]);
+
+
 //-----------------------------------------------------------------------------
 // Name: calc_heuristic
 // Desc: Calculate the heuristic function, H, which is an estimated cost between
@@ -125,24 +312,49 @@ unsigned long int calc_heuristic(const int currentX, const int currentY, const i
                                  CellInfo_t ***const  cellInfo);
 
 
+//-----------------------------------------------------------------------------
+// Name: allocateDRCPairSet
+// Desc: Allocate an empty set of design-rule violations with an initial hash
+//       table of 'numSlots' slots, which is rounded up to a power of 2. The
+//       table is enlarged as needed. The memory must later be freed with
+//       function freeDRCPairSet().
+//-----------------------------------------------------------------------------
+void allocateDRCPairSet(DRCPairSet_t *DRCs, int numSlots);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDRCPairSet
+// Desc: Free the memory allocated by function allocateDRCPairSet().
+//-----------------------------------------------------------------------------
+void freeDRCPairSet(DRCPairSet_t *DRCs);
+
+
+//-----------------------------------------------------------------------------
+// Name: clearDRCPairSet
+// Desc: Remove all design-rule violations from set 'DRCs'. Only the slots that
+//       were filled are emptied.
+//-----------------------------------------------------------------------------
+void clearDRCPairSet(DRCPairSet_t *DRCs);
+
+
 //-----------------------------------------------------------------------------
 // Name: record_DRC_by_paths
 // Desc: Record the design-rule violation between path number (path_1) and its
 //       shape-type (shapeType_1) and offending path number (path_2) and its
-//       shape-type (shapeType_2).
+//       shape-type (shapeType_2) in the set 'DRCs'.
 //-----------------------------------------------------------------------------
-void record_DRC_by_paths(int numPaths, char DRCs[], int path_1, int shapeType_1,
+void record_DRC_by_paths(int numPaths, DRCPairSet_t *DRCs, int path_1, int shapeType_1,
                          int path_2, int shapeType_2);
 
 
 //-----------------------------------------------------------------------------
 // Name: check_for_DRC
-// Desc: Read the 'DRCs[]' array to determine whether a design-rule violation
+// Desc: Read the set 'DRCs' to determine whether a design-rule violation
 //       has previously been recorded between path number (path_1) and its
 //       shape-type (shapeType_1), and offending path number (path_2) and its
 //       shape-type (shapeType_2).
 //-----------------------------------------------------------------------------
-unsigned char check_for_DRC(char DRCs[], unsigned int numPaths, int path_1, int shapeType_1,
+unsigned char check_for_DRC(const DRCPairSet_t *DRCs, unsigned int numPaths, int path_1, int shapeType_1,
                             int path_2, int shapeType_2);
 
 
@@ -275,8 +487,11 @@ int calc_via_congestion(const int path, const unsigned short target_DR_num, cons
 //       traversed. Function accounts for whether the congestion is due
 //       to foreign paths of the same design-rule subset and shape-type.
 //       X/Y coordinates are relative to the parent cell. All cells are
-//       assumed to be on the same layer 'z'. Congestion is recognized
-//       consistent with the following table:
+//       assumed to be on the same layer 'z'. If 'congestionSummary' is not
+//       NULL, then the penalty of a corner cell is taken from its summary
+//       unless the summary contains congestion from a net in bit-mask
+//       'summaryExclusionMask'. Congestion is recognized consistent with
+//       the following table:
 //
 //==============================================================================================
 // congestion_path  |  Path = Normal Net       Path = Diff-pair Net    Path = Pseudo-Net
@@ -295,7 +510,8 @@ int calc_corner_congestion(const int path, const unsigned short shapeType,
                            const int x, const int y, const int criteria_X_delta, const int criteria_Y_delta,
                            const int corn1_X_delta,    const int corn1_Y_delta,
                            const int corn2_X_delta,    const int corn2_Y_delta,
-                           const int excludeCongestion, const int excludePathNum, const int recognizeSelfCongestion);
+                           const int excludeCongestion, const int excludePathNum, const int recognizeSelfCongestion,
+                           const CongestionSummary_t *congestionSummary, const unsigned int summaryExclusionMask);
 
 
 //-----------------------------------------------------------------------------
@@ -345,7 +561,9 @@ void initializePathfinder(int numPaths, int *pathLengths, Coordinate_t *pathCoor
 
 //-----------------------------------------------------------------------------
 // Name: allocateCellInfo
-// Desc: Allocates memory for the 3D cellInfo array.
+// Desc: Allocates memory for the 3D cellInfo array. The elements are
+//       allocated as one contiguous block, in which the layers of each
+//       (x,y) location are adjacent.
 //-----------------------------------------------------------------------------
 CellInfo_t *** allocateCellInfo(MapInfo_t *mapInfo);
 
@@ -387,12 +605,34 @@ void initializeRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapIn
                            unsigned char initialize_ALL_elements);
 
 
+//-----------------------------------------------------------------------------
+// Name: setPathFindingWindow
+// Desc: Set the strides and offset of the 3D path-finding arrays so that they
+//       span only the cells from 'windowMin' to 'windowMax' (inclusive).
+//-----------------------------------------------------------------------------
+void setPathFindingWindow(PathFinding_t *pathFinding, Coordinate_t windowMin, Coordinate_t windowMax);
+
+
 //-----------------------------------------------------------------------------
 // Name: allocatePathFindingArrays
 // Desc: Allocates memory for the large arrays used by the path-finding
-//       function, findPath().
+//       function, findPath(). Each 3D array is allocated as one contiguous
+//       block, with the memory layout specified by 'layout', which can be
+//       Z_INNERMOST_LAYOUT or LAYER_MAJOR_LAYOUT. The 'openListEngine'
+//       parameter selects the data structure for the Open List, which can be
+//       BINARY_HEAP_ENGINE or RADIX_HEAP_ENGINE.
 //-----------------------------------------------------------------------------
-void allocatePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo);
+void allocatePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo, unsigned char layout,
+                               unsigned char openListEngine);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateReversePathFindingArrays
+// Desc: Allocates memory for the 3D arrays of the backward search tree, which
+//       are used only by the bidirectional search in findPath(). This function
+//       does nothing if the arrays were already allocated.
+//-----------------------------------------------------------------------------
+void allocateReversePathFindingArrays(PathFinding_t *pathFinding);
 
 
 //-----------------------------------------------------------------------------
@@ -413,6 +653,15 @@ void endPathfinder(int numPaths, Coordinate_t *pathCoords[],
 void freeMemory_cellInfo(MapInfo_t *mapInfo, CellInfo_t ***cellInfo);
 
 
+//-----------------------------------------------------------------------------
+// Name: freeCellInfoContents
+// Desc: Free the 'congestion' and 'pathCenters' arrays that were allocated
+//       dynamically in each cell of the 3D cellInfo array, without freeing
+//       the array itself.
+//-----------------------------------------------------------------------------
+void freeCellInfoContents(const MapInfo_t *mapInfo, CellInfo_t ***cellInfo);
+
+
 //-----------------------------------------------------------------------------
 // Name: freePathFindingArrays
 // Desc: Free memory that was allocated dynamically in function
@@ -421,6 +670,62 @@ void freeMemory_cellInfo(MapInfo_t *mapInfo, CellInfo_t ***cellInfo);
 void freePathFindingArrays(PathFinding_t *pathFinding, MapInfo_t *mapInfo);
 
 
+//-----------------------------------------------------------------------------
+// Name: initializeSubMapPool
+// Desc: Initialize an empty pool of sub-map memory. No memory is allocated
+//       until a sub-map is requested from the pool.
+//-----------------------------------------------------------------------------
+void initializeSubMapPool(SubMapPool_t *subMapPool);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePooledCellInfo
+// Desc: Return a 3D cellInfo array with the dimensions of 'subMapInfo', using
+//       the memory of element 'index' of 'subMapPool'. The pool's memory is
+//       enlarged only if it is smaller than the requested array. As with
+//       allocateCellInfo(), the elements must be initialized before they're
+//       used. The array is returned to the pool with releasePooledCellInfo().
+//-----------------------------------------------------------------------------
+CellInfo_t *** allocatePooledCellInfo(SubMapPool_t *subMapPool, int index, const MapInfo_t *subMapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: releasePooledCellInfo
+// Desc: Return to its pool a 3D cellInfo array that was obtained from function
+//       allocatePooledCellInfo(). The dynamically allocated elements of each
+//       cell are freed, but the array itself is kept by the pool.
+//-----------------------------------------------------------------------------
+void releasePooledCellInfo(const MapInfo_t *subMapInfo, CellInfo_t ***cellInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePooledPathFindingArrays
+// Desc: Return the path-finding arrays of element 'index' of 'subMapPool',
+//       prepared for routing in a map with the dimensions of 'subMapInfo'.
+//       The arrays are allocated only if they don't yet exist or are too
+//       small for the map.
+//-----------------------------------------------------------------------------
+PathFinding_t * allocatePooledPathFindingArrays(SubMapPool_t *subMapPool, int index, MapInfo_t *subMapInfo,
+                                                unsigned char layout, unsigned char openListEngine);
+
+
+//-----------------------------------------------------------------------------
+// Name: getSubMapPoolMemory
+// Desc: Return the number of bytes allocated in the 'cellInfo' matrices and
+//       path-finding arrays of 'subMapPool'.
+//-----------------------------------------------------------------------------
+size_t getSubMapPoolMemory(const SubMapPool_t *subMapPool);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeSubMapPool
+// Desc: Free the memory that was allocated for a pool of sub-map memory by
+//       functions allocatePooledCellInfo() and
+//       allocatePooledPathFindingArrays().
+//-----------------------------------------------------------------------------
+void freeSubMapPool(SubMapPool_t *subMapPool);
+
+
 //-----------------------------------------------------------------------------
 // Name: freeMemory_mapInfo
 // Desc: Free the memory that was allocated in function 'allocateMapInfo'.
@@ -5,6 +5,9 @@
 #include "parse.h"
 #include "prepareMap.h"
 #include "processDiffPairs.h"
+#include "globalRouting.h"
+#include "landmarks.h"
+#include "cellArraySlabs.h"
 
 
 
@@ -156,7 +159,7 @@ int main(int argc, char *argv[])  {
   for (int i = 0; i < num_simultaneous_pathFinding; i++)  {
     // Allocate memory for each element of the 'pathFinding' array. See definition of
     // structure 'PathFinding_t' structure for the contents/description.
-    allocatePathFindingArrays(&(pathFinding[i]), &mapInfo);
+    allocatePathFindingArrays(&(pathFinding[i]), &mapInfo, user_inputs.pathFindingLayout, user_inputs.openListEngine);
   }  // End of for-loop for index 'i' (0 to num_simultaneous_pathFinding-1)
   // printf("DEBUG: pathFinding arrays were initialized for up to %d simultaneous path-finding threads.\n", num_simultaneous_pathFinding);
 
@@ -164,6 +167,7 @@ int main(int argc, char *argv[])  {
   // 'cellInfo' is a 3D array of CellInfo_t objects (see header file for description).
   // Dynamically allocate space for 'cellInfo' matrix and initialize elements
   // to have no traversing paths and zero unwalkable cells:
+  mapInfo.cellInfoLayout = user_inputs.cellInfoLayout;
   CellInfo_t ***cellInfo = allocateCellInfo(&mapInfo);
   initializeCellInfo(cellInfo, &mapInfo);
 
@@ -231,8 +235,13 @@ int main(int argc, char *argv[])  {
   genericSubMapInfo.numPaths = mapInfo.numPaths;
   genericSubMapInfo.numPseudoPaths = mapInfo.numPseudoPaths;
   genericSubMapInfo.numLayers = mapInfo.numLayers;
+  genericSubMapInfo.cellInfoLayout = mapInfo.cellInfoLayout;
   genericSubMapInfo.max_iterations = subMap_maxIterations;
   genericSubMapInfo.current_iteration = 1;
+  genericSubMapInfo.congestionSummary = NULL;
+  genericSubMapInfo.landmarks = NULL;
+  genericSubMapInfo.cellRoutingInfo = NULL;
+  genericSubMapInfo.incrementalDRC = NULL;
   // If the user defined any diff-pair nets, then allocate memory and initialize the
   // variables necessary for routing the diff-pair nets to their terminals and vias:
   if (user_inputs.num_diff_pair_nets > 0)  {
@@ -242,6 +251,11 @@ int main(int argc, char *argv[])  {
     }  // End of for-loop for index 'wire_config' (0 to 1)
   }  // End of if-block for num_diff_pair_nets > 0
 
+  // The 'cellInfo' matrices and path-finding arrays of the diff-pair sub-maps are kept
+  // in 'subMapPool' from connection to connection and from iteration to iteration:
+  SubMapPool_t subMapPool;
+  initializeSubMapPool(&subMapPool);
+
 
   // Define the initial congestion sensitivities for trace and via congestion as
   // the 0th value in the 'congSensitivity' array. Later, this value might be
@@ -317,6 +331,38 @@ int main(int argc, char *argv[])  {
   // on routing.
   createNoRoutingRestrictions(&noRoutingRestrictions);
 
+  // If the user specified a 'reroute_corridor_radius', then create a 'corridorRestrictions'
+  // variable for each thread. Starting with the second iteration, each net is re-routed
+  // within a corridor around its path from the previous iteration. If the user specified
+  // a 'global_routing_tile_size', then the same variables hold the corridors around each
+  // net's global route:
+  const int corridorRadiusCells = (int)ceil(user_inputs.rerouteCorridorRadiusMicrons / user_inputs.cell_size_um);
+  RoutingRestriction_t corridorRestrictions[num_simultaneous_pathFinding];
+  for (int i = 0; i < num_simultaneous_pathFinding; i++)  {
+    if ((corridorRadiusCells > 0) || (user_inputs.globalRoutingTileSize > 0))  {
+      allocateCorridorRestrictions(&(corridorRestrictions[i]), &mapInfo);
+    }
+    else  {
+      createNoRoutingRestrictions(&(corridorRestrictions[i]));
+    }
+  }  // End of for-loop for index 'i' (0 to num_simultaneous_pathFinding-1)
+
+  // Create an array of per-cell congestion summaries. Before the path-finding of each
+  // iteration, these summaries are rebuilt from the congestion in the map so that
+  // findPath() can calculate most congestion penalties without scanning the congestion
+  // array of each cell. The summaries are attached to 'mapInfo' only while the congestion
+  // is unchanged, i.e., during the multi-threaded calls to findPath():
+  const long num_map_cells = (long)mapInfo.mapWidth * mapInfo.mapHeight * mapInfo.numLayers;
+  CongestionSummary_t *congestionSummary = malloc(num_map_cells * sizeof(CongestionSummary_t));
+  if (congestionSummary == 0)  {
+    printf("\nERROR: Unable to allocate %ld elements for array congestionSummary.\n\n", num_map_cells);
+    exit(1);
+  }
+  mapInfo.congestionSummary = NULL;
+  mapInfo.landmarks = NULL;
+  mapInfo.cellRoutingInfo = NULL;
+  mapInfo.incrementalDRC = NULL;
+
   //  Modify the 'cellInfo' 3D matrix based on the DR_zone statements in
   //  the 'user_inputs' data structure.
   tim = time(NULL); now = localtime(&tim);
@@ -370,6 +416,16 @@ int main(int argc, char *argv[])  {
   printf("Date-stamp after returning from defineProximityZones: %02d-%02d-%d, %02d:%02d:%02d *************************\n",
       now->tm_mon+1, now->tm_mday, now->tm_year+1900, now->tm_hour, now->tm_min, now->tm_sec);
 
+  // Copy the design-rule zones, cost zones, barriers and pin-swap zones, which don't change
+  // hereafter, into a compact array that findPath() reads instead of the 'cellInfo' matrix:
+  CellRoutingInfo_t *cellRoutingInfo = malloc(num_map_cells * sizeof(CellRoutingInfo_t));
+  if (cellRoutingInfo == 0)  {
+    printf("\nERROR: Unable to allocate %ld elements for array cellRoutingInfo.\n\n", num_map_cells);
+    exit(1);
+  }
+  updateCellRoutingInfo(cellRoutingInfo, &mapInfo, cellInfo);
+  mapInfo.cellRoutingInfo = cellRoutingInfo;
+
 
   // For each diff-pair, verify that the two starting terminals and two ending
   // terminals are on the same layer and within the same design-rule zone. Verify
@@ -442,6 +498,38 @@ int main(int argc, char *argv[])  {
   //
   FILE *fp_TOC = start_HTML_table_of_contents(input_filename, &user_inputs, &mapInfo, DRC_free_threshold, num_threads);
 
+  // If the user specified a 'global_routing_tile_size', then route all nets on a coarse
+  // grid of tiles. Thereafter, findPath() routes each net only within the tiles of its
+  // global route, unless a 'reroute_corridor_radius' corridor applies:
+  GlobalRouting_t globalRouting;
+  globalRouting.tileSize = user_inputs.globalRoutingTileSize;
+  if (globalRouting.tileSize > 0)  {
+    routeNetsGlobally(&globalRouting, &mapInfo, cellInfo, &user_inputs);
+  }
+
+  // If the user specified 'landmarks_per_layer', then calculate the distance fields of
+  // the landmarks from the cost zones, barriers and pin-swap zones, which don't change
+  // hereafter. The fields are shared by all threads in findPath() for the main map:
+  Landmarks_t landmarks;
+  if (user_inputs.landmarksPerLayer > 0)  {
+    createLandmarks(&landmarks, &mapInfo, cellInfo, &user_inputs);
+  }
+
+  // If the user specified 'reroute_congestion_tolerance', then allocate the tiles that
+  // record where the congestion changed between iterations. Nets whose path and explored
+  // cells lie only in unchanged tiles are not re-routed:
+  DirtyTiles_t dirtyTiles;
+  if (user_inputs.rerouteCongestionTolerance > 0)  {
+    allocateDirtyTiles(&dirtyTiles, &mapInfo);
+  }
+
+  // Allocate the design-rule-check results that calcRoutabilityMetrics() carries from
+  // one iteration to the next, so that it checks only the cells near nets whose paths
+  // changed since the previous iteration:
+  IncrementalDRC_t incrementalDRC;
+  allocateIncrementalDRC(&incrementalDRC, &mapInfo);
+  mapInfo.incrementalDRC = &incrementalDRC;
+
   // Initialize the 'sequence' array, which will determine the sequence of path-finding.
   // Path-finding is performed first on the path with the longest length, and then the
   // next shortest, etc.  This sequence optimizes the CPU utilization during 
@@ -515,6 +603,57 @@ int main(int argc, char *argv[])  {
       }  // End of if-block for current_iteration == 2
     }  // End of else-block for cost_multipliers_used == TRUE
 
+    // The landmarks' distance fields include the user-defined cost-multipliers, so they
+    // are not lower bounds while the base costs are used in the first iteration:
+    if ((user_inputs.landmarksPerLayer > 0) && ((! cost_multipliers_used) || (mapInfo.current_iteration >= 2)))  {
+      mapInfo.landmarks = &landmarks;
+    }
+
+    //
+    // If the user specified a 'bidirectional_threshold', then flag the paths that explored
+    // more than this number of cells in the previous iteration. The findPath() function will
+    // search for these paths from both of their terminals at the same time:
+    //
+    if (user_inputs.bidirectional_threshold && (mapInfo.current_iteration > 1))  {
+      int num_bidirectional_paths = 0;
+      for (int pathNum = 0; pathNum < max_routed_nets; pathNum++)  {
+        routability.bidirectional_search[pathNum] = (routability.path_explored_cells[pathNum] > user_inputs.bidirectional_threshold);
+        num_bidirectional_paths += routability.bidirectional_search[pathNum];
+      }
+      printf("INFO: %d paths will be found with a bidirectional search because they explored more than %'lu cells in the previous iteration.\n",
+             num_bidirectional_paths, user_inputs.bidirectional_threshold);
+    }  // End of if-block for bidirectional_threshold > 0
+
+    //
+    // Summarize the congestion in each cell, which remains unchanged while findPath() is
+    // called for each net below:
+    //
+    updateCongestionSummaries(congestionSummary, &mapInfo, cellInfo, &user_inputs, num_threads);
+    mapInfo.congestionSummary = congestionSummary;
+
+    // Flag the tiles whose congestion changed since the previous iteration:
+    if (user_inputs.rerouteCongestionTolerance > 0)  {
+      updateDirtyTiles(&dirtyTiles, &mapInfo, cellInfo, user_inputs.rerouteCongestionTolerance, num_threads);
+      printf("INFO: Congestion changed by more than %.1f%% in %d of %d tiles since the previous iteration.\n",
+             user_inputs.rerouteCongestionTolerance, dirtyTiles.numDirtyTiles, dirtyTiles.numTiles);
+    }
+
+    //
+    // If the user specified 'bidirectional_search_threads = 2', then threads that have no
+    // more nets to route are lent to the bidirectional searches that are still running, so
+    // that the last (and typically longest) searches of the iteration finish sooner. Variable
+    // 'spareSearchThreads' counts the idle threads, and 'numNetsStarted' tells each thread
+    // whether any nets remain:
+    //
+    int spareSearchThreads = 0;
+    int numNetsStarted = 0;
+    if (user_inputs.bidirectionalSearchThreads > 1)  {
+      spareSearchThreads = max(0, num_threads - max_routed_nets);
+      for (int i = 0; i < num_simultaneous_pathFinding; i++)  {
+        pathFinding[i].spareSearchThreads = &spareSearchThreads;
+      }
+    }
+
     //
     // For each start- and end-location, find the most efficient path:
     //
@@ -524,10 +663,36 @@ int main(int argc, char *argv[])  {
       int pathNum = sequence[pathFindingSequence];
       int thread_num = omp_get_thread_num();
 
+      #pragma omp atomic
+      numNetsStarted++;
+
       // Check if net is part of a diff-pair, in which case we don't run the path-finding algorithm:
       if (user_inputs.isDiffPair[pathNum])  {
         printf("INFO: Skipping diff-pair net #%d because it will be routed using pseudo net #%d.\n", pathNum, user_inputs.diffPairToPseudoNetMap[pathNum]);
       }
+      //
+      // If the user specified 'reroute_congestion_tolerance', then don't re-route a net without
+      // design-rule violations if the congestion did not change along its path, nor anywhere in
+      // the box of cells that was explored when the path was found. Re-routing such a net would
+      // return the same path. Pseudo-nets and nets in pin-swap zones are always re-routed because
+      // their paths are post-processed after path-finding:
+      //
+      else if (   (user_inputs.rerouteCongestionTolerance > 0)
+               && (mapInfo.current_iteration > 2)
+               && (! user_inputs.isPseudoNet[pathNum])
+               && (! mapInfo.swapZone[pathNum])
+               && (routability.path_DRC_cells[pathNum] == 0)
+               && (routability.randomize_congestion[pathNum] == 0)
+               && (pathLengths[pathNum] > 0)
+               && (pathCoords[pathNum][pathLengths[pathNum] - 1].X == mapInfo.end_cells[pathNum].X)
+               && (pathCoords[pathNum][pathLengths[pathNum] - 1].Y == mapInfo.end_cells[pathNum].Y)
+               && (pathCoords[pathNum][pathLengths[pathNum] - 1].Z == mapInfo.end_cells[pathNum].Z)
+               && (! pathTouchesDirtyTile(&dirtyTiles, pathCoords[pathNum], pathLengths[pathNum]))
+               && (! boxContainsDirtyTile(&dirtyTiles, routability.path_search_min[pathNum], routability.path_search_max[pathNum])))  {
+        printf("INFO: Skipping path %d (sequence %d) because the congestion near its path did not change.\n", pathNum, pathFindingSequence);
+        routability.path_explored_cells[pathNum] = 0;
+        routability.path_elapsed_time[pathNum] = 0;
+      }
       else  {
 
         // We got here, so net is not a diff-pair net. Prepare to run the path-finding algorithm:
@@ -547,12 +712,50 @@ int main(int argc, char *argv[])  {
         // printf("         Ending point: (%d, %d, %d)\n", mapInfo.end_X_cells[pathNum], mapInfo.end_Y_cells[pathNum], mapInfo.end_Z[pathNum]);
 
 
+        //
+        // If a corridor radius was specified, then restrict the routing of this net to a corridor
+        // around its path from the previous iteration:
+        //
+        RoutingRestriction_t *routingRestrictions = &noRoutingRestrictions;
+        if ((corridorRadiusCells > 0) && (mapInfo.current_iteration > 1) && (contiguousPathLengths[pathNum] > 0))  {
+          createCorridorRestrictions(&(corridorRestrictions[thread_num]), contigPathCoords[pathNum], contiguousPathLengths[pathNum],
+                                     mapInfo.start_cells[pathNum], mapInfo.end_cells[pathNum], corridorRadiusCells, &mapInfo);
+          routingRestrictions = &(corridorRestrictions[thread_num]);
+        }
+        //
+        // Otherwise, if global routing was performed, then restrict the routing of this net to
+        // the tiles of its global route:
+        //
+        else if (   (globalRouting.tileSize > 0)
+                 && createTileCorridorRestrictions(&(corridorRestrictions[thread_num]), &globalRouting, pathNum, &mapInfo))  {
+          routingRestrictions = &(corridorRestrictions[thread_num]);
+        }
+
+        //
+        // After the first iteration, the path from the previous iteration is passed to findPath(),
+        // which uses its cost as an upper bound and returns it again if no cheaper path exists:
+        //
+        Coordinate_t *previousPathCoords = NULL;
+        int previousPathLength = 0;
+        if (mapInfo.current_iteration > 1)  {
+          previousPathCoords = pathCoords[pathNum];
+          previousPathLength = pathLengths[pathNum];
+        }
+
         //
         // Enter the 'findPath' function to find best path for path number 'pathNum'
         //
         unsigned long pathCost = findPath(&mapInfo, cellInfo, pathNum, mapInfo.start_cells[pathNum], mapInfo.end_cells[pathNum],
                                           &(pathCoords[pathNum]), &(pathLengths[pathNum]), &user_inputs, &routability, &pathFinding[thread_num],
-                                          1, TRUE, FALSE, &noRoutingRestrictions, FALSE, FALSE);
+                                          1, TRUE, FALSE, routingRestrictions, FALSE, FALSE, previousPathCoords, previousPathLength);
+
+        // If no path was found within the corridor, then repeat the search without any restrictions:
+        if ((pathCost == 0) && (routingRestrictions != &noRoutingRestrictions))  {
+          printf("INFO: Repeating the search for path %d without the routing corridor.\n", pathNum);
+          pathCost = findPath(&mapInfo, cellInfo, pathNum, mapInfo.start_cells[pathNum], mapInfo.end_cells[pathNum],
+                              &(pathCoords[pathNum]), &(pathLengths[pathNum]), &user_inputs, &routability, &pathFinding[thread_num],
+                              1, TRUE, FALSE, &noRoutingRestrictions, FALSE, FALSE, previousPathCoords, previousPathLength);
+        }
 
         tim = time(NULL);
         now = localtime(&tim);
@@ -577,18 +780,38 @@ int main(int argc, char *argv[])  {
 
       }  // End of if/else-block for running the path-finding function for nets that aren't diff-pairs
 
+      // If every net has been started, then this thread will be idle for the rest of the
+      // iteration, so lend it to the bidirectional searches that are still running:
+      if (user_inputs.bidirectionalSearchThreads > 1)  {
+        int netsStarted;
+        #pragma omp atomic read
+        netsStarted = numNetsStarted;
+        if (netsStarted == max_routed_nets)  {
+          #pragma omp atomic
+          spareSearchThreads++;
+        }
+      }  // End of if-block for bidirectionalSearchThreads > 1
+
     }  // End of for-loop for variable 'pathFindingSequence'
     //
     // The previous line is the end of multi-threaded processing in this file.
     //
 
+    // Detach the congestion summaries from 'mapInfo' because the congestion will now change:
+    mapInfo.congestionSummary = NULL;
+
+    // Stop lending idle threads, because the counter is valid only within the loop above:
+    for (int i = 0; i < num_simultaneous_pathFinding; i++)  {
+      pathFinding[i].spareSearchThreads = NULL;
+    }
+
     printf("\nINFO: Completed findPath for all nets.\n\n");
 
     // If the map contains differential pairs, then create diff-pair nets using the pseudo-nets routed by the auto-router:
     if (user_inputs.num_pseudo_nets > 0)  {
       // printf("DEBUG: Before calling postProcessDiffPairs, omp_get_num_threads = %d\n", omp_get_num_threads());
       postProcessDiffPairs(pathCoords, pathLengths, &user_inputs, cellInfo, &mapInfo, &routability, pathFinding, subMapRoutability,
-                           &noRoutingRestrictions, num_threads);
+                           &subMapPool, &noRoutingRestrictions, num_threads);
     }
 
     // Based on the paths found from the 'findPath' function, generate corresponding
@@ -1226,8 +1449,18 @@ int main(int argc, char *argv[])  {
     }  // End of for-loop for index 'wire_config' (0 to 1)
   }  // End of if-block for num_diff_pair_nets > 0
 
-  // Free memory associated with the 'cellInfo' 3D array:
+  // Free the memory of the diff-pair sub-maps:
+  freeSubMapPool(&subMapPool);
+
+  // Free memory associated with the design-rule-check results that were carried
+  // between iterations:
+  mapInfo.incrementalDRC = NULL;
+  freeIncrementalDRC(&incrementalDRC, &mapInfo);
+
+  // Free memory associated with the 'cellInfo' 3D array, and then the
+  // slabs that held the cells' congestion arrays:
   freeMemory_cellInfo(&mapInfo, cellInfo);
+  freeCellArraySlabs();
 
   // Free memory used by 'pathCoords' and 'contigPathCoords' array of arrays:
   endPathfinder(max_routed_nets, pathCoords, contigPathCoords);
@@ -1240,7 +1473,31 @@ int main(int argc, char *argv[])  {
   // element for each thread:
   for (int i = 0; i < num_simultaneous_pathFinding; i++)  {
     freePathFindingArrays(&pathFinding[i], &mapInfo);
+    freeCorridorRestrictions(&(corridorRestrictions[i]));
   }  // End of for-loop for index 'i' (0 to num_simultaneous_pathFinding-1)
+
+  // Free memory associated with the per-cell congestion summaries:
+  free(congestionSummary);  congestionSummary = NULL;
+
+  // Free memory associated with the static routing attributes of each cell:
+  mapInfo.cellRoutingInfo = NULL;
+  free(cellRoutingInfo);  cellRoutingInfo = NULL;
+
+  // Free memory associated with the global routes:
+  if (globalRouting.tileSize > 0)  {
+    freeGlobalRouting(&globalRouting);
+  }
+
+  // Free memory associated with the landmarks' distance fields:
+  if (user_inputs.landmarksPerLayer > 0)  {
+    mapInfo.landmarks = NULL;
+    freeLandmarks(&landmarks);
+  }
+
+  // Free memory associated with the tiles that record changes of congestion:
+  if (user_inputs.rerouteCongestionTolerance > 0)  {
+    freeDirtyTiles(&dirtyTiles);
+  }
   // printf("DEBUG: pathFinding arrays were free'd for up to %d simultaneous path-finding threads.\n", num_simultaneous_pathFinding);
 
   // Free memory allocated within this 'main' program:
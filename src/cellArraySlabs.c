@@ -0,0 +1,439 @@
+#include "global_defs.h"
+#include "cellArraySlabs.h"
+
+
+//
+// Number of size-classes for the blocks of 4-byte units that hold the cells' arrays.
+// Size-classes 0 to 7 hold blocks of 1 to 8 units. Above 8 units, each power of two
+// is split into four size-classes (10, 12, 14, 16, 20, 24, 28, 32, 40, ... units), so
+// that no more than 20% of a block is unused. The largest class accommodates a
+// 'congestion' array with 'maxTraversingShapes' elements, and fills an entire slab:
+//
+#define numCellArraySizeClasses  48
+
+//
+// Number of 4-byte units in each element of the 'congestion' and 'pathCenters' arrays:
+//
+#define congestionUnits   (sizeof(Congestion_t) / 4)
+#define pathCentersUnits  (sizeof(PathAndShapeInfo_t) / 4)
+
+//
+// Number of free blocks that a thread moves to or from the shared free-lists at a time:
+//
+#define cellArrayBlockBatch      256
+
+
+//
+// Directory of all slabs, indexed by the upper bits of each handle. Element zero is
+// never allocated, so that handle zero denotes an empty array. The number of slabs
+// in the directory is modified only within the critical section 'cellArraySlabs':
+//
+char *cellArraySlabs[maxCellArraySlabs];
+static unsigned int numCellArraySlabs = 1;
+
+
+//
+// Each thread has its own free-lists and partially used slabs, so that no locking
+// is needed when arrays are allocated or freed. A block that is freed by a thread
+// joins that thread's free-list, even if it was carved by another thread. The first
+// unit of each free block holds the handle of the next free block in its free-list.
+// Because congestion is often freed by one thread (e.g., during evaporation) and
+// added by others, a thread moves batches of surplus free blocks to shared
+// free-lists, from which other threads take batches before they carve new slabs:
+//
+static _Thread_local CellArrayHandle_t freeBlocks[numCellArraySizeClasses];
+static _Thread_local unsigned int      numFreeBlocks[numCellArraySizeClasses];
+static _Thread_local CellArrayHandle_t slabCursor[numCellArraySizeClasses];
+static _Thread_local unsigned int      slabUnitsLeft[numCellArraySizeClasses];
+
+//
+// Shared free-lists, which are modified only within the critical section 'cellArraySlabs':
+//
+static CellArrayHandle_t sharedFreeBlocks[numCellArraySizeClasses];
+
+
+//-----------------------------------------------------------------------------
+// Name: nextFreeBlock
+// Desc: Return the address of the first unit of the free block with handle
+//       'handle', which holds the handle of the next free block.
+//-----------------------------------------------------------------------------
+static inline CellArrayHandle_t * nextFreeBlock(const CellArrayHandle_t handle)  {
+
+  return((CellArrayHandle_t *)cellArrayAddress(handle));
+
+}  // End of function 'nextFreeBlock'
+
+
+//-----------------------------------------------------------------------------
+// Name: getCellArraySizeClass
+// Desc: Return the size-class for a block with 'numUnits' 4-byte units, i.e.,
+//       the smallest size-class whose capacity is at least 'numUnits'.
+//-----------------------------------------------------------------------------
+static inline int getCellArraySizeClass(unsigned int numUnits)  {
+
+  if (numUnits <= 8)  {
+    return(numUnits ? numUnits - 1 : 0);
+  }
+
+  // Find the power of two, 2^p, that is less than 'numUnits' and at least half of it:
+  const int p = 31 - __builtin_clz(numUnits - 1);
+
+  // Find the quarter-step, q, above 2^p that accommodates 'numUnits':
+  const unsigned int quarter = 1u << (p - 2);
+  const int q = (numUnits - (1u << p) + quarter - 1) / quarter;
+
+  return(8 + (p - 3) * 4 + (q - 1));
+
+}  // End of function 'getCellArraySizeClass'
+
+
+//-----------------------------------------------------------------------------
+// Name: getCellArrayClassCapacity
+// Desc: Return the number of 4-byte units in the blocks of size-class 'sizeClass'.
+//-----------------------------------------------------------------------------
+static inline unsigned int getCellArrayClassCapacity(int sizeClass)  {
+
+  if (sizeClass < 8)  {
+    return(sizeClass + 1);
+  }
+
+  const int p = 3 + (sizeClass - 8) / 4;
+  const int q = 1 + (sizeClass - 8) % 4;
+
+  return((1u << p) + q * (1u << (p - 2)));
+
+}  // End of function 'getCellArrayClassCapacity'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateUnits
+// Desc: Return the handle of a new block with at least 'numUnits' 4-byte units,
+//       or zero if 'numUnits' is zero.
+//-----------------------------------------------------------------------------
+static CellArrayHandle_t allocateUnits(unsigned int numUnits)  {
+
+  if (numUnits == 0)  {
+    return(0);
+  }
+
+  const int          sizeClass  = getCellArraySizeClass(numUnits);
+  const unsigned int blockUnits = getCellArrayClassCapacity(sizeClass);
+
+  // If the thread's free-list is empty, then take a batch of blocks from the shared free-list:
+  if ((freeBlocks[sizeClass] == 0) && (sharedFreeBlocks[sizeClass] != 0))  {
+    #pragma omp critical (cellArraySlabs)
+    {
+      CellArrayHandle_t lastBlock = sharedFreeBlocks[sizeClass];
+      unsigned int numTaken = 0;
+      if (lastBlock != 0)  {
+        numTaken = 1;
+        while ((*nextFreeBlock(lastBlock) != 0) && (numTaken < cellArrayBlockBatch))  {
+          lastBlock = *nextFreeBlock(lastBlock);
+          numTaken++;
+        }
+        freeBlocks[sizeClass]       = sharedFreeBlocks[sizeClass];
+        sharedFreeBlocks[sizeClass] = *nextFreeBlock(lastBlock);
+        *nextFreeBlock(lastBlock)   = 0;
+      }
+      numFreeBlocks[sizeClass] = numTaken;
+    }
+  }  // End of if-block for taking blocks from the shared free-list
+
+  // Re-use a block from the free-list, if one is available:
+  if (freeBlocks[sizeClass] != 0)  {
+    const CellArrayHandle_t block = freeBlocks[sizeClass];
+    freeBlocks[sizeClass] = *nextFreeBlock(block);
+    numFreeBlocks[sizeClass]--;
+    return(block);
+  }
+
+  // Start a new slab if the current slab of this size-class has no room for another block.
+  // Any unused units at the end of the previous slab are abandoned:
+  if (slabUnitsLeft[sizeClass] < blockUnits)  {
+
+    char *slab = malloc(4 * cellArraySlabUnits);
+    if (slab == NULL)  {
+      printf("\n\nERROR: Failed to allocate %u bytes of memory for a slab of congestion and path-center arrays\n",
+             4 * cellArraySlabUnits);
+      printf(    "       in function 'allocateUnits'. Please inform the software developer of this fatal error message.\n\n");
+      exit(1);
+    }
+
+    unsigned int slabNum;
+    #pragma omp critical (cellArraySlabs)
+    {
+      slabNum = numCellArraySlabs;
+      if (slabNum < maxCellArraySlabs)  {
+        cellArraySlabs[slabNum] = slab;
+        numCellArraySlabs++;
+      }
+    }
+    if (slabNum >= maxCellArraySlabs)  {
+      printf("\n\nERROR: The maximum number of slabs (%u) for congestion and path-center arrays was exceeded in\n",
+             maxCellArraySlabs);
+      printf(    "       function 'allocateUnits'. Please inform the software developer of this fatal error message.\n\n");
+      exit(1);
+    }
+
+    slabCursor[sizeClass]    = slabNum << cellArraySlabUnitBits;
+    slabUnitsLeft[sizeClass] = cellArraySlabUnits;
+
+  }  // End of if-block for starting a new slab
+
+  // Carve the next block from the current slab:
+  const CellArrayHandle_t block = slabCursor[sizeClass];
+  slabCursor[sizeClass]    += blockUnits;
+  slabUnitsLeft[sizeClass] -= blockUnits;
+
+  return(block);
+
+}  // End of function 'allocateUnits'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeUnits
+// Desc: Return the block with handle 'handle' and 'numUnits' 4-byte units to
+//       the free-list of its size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+static void freeUnits(CellArrayHandle_t handle, unsigned int numUnits)  {
+
+  if (handle == 0)  {
+    return;
+  }
+
+  const int sizeClass = getCellArraySizeClass(numUnits);
+
+  *nextFreeBlock(handle) = freeBlocks[sizeClass];
+  freeBlocks[sizeClass]  = handle;
+  numFreeBlocks[sizeClass]++;
+
+  // If the thread holds two batches of free blocks, then move one batch to the shared free-list:
+  if (numFreeBlocks[sizeClass] >= 2 * cellArrayBlockBatch)  {
+    const CellArrayHandle_t firstBlock = freeBlocks[sizeClass];
+    CellArrayHandle_t       lastBlock  = firstBlock;
+    for (int i = 1; i < cellArrayBlockBatch; i++)  {
+      lastBlock = *nextFreeBlock(lastBlock);
+    }
+    freeBlocks[sizeClass]     = *nextFreeBlock(lastBlock);
+    numFreeBlocks[sizeClass] -= cellArrayBlockBatch;
+
+    #pragma omp critical (cellArraySlabs)
+    {
+      *nextFreeBlock(lastBlock)   = sharedFreeBlocks[sizeClass];
+      sharedFreeBlocks[sizeClass] = firstBlock;
+    }
+  }  // End of if-block for moving a batch of blocks to the shared free-list
+
+}  // End of function 'freeUnits'
+
+
+//-----------------------------------------------------------------------------
+// Name: resizeUnits
+// Desc: Resize the block with handle 'handle' from 'oldNumUnits' to 'newNumUnits'
+//       4-byte units, preserving the leading units, and return its handle. The
+//       block moves only if the new size belongs to a different size-class.
+//       Returns zero if 'newNumUnits' is zero.
+//-----------------------------------------------------------------------------
+static CellArrayHandle_t resizeUnits(CellArrayHandle_t handle, unsigned int oldNumUnits,
+                                     unsigned int newNumUnits)  {
+
+  if ((handle == 0) || (oldNumUnits == 0))  {
+    return(allocateUnits(newNumUnits));
+  }
+
+  if (newNumUnits == 0)  {
+    freeUnits(handle, oldNumUnits);
+    return(0);
+  }
+
+  // The block has room for the new number of units, and is not too large for them:
+  if (getCellArraySizeClass(newNumUnits) == getCellArraySizeClass(oldNumUnits))  {
+    return(handle);
+  }
+
+  const CellArrayHandle_t newHandle = allocateUnits(newNumUnits);
+  const unsigned int numCopied = (newNumUnits < oldNumUnits) ? newNumUnits : oldNumUnits;
+  memcpy(cellArrayAddress(newHandle), cellArrayAddress(handle), 4 * numCopied);
+  freeUnits(handle, oldNumUnits);
+
+  return(newHandle);
+
+}  // End of function 'resizeUnits'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateCongestion
+// Desc: Return the handle of a new 'congestion' array with 'numEntries'
+//       elements. The memory is a block from the smallest size-class whose
+//       capacity is at least 'numEntries'. Blocks are carved from slabs, and
+//       freed blocks are kept in free-lists of the calling thread, so the heap
+//       is used only when a new slab is needed. Returns zero if 'numEntries'
+//       is zero. The array must later be resized with resizeCongestion() or
+//       freed with freeCongestion(), always using its current number of
+//       elements.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocateCongestion(unsigned int numEntries)  {
+
+  if (numEntries > maxTraversingShapes)  {
+    printf("\n\nERROR: Function 'allocateCongestion' was asked for a congestion array with %d elements, which exceeds\n",
+           numEntries);
+    printf(    "       the maximum allowed value (%d). Please inform the software developer of this fatal error message.\n\n",
+           maxTraversingShapes);
+    exit(1);
+  }
+
+  return(allocateUnits(numEntries * congestionUnits));
+
+}  // End of function 'allocateCongestion'
+
+
+//-----------------------------------------------------------------------------
+// Name: resizeCongestion
+// Desc: Resize the 'congestion' array with handle 'handle' from 'oldNumEntries'
+//       to 'newNumEntries' elements, preserving the leading elements, and return
+//       its handle. The array moves only if the new size belongs to a different
+//       size-class. Returns zero if 'newNumEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t resizeCongestion(CellArrayHandle_t handle, unsigned int oldNumEntries,
+                                   unsigned int newNumEntries)  {
+
+  if (newNumEntries > maxTraversingShapes)  {
+    printf("\n\nERROR: Function 'resizeCongestion' was asked for a congestion array with %d elements, which exceeds\n",
+           newNumEntries);
+    printf(    "       the maximum allowed value (%d). Please inform the software developer of this fatal error message.\n\n",
+           maxTraversingShapes);
+    exit(1);
+  }
+
+  return(resizeUnits(handle, oldNumEntries * congestionUnits, newNumEntries * congestionUnits));
+
+}  // End of function 'resizeCongestion'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCongestion
+// Desc: Return the 'congestion' array with handle 'handle' and 'numEntries'
+//       elements to the free-list of its size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freeCongestion(CellArrayHandle_t handle, unsigned int numEntries)  {
+
+  freeUnits(handle, numEntries * congestionUnits);
+
+}  // End of function 'freeCongestion'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePathCenters
+// Desc: Return the handle of a new 'pathCenters' array with 'numEntries'
+//       elements, using the same slabs as allocateCongestion(). Returns zero
+//       if 'numEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocatePathCenters(unsigned int numEntries)  {
+
+  return(allocateUnits(numEntries * pathCentersUnits));
+
+}  // End of function 'allocatePathCenters'
+
+
+//-----------------------------------------------------------------------------
+// Name: resizePathCenters
+// Desc: Resize the 'pathCenters' array with handle 'handle' from 'oldNumEntries'
+//       to 'newNumEntries' elements, preserving the leading elements, and return
+//       its handle. Returns zero if 'newNumEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t resizePathCenters(CellArrayHandle_t handle, unsigned int oldNumEntries,
+                                    unsigned int newNumEntries)  {
+
+  return(resizeUnits(handle, oldNumEntries * pathCentersUnits, newNumEntries * pathCentersUnits));
+
+}  // End of function 'resizePathCenters'
+
+
+//-----------------------------------------------------------------------------
+// Name: freePathCenters
+// Desc: Return the 'pathCenters' array with handle 'handle' and 'numEntries'
+//       elements to the free-list of its size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freePathCenters(CellArrayHandle_t handle, unsigned int numEntries)  {
+
+  freeUnits(handle, numEntries * pathCentersUnits);
+
+}  // End of function 'freePathCenters'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateDRCRecords
+// Desc: Return the handle of a new array of 'numUnits' 4-byte units for the
+//       recorded design-rule-check results of a cell, using the same slabs as
+//       allocateCongestion(). 'numUnits' must not exceed 'cellArraySlabUnits'.
+//       Returns zero if 'numUnits' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocateDRCRecords(unsigned int numUnits)  {
+
+  return(allocateUnits(numUnits));
+
+}  // End of function 'allocateDRCRecords'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDRCRecords
+// Desc: Return the array of recorded design-rule-check results with handle
+//       'handle' and 'numUnits' 4-byte units to the free-list of its
+//       size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freeDRCRecords(CellArrayHandle_t handle, unsigned int numUnits)  {
+
+  freeUnits(handle, numUnits);
+
+}  // End of function 'freeDRCRecords'
+
+
+//-----------------------------------------------------------------------------
+// Name: getCellArraySlabMemory
+// Desc: Return the number of bytes in all slabs allocated for the cells'
+//       'congestion' and 'pathCenters' arrays.
+//-----------------------------------------------------------------------------
+size_t getCellArraySlabMemory(void)  {
+
+  size_t numBytes;
+
+  #pragma omp critical (cellArraySlabs)
+  {
+    numBytes = (size_t)(numCellArraySlabs - 1) * 4 * cellArraySlabUnits;
+  }
+
+  return(numBytes);
+
+}  // End of function 'getCellArraySlabMemory'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCellArraySlabs
+// Desc: Free the memory of all slabs. This function must be called only after
+//       all congestion and path-center arrays are no longer used, at the end
+//       of the program.
+//-----------------------------------------------------------------------------
+void freeCellArraySlabs(void)  {
+
+  #pragma omp critical (cellArraySlabs)
+  {
+    for (unsigned int slabNum = 1; slabNum < numCellArraySlabs; slabNum++)  {
+      free(cellArraySlabs[slabNum]);
+      cellArraySlabs[slabNum] = NULL;
+    }
+    numCellArraySlabs = 1;
+
+    for (int sizeClass = 0; sizeClass < numCellArraySizeClasses; sizeClass++)  {
+      sharedFreeBlocks[sizeClass] = 0;
+    }
+  }
+
+  // Forget the free-lists and slabs of the calling thread:
+  for (int sizeClass = 0; sizeClass < numCellArraySizeClasses; sizeClass++)  {
+    freeBlocks[sizeClass]    = 0;
+    numFreeBlocks[sizeClass] = 0;
+    slabCursor[sizeClass]    = 0;
+    slabUnitsLeft[sizeClass] = 0;
+  }
+
+}  // End of function 'freeCellArraySlabs'
@@ -0,0 +1,156 @@
+#ifndef CELLARRAYSLABS_H
+
+#define CELLARRAYSLABS_H
+
+
+//
+// The 'congestion' and 'pathCenters' arrays of each cell, and the cell's recorded
+// design-rule-check results, are stored in fixed-size slabs of 4-byte units. A cell refers to each array with a 32-bit handle instead
+// of an 8-byte pointer: the upper bits of the handle select a slab from the
+// directory 'cellArraySlabs', and the lower bits select the unit within the slab.
+// Handle zero is an empty array, because the directory's first slab is never
+// allocated. Arrays must be accessed only through the functions below, so that
+// the storage of these arrays can change without changing their users.
+//
+#define cellArraySlabUnitBits  13   // Number of bits in a handle for the unit within a slab
+#define cellArraySlabUnits     (1u << cellArraySlabUnitBits)      // 4-byte units per slab (32 KB)
+#define maxCellArraySlabs      (1u << (32 - cellArraySlabUnitBits)) // Slabs in the directory (16 GB)
+
+extern char *cellArraySlabs[maxCellArraySlabs];
+
+
+//-----------------------------------------------------------------------------
+// Name: cellArrayAddress
+// Desc: Return the address of the array with handle 'handle', or NULL if the
+//       handle is zero.
+//-----------------------------------------------------------------------------
+static inline void * cellArrayAddress(const CellArrayHandle_t handle)  {
+
+  return(cellArraySlabs[handle >> cellArraySlabUnitBits] + 4 * (handle & (cellArraySlabUnits - 1)));
+
+}  // End of function 'cellArrayAddress'
+
+
+//-----------------------------------------------------------------------------
+// Name: cellCongestion
+// Desc: Return the address of the 'congestion' array of cell 'cellInfo', which
+//       has 'numTraversingPaths' elements. Returns NULL if the cell has no
+//       congestion.
+//-----------------------------------------------------------------------------
+static inline Congestion_t * cellCongestion(const CellInfo_t *cellInfo)  {
+
+  return((Congestion_t *)cellArrayAddress(cellInfo->congestionHandle));
+
+}  // End of function 'cellCongestion'
+
+
+//-----------------------------------------------------------------------------
+// Name: cellPathCenters
+// Desc: Return the address of the 'pathCenters' array of cell 'cellInfo', which
+//       has 'numTraversingPathCenters' elements. Returns NULL if no path-center
+//       traverses the cell.
+//-----------------------------------------------------------------------------
+static inline PathAndShapeInfo_t * cellPathCenters(const CellInfo_t *cellInfo)  {
+
+  return((PathAndShapeInfo_t *)cellArrayAddress(cellInfo->pathCentersHandle));
+
+}  // End of function 'cellPathCenters'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateCongestion
+// Desc: Return the handle of a new 'congestion' array with 'numEntries'
+//       elements. The memory is a block from the smallest size-class whose
+//       capacity is at least 'numEntries'. Blocks are carved from slabs, and
+//       freed blocks are kept in free-lists of the calling thread, so the heap
+//       is used only when a new slab is needed. Returns zero if 'numEntries'
+//       is zero. The array must later be resized with resizeCongestion() or
+//       freed with freeCongestion(), always using its current number of
+//       elements.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocateCongestion(unsigned int numEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: resizeCongestion
+// Desc: Resize the 'congestion' array with handle 'handle' from 'oldNumEntries'
+//       to 'newNumEntries' elements, preserving the leading elements, and return
+//       its handle. The array moves only if the new size belongs to a different
+//       size-class. Returns zero if 'newNumEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t resizeCongestion(CellArrayHandle_t handle, unsigned int oldNumEntries,
+                                   unsigned int newNumEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCongestion
+// Desc: Return the 'congestion' array with handle 'handle' and 'numEntries'
+//       elements to the free-list of its size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freeCongestion(CellArrayHandle_t handle, unsigned int numEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocatePathCenters
+// Desc: Return the handle of a new 'pathCenters' array with 'numEntries'
+//       elements, using the same slabs as allocateCongestion(). Returns zero
+//       if 'numEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocatePathCenters(unsigned int numEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: resizePathCenters
+// Desc: Resize the 'pathCenters' array with handle 'handle' from 'oldNumEntries'
+//       to 'newNumEntries' elements, preserving the leading elements, and return
+//       its handle. Returns zero if 'newNumEntries' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t resizePathCenters(CellArrayHandle_t handle, unsigned int oldNumEntries,
+                                    unsigned int newNumEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: freePathCenters
+// Desc: Return the 'pathCenters' array with handle 'handle' and 'numEntries'
+//       elements to the free-list of its size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freePathCenters(CellArrayHandle_t handle, unsigned int numEntries);
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateDRCRecords
+// Desc: Return the handle of a new array of 'numUnits' 4-byte units for the
+//       recorded design-rule-check results of a cell, using the same slabs as
+//       allocateCongestion(). 'numUnits' must not exceed 'cellArraySlabUnits'.
+//       Returns zero if 'numUnits' is zero.
+//-----------------------------------------------------------------------------
+CellArrayHandle_t allocateDRCRecords(unsigned int numUnits);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDRCRecords
+// Desc: Return the array of recorded design-rule-check results with handle
+//       'handle' and 'numUnits' 4-byte units to the free-list of its
+//       size-class. Zero handles are ignored.
+//-----------------------------------------------------------------------------
+void freeDRCRecords(CellArrayHandle_t handle, unsigned int numUnits);
+
+
+//-----------------------------------------------------------------------------
+// Name: getCellArraySlabMemory
+// Desc: Return the number of bytes in all slabs allocated for the cells'
+//       'congestion' and 'pathCenters' arrays.
+//-----------------------------------------------------------------------------
+size_t getCellArraySlabMemory(void);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeCellArraySlabs
+// Desc: Free the memory of all slabs. This function must be called only after
+//       all congestion and path-center arrays are no longer used, at the end
+//       of the program.
+//-----------------------------------------------------------------------------
+void freeCellArraySlabs(void);
+
+
+#endif
@@ -1,6 +1,7 @@
 #include "global_defs.h"
 #include "design_rules_PNG_data.h"
 #include "layerColors.h"
+#include "cellArraySlabs.h"
 
 
 
@@ -444,15 +445,15 @@ static unsigned getAggregateCongestion(CellInfo_t *cellInfo, int shape_type)  {
     for (int path_index = 0; path_index < num_paths; path_index++)  {
 
       #ifdef SHOW_SELECTED_CONGESTION
-      if (   (   (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_1)
-              || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_2)
-              || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_3)
-              || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_4))
-          && (cellInfo->congestion[path_index].DR_subset == SHOW_SELECTED_DRsubset))  {
-        aggregate_congestion += cellInfo->congestion[path_index].pathTraversalsTimes100;
+      if (   (   (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_1)
+              || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_2)
+              || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_3)
+              || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_4))
+          && (cellCongestion(cellInfo)[path_index].DR_subset == SHOW_SELECTED_DRsubset))  {
+        aggregate_congestion += cellCongestion(cellInfo)[path_index].pathTraversalsTimes100;
       }
       #else
-      aggregate_congestion += cellInfo->congestion[path_index].pathTraversalsTimes100;
+      aggregate_congestion += cellCongestion(cellInfo)[path_index].pathTraversalsTimes100;
       #endif
 
       // printf("DEBUG: Aggregate congestion is %d after path_index %d.\n", aggregate_congestion, path_index);
@@ -461,18 +462,18 @@ static unsigned getAggregateCongestion(CellInfo_t *cellInfo, int shape_type)  {
 
   else  {  // Shape type is >=0, so select only congestion of type 'shape_type'
     for (int path_index = 0; path_index < num_paths; path_index++)  {
-      if (shape_type == cellInfo->congestion[path_index].shapeType)  {
+      if (shape_type == cellCongestion(cellInfo)[path_index].shapeType)  {
 
         #ifdef SHOW_SELECTED_CONGESTION
-        if (   (   (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_1)
-                || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_2)
-                || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_3)
-                || (cellInfo->congestion[path_index].pathNum == SHOW_SELECTED_PATH_4))
-            && (cellInfo->congestion[path_index].DR_subset == SHOW_SELECTED_DRsubset))  {
-          aggregate_congestion += cellInfo->congestion[path_index].pathTraversalsTimes100;
+        if (   (   (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_1)
+                || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_2)
+                || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_3)
+                || (cellCongestion(cellInfo)[path_index].pathNum == SHOW_SELECTED_PATH_4))
+            && (cellCongestion(cellInfo)[path_index].DR_subset == SHOW_SELECTED_DRsubset))  {
+          aggregate_congestion += cellCongestion(cellInfo)[path_index].pathTraversalsTimes100;
         }
         #else
-        aggregate_congestion += cellInfo->congestion[path_index].pathTraversalsTimes100;
+        aggregate_congestion += cellCongestion(cellInfo)[path_index].pathTraversalsTimes100;
         #endif
 
         // printf("DEBUG: Aggregate congestion is %d after path_index %d.\n", aggregate_congestion, path_index);
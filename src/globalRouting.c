@@ -0,0 +1,599 @@
+#include "global_defs.h"
+#include "aStarLibrary.h"
+#include "globalRouting.h"
+
+
+//
+// Define 'DEBUG_routeNetsGlobally' and re-compile if you want verbose
+// debugging print-statements enabled:
+//
+// #define DEBUG_routeNetsGlobally 1
+#undef DEBUG_routeNetsGlobally
+
+
+//-----------------------------------------------------------------------------
+// Name: tileIndex
+// Desc: Return the index of the tile that contains cell (x, y, z).
+//-----------------------------------------------------------------------------
+static int tileIndex(const GlobalRouting_t *globalRouting, int x, int y, int z)  {
+
+  return((z * globalRouting->numTilesY + y / globalRouting->tileSize) * globalRouting->numTilesX
+          + x / globalRouting->tileSize);
+
+}  // End of function 'tileIndex'
+
+
+//-----------------------------------------------------------------------------
+// Name: pushGlobalHeap
+// Desc: Add node 'node' with key 'key' to the binary min-heap defined by the
+//       arrays 'heapKey' and 'heapNode', which contain '*heapSize' elements.
+//-----------------------------------------------------------------------------
+static void pushGlobalHeap(double heapKey[], int heapNode[], int *heapSize, double key, int node)  {
+
+  int position = (*heapSize)++;
+  while (position > 0)  {
+    int parent = (position - 1) / 2;
+    if (heapKey[parent] <= key)  {
+      break;
+    }
+    heapKey[position]  = heapKey[parent];
+    heapNode[position] = heapNode[parent];
+    position = parent;
+  }  // End of while-loop for sifting the new node upward
+  heapKey[position]  = key;
+  heapNode[position] = node;
+
+}  // End of function 'pushGlobalHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: popGlobalHeap
+// Desc: Remove and return the node with the smallest key from the binary
+//       min-heap defined by the arrays 'heapKey' and 'heapNode'. The heap must
+//       not be empty.
+//-----------------------------------------------------------------------------
+static int popGlobalHeap(double heapKey[], int heapNode[], int *heapSize)  {
+
+  int topNode = heapNode[0];
+  (*heapSize)--;
+  double key = heapKey[*heapSize];
+  int node   = heapNode[*heapSize];
+
+  int position = 0;
+  while (1)  {
+    int child = 2 * position + 1;
+    if (child >= *heapSize)  {
+      break;
+    }
+    if ((child + 1 < *heapSize) && (heapKey[child + 1] < heapKey[child]))  {
+      child++;
+    }
+    if (key <= heapKey[child])  {
+      break;
+    }
+    heapKey[position]  = heapKey[child];
+    heapNode[position] = heapNode[child];
+    position = child;
+  }  // End of while-loop for sifting the last node downward
+  heapKey[position]  = key;
+  heapNode[position] = node;
+
+  return(topNode);
+
+}  // End of function 'popGlobalHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: updateEdgeUsage
+// Desc: Add (if 'sign' is +1) or subtract (if 'sign' is -1) the track-pitch of
+//       net 'pathNum' to/from the usage of each tile-edge crossed by the net's
+//       global route. Vias between tiles have no capacity limit and are ignored.
+//-----------------------------------------------------------------------------
+static void updateEdgeUsage(GlobalRouting_t *globalRouting, int pathNum, float sign, const InputValues_t *user_inputs)  {
+
+  for (int i = 1; i < globalRouting->numNetTiles[pathNum]; i++)  {
+    int tile_1 = min(globalRouting->netTiles[pathNum][i-1], globalRouting->netTiles[pathNum][i]);
+    int tile_2 = max(globalRouting->netTiles[pathNum][i-1], globalRouting->netTiles[pathNum][i]);
+
+    if (tile_2 == tile_1 + 1)  {
+      int DR_num = globalRouting->designRuleEast[tile_1];
+      globalRouting->usageEast[tile_1]
+          += sign * globalRouting->pitchCells[DR_num][user_inputs->designRuleSubsetMap[pathNum][DR_num]];
+    }
+    else if (tile_2 == tile_1 + globalRouting->numTilesX)  {
+      int DR_num = globalRouting->designRuleNorth[tile_1];
+      globalRouting->usageNorth[tile_1]
+          += sign * globalRouting->pitchCells[DR_num][user_inputs->designRuleSubsetMap[pathNum][DR_num]];
+    }
+  }  // End of for-loop for index 'i'
+
+}  // End of function 'updateEdgeUsage'
+
+
+//-----------------------------------------------------------------------------
+// Name: lateralEdgeCost
+// Desc: Return the cost for net 'pathNum' to cross the lateral edge with
+//       index 'edge' in the 'capacity', 'usage', 'history', and 'designRule'
+//       arrays, from 'fromTile' to 'toTile'. The base cost is the average of
+//       the two tiles' costs, multiplied by the tile size. It is increased by
+//       the edge's history cost, and by 'presentFactor' for each net-pitch by
+//       which this net would exceed the edge's capacity. Returns zero if the
+//       edge cannot be crossed.
+//-----------------------------------------------------------------------------
+static double lateralEdgeCost(const GlobalRouting_t *globalRouting, int pathNum, int fromTile, int toTile, int edge,
+                              const float capacity[], const float usage[], const float history[],
+                              const unsigned char designRule[], float presentFactor, const InputValues_t *user_inputs)  {
+
+  if ((globalRouting->lateralCost[toTile] == 0.0) || (capacity[edge] == 0.0))  {
+    return(0.0);
+  }
+
+  int DR_num = designRule[edge];
+  float netPitch = globalRouting->pitchCells[DR_num][user_inputs->designRuleSubsetMap[pathNum][DR_num]];
+  float excessPitches = max(0.0, usage[edge] + netPitch - capacity[edge]) / netPitch;
+
+  double baseCost = 0.5 * globalRouting->tileSize * (globalRouting->lateralCost[fromTile] + globalRouting->lateralCost[toTile]);
+
+  return(baseCost * (1.0 + history[edge]) * (1.0 + presentFactor * excessPitches));
+
+}  // End of function 'lateralEdgeCost'
+
+
+//-----------------------------------------------------------------------------
+// Name: routeOneNetGlobally
+// Desc: Use the A* algorithm to find the lowest-cost route for net 'pathNum'
+//       from tile 'startTile' to tile 'endTile', with the current edge usage
+//       and history costs. The route is stored in globalRouting->netTiles[pathNum],
+//       starting with 'startTile'. If no route exists, numNetTiles[pathNum] is
+//       set to zero. The arrays 'Gcost', 'parentTile', 'reachedStamp',
+//       'closedStamp', 'heapKey', and 'heapNode' are work-space, and 'stamp' must
+//       differ from any value previously stored in 'reachedStamp' or
+//       'closedStamp'.
+//-----------------------------------------------------------------------------
+static void routeOneNetGlobally(GlobalRouting_t *globalRouting, int pathNum, int startTile, int endTile,
+                                float presentFactor, double minLateralCost, double minViaCost, const InputValues_t *user_inputs,
+                                double Gcost[], int parentTile[], int reachedStamp[], int closedStamp[], int stamp,
+                                double heapKey[], int heapNode[])  {
+
+  const int tilesPerLayer = globalRouting->numTilesX * globalRouting->numTilesY;
+  const int endX = endTile % globalRouting->numTilesX;
+  const int endY = (endTile / globalRouting->numTilesX) % globalRouting->numTilesY;
+  const int endZ = endTile / tilesPerLayer;
+  const int startDX = startTile % globalRouting->numTilesX - endX;
+  const int startDY = (startTile / globalRouting->numTilesX) % globalRouting->numTilesY - endY;
+  const double lineLength = sqrt((double)startDX * startDX + (double)startDY * startDY) + 1.0;
+
+  int heapSize = 0;
+  Gcost[startTile]        = 0.0;
+  parentTile[startTile]   = startTile;
+  reachedStamp[startTile] = stamp;
+  pushGlobalHeap(heapKey, heapNode, &heapSize, 0.0, startTile);
+
+  int routeFound = FALSE;
+  while (heapSize > 0)  {
+    int tile = popGlobalHeap(heapKey, heapNode, &heapSize);
+    if (closedStamp[tile] == stamp)  {
+      continue;  // Outdated heap entry
+    }
+    closedStamp[tile] = stamp;
+    if (tile == endTile)  {
+      routeFound = TRUE;
+      break;
+    }
+
+    const int tileX = tile % globalRouting->numTilesX;
+    const int tileY = (tile / globalRouting->numTilesX) % globalRouting->numTilesY;
+    const int tileZ = tile / tilesPerLayer;
+
+    //
+    // Evaluate the 6 neighboring tiles: east, west, north, south, up, and down:
+    //
+    for (int direction = 0; direction < 6; direction++)  {
+      int neighbor;
+      double cost;
+      switch (direction)  {
+        case 0 :  // East
+          if (tileX + 1 >= globalRouting->numTilesX)  continue;
+          neighbor = tile + 1;
+          cost = lateralEdgeCost(globalRouting, pathNum, tile, neighbor, tile, globalRouting->capacityEast, globalRouting->usageEast,
+                                 globalRouting->historyEast, globalRouting->designRuleEast, presentFactor, user_inputs);
+          break;
+        case 1 :  // West
+          if (tileX == 0)  continue;
+          neighbor = tile - 1;
+          cost = lateralEdgeCost(globalRouting, pathNum, tile, neighbor, neighbor, globalRouting->capacityEast, globalRouting->usageEast,
+                                 globalRouting->historyEast, globalRouting->designRuleEast, presentFactor, user_inputs);
+          break;
+        case 2 :  // North
+          if (tileY + 1 >= globalRouting->numTilesY)  continue;
+          neighbor = tile + globalRouting->numTilesX;
+          cost = lateralEdgeCost(globalRouting, pathNum, tile, neighbor, tile, globalRouting->capacityNorth, globalRouting->usageNorth,
+                                 globalRouting->historyNorth, globalRouting->designRuleNorth, presentFactor, user_inputs);
+          break;
+        case 3 :  // South
+          if (tileY == 0)  continue;
+          neighbor = tile - globalRouting->numTilesX;
+          cost = lateralEdgeCost(globalRouting, pathNum, tile, neighbor, neighbor, globalRouting->capacityNorth, globalRouting->usageNorth,
+                                 globalRouting->historyNorth, globalRouting->designRuleNorth, presentFactor, user_inputs);
+          break;
+        case 4 :  // Up
+          if (tileZ + 1 >= globalRouting->numLayers)  continue;
+          neighbor = tile + tilesPerLayer;
+          cost = globalRouting->viaUpCost[tile];
+          break;
+        default :  // Down
+          if (tileZ == 0)  continue;
+          neighbor = tile - tilesPerLayer;
+          cost = globalRouting->viaUpCost[neighbor];
+          break;
+      }  // End of switch-block for 'direction'
+
+      // A cost of zero denotes a tile-edge that cannot be crossed:
+      if ((cost == 0.0) || (closedStamp[neighbor] == stamp))  {
+        continue;
+      }
+
+      double neighborGcost = Gcost[tile] + cost;
+      if ((reachedStamp[neighbor] != stamp) || (neighborGcost < Gcost[neighbor]))  {
+        reachedStamp[neighbor] = stamp;
+        Gcost[neighbor]        = neighborGcost;
+        parentTile[neighbor]   = tile;
+
+        // The heuristic uses the cheapest tile-crossing and via costs in the map. Many
+        // staircase routes have the same cost, so ties are broken in favor of tiles near
+        // the straight line between the terminals. Otherwise, L-shaped routes would
+        // produce corridors that exclude the shortest detailed path:
+        const int neighborX = neighbor % globalRouting->numTilesX;
+        const int neighborY = (neighbor / globalRouting->numTilesX) % globalRouting->numTilesY;
+        const int neighborZ = neighbor / tilesPerLayer;
+        double Hcost = minLateralCost * (abs(endX - neighborX) + abs(endY - neighborY)) + minViaCost * abs(endZ - neighborZ);
+        double distanceFromLine = abs((neighborX - endX) * startDY - (neighborY - endY) * startDX) / lineLength;
+        Hcost += 0.001 * minLateralCost * distanceFromLine;
+
+        pushGlobalHeap(heapKey, heapNode, &heapSize, neighborGcost + Hcost, neighbor);
+      }
+    }  // End of for-loop for index 'direction'
+  }  // End of while-loop for (heapSize > 0)
+
+  if (! routeFound)  {
+    globalRouting->numNetTiles[pathNum] = 0;
+    return;
+  }
+
+  // Count the tiles in the route, and then copy them from the start-tile to the end-tile:
+  int numTiles = 1;
+  for (int tile = endTile; tile != startTile; tile = parentTile[tile])  {
+    numTiles++;
+  }
+  globalRouting->netTiles[pathNum] = realloc(globalRouting->netTiles[pathNum], numTiles * sizeof(int));
+  if (globalRouting->netTiles[pathNum] == NULL)  {
+    printf("\n\nERROR: Failed to re-allocate memory for 'netTiles' array in function 'routeOneNetGlobally'.\n\n");
+    exit(1);
+  }
+  globalRouting->numNetTiles[pathNum] = numTiles;
+  int tile = endTile;
+  for (int i = numTiles - 1; i >= 0; i--)  {
+    globalRouting->netTiles[pathNum][i] = tile;
+    tile = parentTile[tile];
+  }
+
+}  // End of function 'routeOneNetGlobally'
+
+
+//-----------------------------------------------------------------------------
+// Name: routeNetsGlobally
+// Desc: Route each net on a coarse grid of tiles (G-cells) whose width and
+//       height are 'user_inputs->globalRoutingTileSize' cells. The capacity of
+//       the edge between two adjacent tiles is the number of pairs of walkable
+//       cells across the edge. Each net that crosses the edge consumes its
+//       track-pitch (trace width plus spacing) in the design-rule set at the
+//       edge. The cost of each tile is the average trace- or via-cost of its
+//       walkable cells, so cost zones are also respected. The nets are routed
+//       repeatedly with negotiated congestion, until no edge is over capacity
+//       or 'maxGlobalRoutingIterations' iterations have been performed. The
+//       results are stored in 'globalRouting', whose memory must later be freed
+//       by function freeGlobalRouting().
+//-----------------------------------------------------------------------------
+void routeNetsGlobally(GlobalRouting_t *globalRouting, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                       InputValues_t *user_inputs)  {
+
+  // Increase of an over-capacity edge's history cost, per excess track-pitch, after each iteration:
+  const float historyFactor = 0.5;
+
+  const int tileSize = user_inputs->globalRoutingTileSize;
+  globalRouting->tileSize  = tileSize;
+  globalRouting->numTilesX = (mapInfo->mapWidth  + tileSize - 1) / tileSize;
+  globalRouting->numTilesY = (mapInfo->mapHeight + tileSize - 1) / tileSize;
+  globalRouting->numLayers = mapInfo->numLayers;
+  globalRouting->numTiles  = globalRouting->numTilesX * globalRouting->numTilesY * globalRouting->numLayers;
+  globalRouting->numNets   = mapInfo->numPaths + mapInfo->numPseudoPaths;
+  const int numTiles = globalRouting->numTiles;
+
+  //
+  // Allocate memory for the per-tile and per-net arrays:
+  //
+  globalRouting->lateralCost     = calloc(numTiles, sizeof(double));
+  globalRouting->viaUpCost       = calloc(numTiles, sizeof(double));
+  globalRouting->capacityEast    = calloc(numTiles, sizeof(float));
+  globalRouting->capacityNorth   = calloc(numTiles, sizeof(float));
+  globalRouting->usageEast       = calloc(numTiles, sizeof(float));
+  globalRouting->usageNorth      = calloc(numTiles, sizeof(float));
+  globalRouting->historyEast     = calloc(numTiles, sizeof(float));
+  globalRouting->historyNorth    = calloc(numTiles, sizeof(float));
+  globalRouting->designRuleEast  = calloc(numTiles, sizeof(unsigned char));
+  globalRouting->designRuleNorth = calloc(numTiles, sizeof(unsigned char));
+  globalRouting->netTiles        = calloc(globalRouting->numNets, sizeof(int *));
+  globalRouting->numNetTiles     = calloc(globalRouting->numNets, sizeof(int));
+  if (   (globalRouting->lateralCost == NULL) || (globalRouting->viaUpCost == NULL)
+      || (globalRouting->capacityEast == NULL) || (globalRouting->capacityNorth == NULL)
+      || (globalRouting->usageEast == NULL) || (globalRouting->usageNorth == NULL)
+      || (globalRouting->historyEast == NULL) || (globalRouting->historyNorth == NULL)
+      || (globalRouting->designRuleEast == NULL) || (globalRouting->designRuleNorth == NULL)
+      || (globalRouting->netTiles == NULL) || (globalRouting->numNetTiles == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the global-routing arrays in function 'routeNetsGlobally'.\n\n");
+    exit(1);
+  }
+
+  //
+  // Calculate the track-pitch, in cell units, of each design-rule subset:
+  //
+  for (int DR_num = 0; DR_num < user_inputs->numDesignRuleSets; DR_num++)  {
+    for (int DR_subset = 0; DR_subset < user_inputs->numDesignRuleSubsets[DR_num]; DR_subset++)  {
+      float pitchMicrons = user_inputs->designRules[DR_num][DR_subset].width_um[TRACE]
+                           + user_inputs->designRules[DR_num][DR_subset].space_um[TRACE][TRACE];
+      globalRouting->pitchCells[DR_num][DR_subset] = max(1.0, pitchMicrons / user_inputs->cell_size_um);
+    }  // End of for-loop for index 'DR_subset'
+  }  // End of for-loop for index 'DR_num'
+
+  //
+  // Calculate the average trace- and via-costs of each tile, and the capacity of each tile-edge.
+  // The costs are calculated from the user-defined cost-multipliers, because the 'cellCost'
+  // and 'vertCost' arrays are not populated until routing starts:
+  //
+  int *numWalkableCells = calloc(numTiles, sizeof(int));
+  int *numViaCells      = calloc(numTiles, sizeof(int));
+  if ((numWalkableCells == NULL) || (numViaCells == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the tile-cost arrays in function 'routeNetsGlobally'.\n\n");
+    exit(1);
+  }
+  for (int z = 0; z < mapInfo->numLayers; z++)  {
+    for (int x = 0; x < mapInfo->mapWidth; x++)  {
+      for (int y = 0; y < mapInfo->mapHeight; y++)  {
+        if (cellInfo[x][y][z].forbiddenTraceBarrier)  {
+          continue;
+        }
+        int tile = tileIndex(globalRouting, x, y, z);
+        globalRouting->lateralCost[tile] += (double)user_inputs->baseCellCost
+                                            * user_inputs->traceCostMultiplier[cellInfo[x][y][z].traceCostMultiplierIndex];
+        numWalkableCells[tile]++;
+
+        if ((z + 1 < mapInfo->numLayers) && (! cellInfo[x][y][z].forbiddenUpViaBarrier)
+             && (! cellInfo[x][y][z+1].forbiddenDownViaBarrier) && (! cellInfo[x][y][z+1].forbiddenTraceBarrier))  {
+          globalRouting->viaUpCost[tile] += (double)user_inputs->baseVertCost
+                                            * user_inputs->viaCostMultiplier[cellInfo[x][y][z].viaUpCostMultiplierIndex];
+          numViaCells[tile]++;
+        }
+
+        // Count the pair of walkable cells across the east edge of the tile:
+        if (((x + 1) % tileSize == 0) && (x + 1 < mapInfo->mapWidth) && (! cellInfo[x+1][y][z].forbiddenTraceBarrier))  {
+          globalRouting->capacityEast[tile] += 1.0;
+        }
+
+        // Count the pair of walkable cells across the north edge of the tile:
+        if (((y + 1) % tileSize == 0) && (y + 1 < mapInfo->mapHeight) && (! cellInfo[x][y+1][z].forbiddenTraceBarrier))  {
+          globalRouting->capacityNorth[tile] += 1.0;
+        }
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
+  }  // End of for-loop for index 'z'
+
+  double minLateralCost = DBL_MAX;
+  double minViaCost     = DBL_MAX;
+  for (int tile = 0; tile < numTiles; tile++)  {
+    if (numWalkableCells[tile])  {
+      globalRouting->lateralCost[tile] /= numWalkableCells[tile];
+      minLateralCost = min(minLateralCost, tileSize * globalRouting->lateralCost[tile]);
+    }
+    if (numViaCells[tile])  {
+      globalRouting->viaUpCost[tile] /= numViaCells[tile];
+      minViaCost = min(minViaCost, globalRouting->viaUpCost[tile]);
+    }
+
+    // Record the design-rule set at the mid-point of the east and north edges:
+    int tileX = tile % globalRouting->numTilesX;
+    int tileY = (tile / globalRouting->numTilesX) % globalRouting->numTilesY;
+    int tileZ = tile / (globalRouting->numTilesX * globalRouting->numTilesY);
+    int edgeX = min(mapInfo->mapWidth  - 1, (tileX + 1) * tileSize - 1);
+    int edgeY = min(mapInfo->mapHeight - 1, (tileY + 1) * tileSize - 1);
+    int midX  = min(mapInfo->mapWidth  - 1, tileX * tileSize + tileSize / 2);
+    int midY  = min(mapInfo->mapHeight - 1, tileY * tileSize + tileSize / 2);
+    globalRouting->designRuleEast[tile]  = cellInfo[edgeX][midY][tileZ].designRuleSet;
+    globalRouting->designRuleNorth[tile] = cellInfo[midX][edgeY][tileZ].designRuleSet;
+  }  // End of for-loop for index 'tile'
+  if (minLateralCost == DBL_MAX)
+    minLateralCost = 0.0;
+  if (minViaCost == DBL_MAX)
+    minViaCost = 0.0;
+
+  free(numWalkableCells);  numWalkableCells = NULL;
+  free(numViaCells);       numViaCells      = NULL;
+
+  //
+  // Allocate the work-space for routeOneNetGlobally(). Each tile can be pushed onto
+  // the heap once from each of its 6 neighbors:
+  //
+  double *Gcost      = malloc(numTiles * sizeof(double));
+  int *parentTile    = malloc(numTiles * sizeof(int));
+  int *reachedStamp  = calloc(numTiles, sizeof(int));
+  int *closedStamp   = calloc(numTiles, sizeof(int));
+  double *heapKey    = malloc((6 * (size_t)numTiles + 1) * sizeof(double));
+  int *heapNode      = malloc((6 * (size_t)numTiles + 1) * sizeof(int));
+  if (   (Gcost == NULL) || (parentTile == NULL) || (reachedStamp == NULL) || (closedStamp == NULL)
+      || (heapKey == NULL) || (heapNode == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the work-space arrays in function 'routeNetsGlobally'.\n\n");
+    exit(1);
+  }
+
+  //
+  // Route all nets repeatedly, with negotiated congestion:
+  //
+  int stamp = 0;
+  int iteration;
+  int numOverflowEdges = 0;
+  int numUnroutedNets  = 0;
+  for (iteration = 1; iteration <= maxGlobalRoutingIterations; iteration++)  {
+
+    // The cost of exceeding an edge's capacity grows with each iteration:
+    float presentFactor = 0.5 * pow(1.5, iteration - 1);
+
+    numUnroutedNets = 0;
+    for (int pathNum = 0; pathNum < globalRouting->numNets; pathNum++)  {
+
+      // Diff-pair nets are routed with their pseudo-nets:
+      if (user_inputs->isDiffPair[pathNum])  {
+        continue;
+      }
+
+      // Rip up the net's route from the previous iteration:
+      updateEdgeUsage(globalRouting, pathNum, -1.0, user_inputs);
+
+      stamp++;
+      routeOneNetGlobally(globalRouting, pathNum,
+                          tileIndex(globalRouting, mapInfo->start_cells[pathNum].X, mapInfo->start_cells[pathNum].Y, mapInfo->start_cells[pathNum].Z),
+                          tileIndex(globalRouting, mapInfo->end_cells[pathNum].X, mapInfo->end_cells[pathNum].Y, mapInfo->end_cells[pathNum].Z),
+                          presentFactor, minLateralCost, minViaCost, user_inputs,
+                          Gcost, parentTile, reachedStamp, closedStamp, stamp, heapKey, heapNode);
+
+      if (globalRouting->numNetTiles[pathNum] == 0)  {
+        numUnroutedNets++;
+      }
+      updateEdgeUsage(globalRouting, pathNum, +1.0, user_inputs);
+    }  // End of for-loop for index 'pathNum'
+
+    //
+    // Increase the history cost of each edge that is over capacity:
+    //
+    numOverflowEdges = 0;
+    for (int tile = 0; tile < numTiles; tile++)  {
+      float excessEast  = globalRouting->usageEast[tile]  - globalRouting->capacityEast[tile];
+      float excessNorth = globalRouting->usageNorth[tile] - globalRouting->capacityNorth[tile];
+      if (excessEast > 0.0)  {
+        globalRouting->historyEast[tile] += historyFactor * excessEast / globalRouting->pitchCells[globalRouting->designRuleEast[tile]][0];
+        numOverflowEdges++;
+      }
+      if (excessNorth > 0.0)  {
+        globalRouting->historyNorth[tile] += historyFactor * excessNorth / globalRouting->pitchCells[globalRouting->designRuleNorth[tile]][0];
+        numOverflowEdges++;
+      }
+    }  // End of for-loop for index 'tile'
+
+    #ifdef DEBUG_routeNetsGlobally
+    printf("DEBUG: Global-routing iteration %d: %d tile-edges are over capacity, and %d nets are unrouted.\n",
+           iteration, numOverflowEdges, numUnroutedNets);
+    #endif
+
+    if (numOverflowEdges == 0)  {
+      break;
+    }
+  }  // End of for-loop for index 'iteration'
+
+  printf("INFO: Global routing on a %d x %d x %d grid of %d-cell tiles finished after %d iteration(s) with %d tile-edge(s)\n",
+         globalRouting->numTilesX, globalRouting->numTilesY, globalRouting->numLayers, tileSize,
+         min(iteration, maxGlobalRoutingIterations), numOverflowEdges);
+  printf("      over capacity. %d net(s) could not be routed on the tile grid, and will be routed without a corridor.\n\n",
+         numUnroutedNets);
+
+  free(Gcost);         Gcost        = NULL;
+  free(parentTile);    parentTile   = NULL;
+  free(reachedStamp);  reachedStamp = NULL;
+  free(closedStamp);   closedStamp  = NULL;
+  free(heapKey);       heapKey      = NULL;
+  free(heapNode);      heapNode     = NULL;
+
+}  // End of function 'routeNetsGlobally'
+
+
+//-----------------------------------------------------------------------------
+// Name: createTileCorridorRestrictions
+// Desc: Populate 'corridorRestrictions', which must have been allocated with
+//       function allocateCorridorRestrictions(), so that findPath() can route
+//       net 'pathNum' only within the tiles of its global route, widened by
+//       'globalRoutingCorridorTiles' tiles in each lateral direction. Routing
+//       is allowed on each layer used by the global route, and on the layers
+//       immediately above and below these layers. Returns FALSE (and does not
+//       modify 'corridorRestrictions') if the net has no global route.
+//-----------------------------------------------------------------------------
+int createTileCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const GlobalRouting_t *globalRouting,
+                                   int pathNum, const MapInfo_t *mapInfo)  {
+
+  if ((pathNum >= globalRouting->numNets) || (globalRouting->numNetTiles[pathNum] == 0))  {
+    return(FALSE);
+  }
+
+  const int width    = mapInfo->mapWidth;
+  const int height   = mapInfo->mapHeight;
+  const int tileSize = globalRouting->tileSize;
+
+  // Start with an empty corridor on every layer:
+  memset(corridorRestrictions->corridorMap, 0, ((size_t)width * height + 7) / 8);
+  for (int layer = 0; layer < maxRoutingLayers; layer++)  {
+    corridorRestrictions->allowedLayers[layer]       = FALSE;
+    corridorRestrictions->allowedRadiiMicrons[layer] = 0.0;
+    corridorRestrictions->allowedRadiiCells[layer]   = 0.0;
+  }  // End of for-loop for index 'layer'
+  corridorRestrictions->corridorBox = (CellBox_t){width - 1, 0, height - 1, 0};
+
+  for (int i = 0; i < globalRouting->numNetTiles[pathNum]; i++)  {
+    int tile  = globalRouting->netTiles[pathNum][i];
+    int tileX = tile % globalRouting->numTilesX;
+    int tileY = (tile / globalRouting->numTilesX) % globalRouting->numTilesY;
+    int tileZ = tile / (globalRouting->numTilesX * globalRouting->numTilesY);
+
+    // Allow routing on this tile's layer and its adjacent layers:
+    for (int z = max(0, tileZ - 1); z <= min(mapInfo->numLayers - 1, tileZ + 1); z++)  {
+      corridorRestrictions->allowedLayers[z] = TRUE;
+    }
+
+    // Mark the cells in this tile and in the surrounding tiles:
+    const int xMin = max(0, (tileX - globalRoutingCorridorTiles) * tileSize);
+    const int xMax = min(width - 1, (tileX + globalRoutingCorridorTiles + 1) * tileSize - 1);
+    const int yMin = max(0, (tileY - globalRoutingCorridorTiles) * tileSize);
+    const int yMax = min(height - 1, (tileY + globalRoutingCorridorTiles + 1) * tileSize - 1);
+    for (int y = yMin; y <= yMax; y++)  {
+      setCorridorBits(corridorRestrictions->corridorMap, (size_t)y * width + xMin, (size_t)y * width + xMax);
+    }  // End of for-loop for index 'y'
+    expandCorridorBox(&(corridorRestrictions->corridorBox), xMin, xMax, yMin, yMax);
+  }  // End of for-loop for index 'i'
+
+  corridorRestrictions->restrictionFlag = TRUE;
+  corridorRestrictions->corridorFlag    = TRUE;
+
+  return(TRUE);
+
+}  // End of function 'createTileCorridorRestrictions'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeGlobalRouting
+// Desc: Free the memory allocated by function routeNetsGlobally().
+//-----------------------------------------------------------------------------
+void freeGlobalRouting(GlobalRouting_t *globalRouting)  {
+
+  free(globalRouting->lateralCost);      globalRouting->lateralCost     = NULL;
+  free(globalRouting->viaUpCost);        globalRouting->viaUpCost       = NULL;
+  free(globalRouting->capacityEast);     globalRouting->capacityEast    = NULL;
+  free(globalRouting->capacityNorth);    globalRouting->capacityNorth   = NULL;
+  free(globalRouting->usageEast);        globalRouting->usageEast       = NULL;
+  free(globalRouting->usageNorth);       globalRouting->usageNorth      = NULL;
+  free(globalRouting->historyEast);      globalRouting->historyEast     = NULL;
+  free(globalRouting->historyNorth);     globalRouting->historyNorth    = NULL;
+  free(globalRouting->designRuleEast);   globalRouting->designRuleEast  = NULL;
+  free(globalRouting->designRuleNorth);  globalRouting->designRuleNorth = NULL;
+
+  for (int pathNum = 0; pathNum < globalRouting->numNets; pathNum++)  {
+    free(globalRouting->netTiles[pathNum]);  globalRouting->netTiles[pathNum] = NULL;
+  }
+  free(globalRouting->netTiles);         globalRouting->netTiles        = NULL;
+  free(globalRouting->numNetTiles);      globalRouting->numNetTiles     = NULL;
+
+}  // End of function 'freeGlobalRouting'
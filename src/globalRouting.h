@@ -0,0 +1,45 @@
+#ifndef GLOBAL_ROUTING_H
+
+#define GLOBAL_ROUTING_H
+
+
+//-----------------------------------------------------------------------------
+// Name: routeNetsGlobally
+// Desc: Route each net on a coarse grid of tiles (G-cells) whose width and
+//       height are 'user_inputs->globalRoutingTileSize' cells. The capacity of
+//       the edge between two adjacent tiles is the number of pairs of walkable
+//       cells across the edge. Each net that crosses the edge consumes its
+//       track-pitch (trace width plus spacing) in the design-rule set at the
+//       edge. The cost of each tile is the average trace- or via-cost of its
+//       walkable cells, so cost zones are also respected. The nets are routed
+//       repeatedly with negotiated congestion, until no edge is over capacity
+//       or 'maxGlobalRoutingIterations' iterations have been performed. The
+//       results are stored in 'globalRouting', whose memory must later be freed
+//       by function freeGlobalRouting().
+//-----------------------------------------------------------------------------
+void routeNetsGlobally(GlobalRouting_t *globalRouting, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                       InputValues_t *user_inputs);
+
+
+//-----------------------------------------------------------------------------
+// Name: createTileCorridorRestrictions
+// Desc: Populate 'corridorRestrictions', which must have been allocated with
+//       function allocateCorridorRestrictions(), so that findPath() can route
+//       net 'pathNum' only within the tiles of its global route, widened by
+//       'globalRoutingCorridorTiles' tiles in each lateral direction. Routing
+//       is allowed on each layer used by the global route, and on the layers
+//       immediately above and below these layers. Returns FALSE (and does not
+//       modify 'corridorRestrictions') if the net has no global route.
+//-----------------------------------------------------------------------------
+int createTileCorridorRestrictions(RoutingRestriction_t *corridorRestrictions, const GlobalRouting_t *globalRouting,
+                                   int pathNum, const MapInfo_t *mapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeGlobalRouting
+// Desc: Free the memory allocated by function routeNetsGlobally().
+//-----------------------------------------------------------------------------
+void freeGlobalRouting(GlobalRouting_t *globalRouting);
+
+
+#endif
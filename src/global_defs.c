@@ -1,5 +1,7 @@
 #include "global_defs.h"
 #include "aStarLibrary.h"
+#include "landmarks.h"
+#include "cellArraySlabs.h"
 
 //
 // Define structure for recording the path number, design-rule number,
@@ -494,11 +496,11 @@ void assignCongestionByPathIndex(CellInfo_t *cellInfo, int pathIndex, unsigned c
             congestion_value, maxCongestion, maxCongestion);
 
     // 'congestion_value' exceeds allowed value, so assign the value 'maxCongestion':
-    cellInfo->congestion[pathIndex].pathTraversalsTimes100 = maxCongestion;
+    cellCongestion(cellInfo)[pathIndex].pathTraversalsTimes100 = maxCongestion;
   }
   else  {
     // Assign the new congestion value:
-    cellInfo->congestion[pathIndex].pathTraversalsTimes100 = congestion_value;
+    cellCongestion(cellInfo)[pathIndex].pathTraversalsTimes100 = congestion_value;
   }  // End of if/else-block
 
 }  // End of function 'assignCongestionByPathIndex'
@@ -1281,6 +1283,10 @@ void add_path_center_info(CellInfo_t *cellInfo, int pathNum, int shape_type)  {
   // printf("\nDEBUG: Entered function 'add_path_center_info' for pathNum %d and shapeType %d, numTraveringPathCenters=%d...\n",
   //         pathNum, shape_type, cellInfo->numTraversingPathCenters);
 
+  // The 'pathCenters' array is about to be re-allocated, so it must not be
+  // shared with another map:
+  unsharePathCenters(cellInfo);
+
   // Increment number of traversing path-centers:
   cellInfo->numTraversingPathCenters++;
 
@@ -1296,34 +1302,68 @@ void add_path_center_info(CellInfo_t *cellInfo, int pathNum, int shape_type)  {
 
   // Allocate memory for the additional traversing path-center in the
   // 'pathCenters' array:
-  // printf("        DEBUG: Before realloc, address of cellInfo[%d][%d][%d].pathCenters is %p\n",
-  //          x, y, z, cellInfo[x][y][z].pathCenters);
-  cellInfo->pathCenters = realloc(cellInfo->pathCenters,
-                   cellInfo->numTraversingPathCenters * sizeof(PathAndShapeInfo_t));
-  if (cellInfo->pathCenters == 0)  {
-    printf("ERROR: While adding path-center for path %d to 'pathCenters' member, program was\n", pathNum);
-    printf("       unable to allocate memory for element %d of array 'cellInfo.pathCenters'.\n" ,
-           cellInfo->numTraversingPathCenters);
-    printf("       Program will terminate.\n");
-    exit(1);
-  }
-
-  // printf("        DEBUG: Successfully allocated memory for cellInfo[%d][%d][%d].pathCenters.\n",
-  //         x, y, z);
+  cellInfo->pathCentersHandle = resizePathCenters(cellInfo->pathCentersHandle,
+                                                  cellInfo->numTraversingPathCenters - 1,
+                                                  cellInfo->numTraversingPathCenters);
+  PathAndShapeInfo_t *pathCenters = cellPathCenters(cellInfo);
 
   // Add path number to the new array element:
-  cellInfo->pathCenters[cellInfo->numTraversingPathCenters - 1].pathNum = pathNum;
+  pathCenters[cellInfo->numTraversingPathCenters - 1].pathNum = pathNum;
   // printf("        DEBUG: cellInfo[%d][%d][%d].pathCenters[%d].pathNum = %d\n", x, y, z,
   //            cellInfo[x][y][z].numTraversingPathCenters - 1, pathNum);
 
   // Add shape-type to the new array element:
-  cellInfo->pathCenters[cellInfo->numTraversingPathCenters - 1].shapeType = shape_type;
+  pathCenters[cellInfo->numTraversingPathCenters - 1].shapeType = shape_type;
   // printf("        DEBUG: cellInfo[%d][%d][%d].pathCenters[%d].shapeType = %d\n", x, y, z,
   //            cellInfo[x][y][z].numTraversingPathCenters - 1, shape_type);
 
 }  // End of function 'add_path_center_info'
 
 
+//-----------------------------------------------------------------------------
+// Name: unshareCongestion
+// Desc: If the 'congestion' array of cell 'cellInfo' is shared with another
+//       cellInfo map, then replace it with a private copy so that it can be
+//       modified or freed without affecting the other map.
+//-----------------------------------------------------------------------------
+void unshareCongestion(CellInfo_t *cellInfo)  {
+
+  if (! cellInfo->congestionIsShared)  {
+    return;
+  }
+
+  const CellArrayHandle_t privateCongestion = allocateCongestion(cellInfo->numTraversingPaths);
+  memcpy(cellArrayAddress(privateCongestion), cellCongestion(cellInfo),
+         cellInfo->numTraversingPaths * sizeof(Congestion_t));
+
+  cellInfo->congestionHandle   = privateCongestion;
+  cellInfo->congestionIsShared = FALSE;
+
+}  // End of function 'unshareCongestion'
+
+
+//-----------------------------------------------------------------------------
+// Name: unsharePathCenters
+// Desc: If the 'pathCenters' array of cell 'cellInfo' is shared with another
+//       cellInfo map, then replace it with a private copy so that it can be
+//       modified or freed without affecting the other map.
+//-----------------------------------------------------------------------------
+void unsharePathCenters(CellInfo_t *cellInfo)  {
+
+  if (! cellInfo->pathCentersAreShared)  {
+    return;
+  }
+
+  const CellArrayHandle_t privatePathCenters = allocatePathCenters(cellInfo->numTraversingPathCenters);
+  memcpy(cellArrayAddress(privatePathCenters), cellPathCenters(cellInfo),
+         cellInfo->numTraversingPathCenters * sizeof(PathAndShapeInfo_t));
+
+  cellInfo->pathCentersHandle    = privatePathCenters;
+  cellInfo->pathCentersAreShared = FALSE;
+
+}  // End of function 'unsharePathCenters'
+
+
 //-----------------------------------------------------------------------------
 // Name: getIndexOfTraversingPath
 // Desc: Determine whether path 'pathNum' with shape type 'shapeType' and design-
@@ -1347,9 +1387,9 @@ int getIndexOfTraversingPath(CellInfo_t *cellInfo, const int pathNum, const unsi
   for (int pathIndex = 0; pathIndex < numTraversingPaths; pathIndex++)  {
 
     // If pathNum is found among the traversing paths, then return the index:
-    if ((     pathNum == cellInfo->congestion[pathIndex].pathNum)
-        && (DR_subset == cellInfo->congestion[pathIndex].DR_subset)
-        && (shapeType == cellInfo->congestion[pathIndex].shapeType))  {
+    if ((     pathNum == cellCongestion(cellInfo)[pathIndex].pathNum)
+        && (DR_subset == cellCongestion(cellInfo)[pathIndex].DR_subset)
+        && (shapeType == cellCongestion(cellInfo)[pathIndex].shapeType))  {
 
       return(pathIndex);
 
@@ -1868,246 +1908,1293 @@ void addCongestionAroundTerminal(const int pathNum, const Coordinate_t centerPoi
 
 
 //-----------------------------------------------------------------------------
-// Name: findPath
-// Desc: Finds a path using A* algorithm. The information in structure
-//       'routingRestrictions' is used to limit the lateral search within a
-//       given distance of a given (x,y) coordinate on a given layer. This
-//       function returns the G-cost of the path, which will be zero if no
-//       path was found. The 'record_explored_cells' parameter tells function
-//       which cells to flag as having been explored:
-//
-//       record_explored_cells   Action
-//       ---------------------   ---------------------------------------------
-//                 0             Record no explored cells
-//                 1             Record explored cells in '.explored' variable
-//                 2             Record explored cells in '.explored_PP' variable
-//                 3             Record explored cells in '.explored' and
-//                               in '.explored_PP' variables
-//
-//       If Boolean parameter 'record_elapsed_time' is TRUE, then the elapsed
-//       (wall-clock) time for finding the path will be saved in variable:
-//       routability->path_elapsed_time[pathNum].
-//
-//       If Boolean input parameter 'useDijkstra' is TRUE, then this function
-//       uses a heuristic value of zero. Otherwise, it uses a heuristic that
-//       depends on the distance to the target and the DRC histories of the
-//       routed path and of other paths in the map.
-//
-//       If Boolean parameter 'disableRandomCosts' is TRUE, then findPath()
-//       disables any randomized changes to the congestion-related G-cost.
-//
+// Name: cellIsBeyondRoutingRadius
+// Desc: Return TRUE if location (x,y) on layer 'z' is farther from the center-
+//       point of 'routingRestrictions' than the allowed radius on that layer.
+//       Most cells are resolved by the integer bounds in 'radiusInnerBox' and
+//       'radiusOuterBox', which findPath() calculates before each search, so
+//       that the square-root is needed only for cells near the circle's edge.
 //-----------------------------------------------------------------------------
-//
-// Define 'DEBUG_findPath' and re-compile if you want verbose debugging print-statements enabled:
-//
-// #define DEBUG_findPath 1
-#undef DEBUG_findPath
+static inline int cellIsBeyondRoutingRadius(const RoutingRestriction_t *routingRestrictions,
+                                            const PathFinding_t *pathFinding, int x, int y, int z)  {
 
-unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
-                       int pathNum, const Coordinate_t startCoord, const Coordinate_t endCoord,
-                       Coordinate_t *pathCoords[], int *pathLength, InputValues_t *user_inputs,
-                       RoutingMetrics_t *routability, PathFinding_t *pathFinding, const int record_explored_cells,
-                       const int record_elapsed_time, const int useDijkstra, const RoutingRestriction_t *routingRestrictions,
-                       const int disableRandomCosts, const int recognizeSelfCongestion)  {
+  const CellBox_t *innerBox = &(pathFinding->radiusInnerBox[z]);
+  if ((x >= innerBox->minX) && (x <= innerBox->maxX) && (y >= innerBox->minY) && (y <= innerBox->maxY))  {
+    return(FALSE);
+  }
 
-  // Return-value to inform the calling routine that the start-
-  // and end-coordinates are identical:
-  const int zeroLength = 0;
+  const CellBox_t *outerBox = &(pathFinding->radiusOuterBox[z]);
+  if ((x < outerBox->minX) || (x > outerBox->maxX) || (y < outerBox->minY) || (y > outerBox->maxY))  {
+    return(TRUE);
+  }
 
-  // Value to assign to 'pathLength' before/until a path is found:
-  const int notStarted = 0;
+  return(calc_2D_Pythagorean_distance_ints(x, y, routingRestrictions->centerX, routingRestrictions->centerY)
+           > routingRestrictions->allowedRadiiCells[z]);
 
-  // Constants for the 'pathFinding->whichList[][][]' array:
-  const char onOpenList = 0;            // Denotes that cell is on the Open List
-  const char onClosedList = 10;         // Denotes that cell is on the Closed List
+}  // End of function 'cellIsBeyondRoutingRadius'
 
-  // Constants for the variable 'path':
-  const int nonexistent = 0;
-  const int found = 1;
 
+//-----------------------------------------------------------------------------
+// Name: setSearchWindow
+// Desc: Calculate the integer bounds of the radius-based routing restrictions
+//       on each layer, and the smallest box of cells that findPath() can
+//       reach from 'startCoord' under 'routingRestrictions'. The path-finding
+//       arrays are then indexed over only this box, so that a restricted search
+//       uses a compact block of memory. Without restrictions, or for a net
+//       that starts in a pin-swap zone (in which no restrictions apply), the
+//       box is the whole map.
+//-----------------------------------------------------------------------------
+static void setSearchWindow(PathFinding_t *pathFinding, const MapInfo_t *mapInfo,
+                            const RoutingRestriction_t *routingRestrictions, const unsigned short pathSwapZone,
+                            const Coordinate_t startCoord, const Coordinate_t endCoord)  {
+
+  Coordinate_t windowMin = {0, 0, 0, FALSE};
+  Coordinate_t windowMax = {mapInfo->mapWidth, mapInfo->mapHeight, mapInfo->numLayers, FALSE};
+
+  if (! routingRestrictions->restrictionFlag)  {
+    setPathFindingWindow(pathFinding, windowMin, windowMax);
+    return;
+  }
 
-  #ifdef DEBUG_findPath
-  // DEBUG code follows:
   //
-  // For very large maps, define here the 3-dimensional window in (x,y,z) for which you want
-  // detailed information sent to the log file. Without these constraints, the log file can
-  // grow to >10 gigabytes:
-  int x_window_min =    0;
-  int x_window_max =  200;
-  int y_window_min =    0;
-  int y_window_max =  300;
-  int z_window_min =    0;
-  int z_window_max =    5;
+  // On each layer with a radius-based restriction, find the largest square centered on
+  // (centerX, centerY) whose cells are all within the radius, and the smallest square
+  // that contains all cells within the radius. Because the radius is checked only for
+  // lateral moves, a layer's 'outer' box bounds the (x,y) locations that the search can
+  // reach on that layer:
   //
-  // Check if the input parameters satisfy specific requirements. If so, then set the
-  // 'DEBUG_ON' flag to TRUE so that this function will print out additional debug information:
-  int DEBUG_ON = FALSE;
-  int DEBUG_CRITERIA_MET = FALSE;
-  if ((mapInfo->current_iteration >= 1) && (mapInfo->current_iteration <= 288) && ((pathNum == 0) || (pathNum == 0)))  {
-    printf("\n\nDEBUG: (thread %2d) Setting DEBUG_ON to TRUE in findPath() because specific requirements were met.\n\n", omp_get_thread_num());
-    DEBUG_ON = TRUE;  // TRUE for now, but will be set to FALSE for certain x/y/z coordinates
-    DEBUG_CRITERIA_MET = TRUE;  // TRUE throughout this function, regardless of x/y/z coordinates
-  }  // End of if-block for determining whether to set DEBUG_ON to TRUE
-
-  // DEBUG code follows:
-  if (DEBUG_ON)  {
-    time_t tim = time(NULL);
-    struct tm *now = localtime(&tim);
-    printf("\nDEBUG: Entered 'findPath' at %02d-%02d-%d, %02d:%02d in thread %d for path %d from (%d,%d,%d) to (%d,%d,%d)...\n",
-           now->tm_mon+1, now->tm_mday, now->tm_year+1900, now->tm_hour, now->tm_min, omp_get_thread_num(),
-           pathNum, startCoord.X, startCoord.Y, startCoord.Z, endCoord.X, endCoord.Y, endCoord.Z);
-    if (routingRestrictions->restrictionFlag)  {
-      printf("DEBUG: (thread %2d)\n", omp_get_thread_num());
-      printf("DEBUG: (thread %2d) Routing restrictions are in effect:\n", omp_get_thread_num());
-      printf("DEBUG: (thread %2d)     centerX: %d\n", omp_get_thread_num(), routingRestrictions->centerX);
-      printf("DEBUG: (thread %2d)     centerY: %d\n", omp_get_thread_num(), routingRestrictions->centerY);
-      for (int layer = 0; layer < mapInfo->numLayers; layer++)  {
-        if (routingRestrictions->allowedLayers[layer])
-          printf("DEBUG: (thread %2d) layer %d: routing ALLOWED with radius %6.3f microns (%6.3f cells)\n",
-                 omp_get_thread_num(), layer, routingRestrictions->allowedRadiiMicrons[layer], routingRestrictions->allowedRadiiCells[layer]);
-        else
-        printf("DEBUG: (thread %2d) layer %d: routing NOT ALLOWED\n", omp_get_thread_num(), layer);
+  const int centerX = routingRestrictions->centerX;
+  const int centerY = routingRestrictions->centerY;
+  int radiiAreFinite = TRUE;  // FALSE if any allowed layer has no radius-based restriction
+  CellBox_t radiusBox = {INT_MAX, INT_MIN, INT_MAX, INT_MIN};  // Union of 'outer' boxes on the allowed layers
+  for (int layer = 0; layer < mapInfo->numLayers; layer++)  {
+    const float radius = routingRestrictions->allowedRadiiCells[layer];
+    if ((! routingRestrictions->allowedLayers[layer]) || (radius <= 0.1))  {
+      // The radius is not checked on this layer, so the inner box contains every cell:
+      pathFinding->radiusInnerBox[layer] = (CellBox_t){INT_MIN, INT_MAX, INT_MIN, INT_MAX};
+      pathFinding->radiusOuterBox[layer] = (CellBox_t){INT_MIN, INT_MAX, INT_MIN, INT_MAX};
+      if (routingRestrictions->allowedLayers[layer])  {
+        radiiAreFinite = FALSE;
       }
+      continue;
     }
-    else  {
-      printf("DEBUG: (thread %2d) No routing restrictions are in effect.\n", omp_get_thread_num());
+
+    int innerHalfWidth = (int)(radius / sqrt(2.0));
+    while ((innerHalfWidth > 0) && (calc_2D_Pythagorean_distance_ints(innerHalfWidth, innerHalfWidth, 0, 0) > radius))  {
+      innerHalfWidth--;
     }
-    printf("DEBUG: (thread %2d)\n", omp_get_thread_num());
+    int outerHalfWidth = (int)radius;
+    while (calc_2D_Pythagorean_distance_ints(outerHalfWidth + 1, 0, 0, 0) <= radius)  {
+      outerHalfWidth++;
+    }
+
+    pathFinding->radiusInnerBox[layer] = (CellBox_t){centerX - innerHalfWidth, centerX + innerHalfWidth,
+                                                     centerY - innerHalfWidth, centerY + innerHalfWidth};
+    pathFinding->radiusOuterBox[layer] = (CellBox_t){centerX - outerHalfWidth, centerX + outerHalfWidth,
+                                                     centerY - outerHalfWidth, centerY + outerHalfWidth};
+
+    radiusBox.minX = min(radiusBox.minX, centerX - outerHalfWidth);
+    radiusBox.maxX = max(radiusBox.maxX, centerX + outerHalfWidth);
+    radiusBox.minY = min(radiusBox.minY, centerY - outerHalfWidth);
+    radiusBox.maxY = max(radiusBox.maxY, centerY + outerHalfWidth);
+  }  // End of for-loop for index 'layer'
+
+  // Restrictions don't apply to cells in a pin-swap zone, so a net that starts in its
+  // pin-swap zone can reach any cell in the zone:
+  if (pathSwapZone)  {
+    setPathFindingWindow(pathFinding, windowMin, windowMax);
+    return;
   }
-  // End of DEBUG code.
-  #endif
 
+  //
+  // The search can reach only the allowed layers, plus the layers of the two terminals:
+  //
+  windowMin.Z = min(startCoord.Z, endCoord.Z);
+  windowMax.Z = max(startCoord.Z, endCoord.Z);
+  for (int layer = 0; layer < mapInfo->numLayers; layer++)  {
+    if (routingRestrictions->allowedLayers[layer])  {
+      windowMin.Z = min(windowMin.Z, layer);
+      windowMax.Z = max(windowMax.Z, layer);
+    }
+  }  // End of for-loop for index 'layer'
 
-  // Keep track of how much elapsed time this call to function 'findPath' uses:
-  time_t start, end;
-  start = time(NULL); // Get number of seconds since the Epoch (Jan 1, 1970)
+  //
+  // Laterally, the search can reach only the corridor (if one is used) or the union of the
+  // radius-based boxes, plus the locations of the two terminals:
+  //
+  CellBox_t lateralBox = {0, mapInfo->mapWidth, 0, mapInfo->mapHeight};
+  if (routingRestrictions->corridorFlag)  {
+    lateralBox = routingRestrictions->corridorBox;
+  }
+  else if (radiiAreFinite && (radiusBox.minX <= radiusBox.maxX))  {
+    lateralBox = radiusBox;
+  }
+  windowMin.X = max(0, min(lateralBox.minX, min(startCoord.X, endCoord.X)));
+  windowMax.X = min(mapInfo->mapWidth, max(lateralBox.maxX, max(startCoord.X, endCoord.X)));
+  windowMin.Y = max(0, min(lateralBox.minY, min(startCoord.Y, endCoord.Y)));
+  windowMax.Y = min(mapInfo->mapHeight, max(lateralBox.maxY, max(startCoord.Y, endCoord.Y)));
 
-  // Create arrays that define the 18 allowed transitions from one cell to another cell:
-  int num_transitions = 18;
-  int allowedTransitions[] = {E,  N,  W,  S, NE, SE, NW, SW, NxNE, ExNE, ExSE, SxSE, SxSW, WxSW, WxNW, NxNW,   Up, Down};
-  int allowedDeltaX[]      = {1,  0, -1,  0,  1,  1, -1, -1,    1,    2,    2,    1,   -1,   -2,   -2,   -1,    0,    0};
-  int allowedDeltaY[]      = {0,  1,  0, -1,  1, -1,  1, -1,    2,    1,   -1,   -2,   -2,   -1,    1,    2,    0,    0};
-  int allowedDeltaZ[]      = {0,  0,  0,  0,  0,  0,  0,  0,    0,    0,    0,    0,    0,    0,    0,    0,    1,   -1};
+  setPathFindingWindow(pathFinding, windowMin, windowMax);
 
-  // After the first iteration, shuffle the sequence of the above arrays so that the child-cells
-  // are explored in a pseudo-random order each time this function is called. The seed for the
-  // pseudo-random number generator is the cost of this path (in cell units) from the most recent
-  // iteration. The for-loops below use the FisherYates shuffle algorithm.
-  if (mapInfo->current_iteration > 1)  {
-    unsigned int seed = abs((unsigned int) routability->path_cost[pathNum]);
-    // printf("DEBUG: (thread %2d) Seed for pseudo-random numbers is %'d for path %d ( = cost from previous iteration)\n",
-    //         omp_get_thread_num(), seed, pathNum);
+}  // End of function 'setSearchWindow'
 
-    for (int i = num_transitions - 1; i > 0; i--)  {
-      // Generate a random index value from 0 to i
-      int j = rand_r(&seed) % (i + 1);
 
-      // Exchange elements for 'allowedTransitions' array:
-      int temp = allowedTransitions[j];
-      allowedTransitions[j] = allowedTransitions[i];
-      allowedTransitions[i] = temp;
+//-----------------------------------------------------------------------------
+// Name: transitionIsAllowed
+// Desc: Determine whether path 'pathNum' may move from the parent cell at
+//       (parentX, parentY, parentZ) to the child cell located at offset
+//       (deltaX, deltaY, deltaZ), which corresponds to the transition
+//       'transition' (E, N, NxNE, Up, etc.). The rules are the same as those
+//       applied to each child cell by findPath(): allowed routing directions,
+//       barriers and their proximity zones, via blockages, pin-swap zones,
+//       routing restrictions, and corner-cutting. The allowed routing directions
+//       are read from the look-up tables in 'pathFinding', in which the move is
+//       transition number 'transitionIndex'. Returns TRUE if the move is
+//       allowed. In that case, the minimum allowed routing directions of the
+//       two cells and the shape-type of the child cell are returned in
+//       'minimum_allowedRoutingDirections' and 'shapeType'.
+//-----------------------------------------------------------------------------
+static int transitionIsAllowed(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo, InputValues_t *user_inputs,
+                               const int pathNum, const unsigned short pathSwapZone, const Coordinate_t endCoord,
+                               const RoutingRestriction_t *routingRestrictions, const PathFinding_t *pathFinding,
+                               const int parentX, const int parentY, const int parentZ, const int transitionIndex,
+                               const int transition, const int deltaX_signed, const int deltaY_signed,
+                               const int deltaZ_signed, int *minimum_allowedRoutingDirections, unsigned short *shapeType)  {
+
+  // Coordinates of the child cell:
+  const int a = parentX + deltaX_signed;
+  const int b = parentY + deltaY_signed;
+  const int c = parentZ + deltaZ_signed;
+
+  // Both cells must be within the map:
+  if (   (a < 0) || (b < 0) || (c < 0) || (a >= mapInfo->mapWidth) || (b >= mapInfo->mapHeight) || (c >= mapInfo->numLayers)
+      || (parentX < 0) || (parentY < 0) || (parentZ < 0) || (parentX >= mapInfo->mapWidth) || (parentY >= mapInfo->mapHeight)
+      || (parentZ >= mapInfo->numLayers))  {
+    return(FALSE);
+  }
 
-      // Exchange elements for 'allowedDeltaX' array:
-      temp = allowedDeltaX[j];
-      allowedDeltaX[j] = allowedDeltaX[i];
-      allowedDeltaX[i] = temp;
+  const int deltaX = abs(deltaX_signed);
+  const int deltaY = abs(deltaY_signed);
+  const int deltaZ = abs(deltaZ_signed);
 
-      // Exchange elements for 'allowedDeltaY' array:
-      temp = allowedDeltaY[j];
-      allowedDeltaY[j] = allowedDeltaY[i];
-      allowedDeltaY[i] = temp;
+  // Get the allowed routing directions in the parent and child cells, based on the
+  // design-rule number (location-specific) and design-rule subset (net-specific).
+  // The minimum of the two was tabulated by calcAllowedTransitionMasks():
+  int parent_DR_num    = cellInfo[parentX][parentY][parentZ].designRuleSet;
+  int parent_DR_subset = user_inputs->designRuleSubsetMap[pathNum][parent_DR_num];
+  int parent_allowedRoutingDirections = user_inputs->designRules[parent_DR_num][parent_DR_subset].routeDirections;
 
-      // Exchange elements for 'allowedDeltaZ' array:
-      temp = allowedDeltaZ[j];
-      allowedDeltaZ[j] = allowedDeltaZ[i];
-      allowedDeltaZ[i] = temp;
-    }  // End of for-loop for index 'i' to shuffle arrays
-  }  // End of if-block for current_iteration > 1
+  int child_DR_num = cellInfo[a][b][c].designRuleSet;
 
+  *minimum_allowedRoutingDirections = pathFinding->minimumRoutingDirections[parent_DR_num][child_DR_num];
 
-  #ifdef DEBUG_findPath
-  if (DEBUG_ON)  {
-    printf("\nDEBUG: (thread %2d) In iteration #%d, the sequence of child-cell exploration for path %d follows:\n",
-           omp_get_thread_num(), mapInfo->current_iteration, pathNum);
-    for (int i = 0; i < num_transitions; i++)  {
-      printf("DEBUG: (thread %2d)     (delta-X, delta-Y, delta-Z) = (%d,%d,%d)\n", omp_get_thread_num(), allowedDeltaX[i], allowedDeltaY[i], allowedDeltaZ[i]);
-    }  // End of for-loop for index 'i'
-    printf("DEBUG: (thread %2d) ----------------------\n", omp_get_thread_num());
+  int direction_allowed = (pathFinding->allowedTransitionMask[parent_DR_num][child_DR_num] >> transitionIndex) & 1;
+
+  // With X_ROUTING, also allow any direction into a cell that is adjacent to the target cell:
+  if (__builtin_expect((parent_allowedRoutingDirections == X_ROUTING) && (abs(a - endCoord.X) + abs(b - endCoord.Y) == 1), FALSE))  {
+    direction_allowed = allowedDirection(deltaX, deltaY, deltaZ, ANY);
   }
-  #endif
 
-  // Fetch the Boolean flag (randomize_congestion) that determines whether the current
-  // path was randomly selected to have its congestion-related G-cost increased or reduced:
-  int random_reduction_flag;
-  if (disableRandomCosts)  {
-    random_reduction_flag = FALSE;
+  // With X_ROUTING, also allow north/south/east/west moves into or out of a pin-swap zone:
+  if (__builtin_expect((parent_allowedRoutingDirections == X_ROUTING)
+      && (cellInfo[parentX][parentY][parentZ].swap_zone || cellInfo[a][b][c].swap_zone)
+      && (deltaX + deltaY + deltaZ == 1), FALSE))  {
+    direction_allowed = TRUE;
+  }
+
+  if (! direction_allowed)  {
+    return(FALSE);
+  }
+
+  // Check for blocked vias, barriers, and proximity to barriers and swap-zones:
+  if (transition == Up)  {
+    if (   cellInfo[parentX][parentY][parentZ].forbiddenUpViaBarrier
+        || cellInfo[a][b][c].forbiddenDownViaBarrier
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN)
+        || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN)
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentX, parentY, parentZ, pathNum, VIA_UP)
+        || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentX, parentY, parentZ, pathNum, VIA_UP))  {
+      return(FALSE);
+    }
+    *shapeType = VIA_DOWN;
+  }
+  else if (transition == Down)  {
+    if (   cellInfo[parentX][parentY][parentZ].forbiddenDownViaBarrier
+        || cellInfo[a][b][c].forbiddenUpViaBarrier
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP)
+        || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP)
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentX, parentY, parentZ, pathNum, VIA_DOWN)
+        || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentX, parentY, parentZ, pathNum, VIA_DOWN))  {
+      return(FALSE);
+    }
+    *shapeType = VIA_UP;
   }
   else  {
-    random_reduction_flag = routability->randomize_congestion[pathNum];
+    if (   cellInfo[a][b][c].forbiddenTraceBarrier
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE)
+        || (get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE)
+            && (! get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentX, parentY, parentZ, pathNum, TRACE))
+            && (! cellInfo[parentX][parentY][parentZ].swap_zone)))  {
+      return(FALSE);
+    }
+    *shapeType = TRACE;
+  }  // End of if/else-blocks for Up, Down, and lateral transitions
+
+  // Don't enter a pin-swap zone that belongs to a different path:
+  if ((cellInfo[a][b][c].swap_zone) && (cellInfo[a][b][c].swap_zone != pathSwapZone))  {
+    return(FALSE);
   }
 
-  // If this path was randomly selected to have it's congestion-related G-cost modified, then
-  // calculate the scaling factor, which ranges from 0.02 to 1.00 (for reductions), or from
-  // 1.00 to 4.0 (for increases), based on the history of DRC violations in the map and
-  // history of DRC violations for this specific path. Also disable any routing restrictions
-  // for this pseudo-randomly selected path:
-  float congestion_scale_factor = 1.0;
-  if (random_reduction_flag)  {
+  // Apply any routing restrictions to cells outside of swap-zones:
+  if (routingRestrictions->restrictionFlag
+       && (! cellInfo[a][b][c].swap_zone)
+       && ((! routingRestrictions->allowedLayers[c])
+            || (routingRestrictions->corridorFlag && (! cellIsInCorridor(routingRestrictions, a, b)))
+            || (   (deltaZ == 0)
+                && (routingRestrictions->allowedRadiiCells[c] > 0.1)
+                && cellIsBeyondRoutingRadius(routingRestrictions, pathFinding, a, b, c)) ))  {
+    return(FALSE);
+  }
 
-    // We got here, so the random_reduction_flag equals either 'DECREASE' or 'INCREASE'
+  // Don't cut across unwalkable corners. For diagonal moves, the two corner cells are
+  // adjacent to both the parent and child cells. For knight's moves, the corner cells
+  // are the two cells that are adjacent to the line between the parent and child:
+  if ((deltaZ == 0) && (deltaX + deltaY > 1))  {
+    int corner_1_X, corner_1_Y, corner_2_X, corner_2_Y;
+    if (deltaX == 2)  {
+      corner_1_X = parentX + deltaX_signed / 2;   corner_1_Y = parentY + deltaY_signed;
+      corner_2_X = parentX + deltaX_signed / 2;   corner_2_Y = parentY;
+    }
+    else if (deltaY == 2)  {
+      corner_1_X = parentX + deltaX_signed;       corner_1_Y = parentY + deltaY_signed / 2;
+      corner_2_X = parentX;                       corner_2_Y = parentY + deltaY_signed / 2;
+    }
+    else  {
+      corner_1_X = parentX + deltaX_signed;       corner_1_Y = parentY;
+      corner_2_X = parentX;                       corner_2_Y = parentY + deltaY_signed;
+    }
+    if (   cellInfo[corner_1_X][corner_1_Y][parentZ].forbiddenTraceBarrier
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, corner_1_X, corner_1_Y, parentZ, pathNum, TRACE)
+        || cellInfo[corner_2_X][corner_2_Y][parentZ].forbiddenTraceBarrier
+        || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, corner_2_X, corner_2_Y, parentZ, pathNum, TRACE))  {
+      return(FALSE);
+    }
+  }  // End of if-block for diagonal and knight's moves
 
-    // Reduce the 'congestion_scale_factor' if the flag is set to 'DECREASE':
-    if (random_reduction_flag == DECREASE)  {
+  // Paths enter and exit pin-swap zones only in north/south/east/west directions:
+  if ((cellInfo[parentX][parentY][parentZ].swap_zone || cellInfo[a][b][c].swap_zone) && (deltaX + deltaY + deltaZ != 1))  {
+    return(FALSE);
+  }
 
-      congestion_scale_factor = 1.0 - 0.98  *  (1.0   -   0.2 * routability->fractionRecentIterationsWithoutMapDRCs)
-                                            *  (1.0   -         routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+  return(TRUE);
 
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("\nDEBUG (thread %2d): Randomly decreasing congestion_scale_factor in findPath: congestion_scale_factor = %.4f for path %d in iter #%d, with recent map DRC-free fraction=%1.3f and path DRC-free fraction=%1.3f\n\n",
-               omp_get_thread_num(), congestion_scale_factor, pathNum, mapInfo->current_iteration,
-               routability->fractionRecentIterationsWithoutMapDRCs, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
-      }
-      #endif
+}  // End of function 'transitionIsAllowed'
 
-    }  // End of if-block for (random_reduction_flag == DECREASE)
 
-    // Increase the 'congestion_scale_factor' because the flag is set to 'INCREASE':
-    else  {
+//
+// Change in the X-, Y-, and Z-coordinates for each transition code (E, N, ..., Up, Down):
+//
+static const int transitionDeltaX[] = {1,  0, -1,  0,  1,  1, -1, -1,    1,    2,    2,    1,   -1,   -2,   -2,   -1,    0,    0};
+static const int transitionDeltaY[] = {0,  1,  0, -1,  1, -1,  1, -1,    2,    1,   -1,   -2,   -2,   -1,    1,    2,    0,    0};
+static const int transitionDeltaZ[] = {0,  0,  0,  0,  0,  0,  0,  0,    0,    0,    0,    0,    0,    0,    0,    0,    1,   -1};
 
-      congestion_scale_factor = 1.0 +  4.0  *  (1.0   -   0.2 * routability->fractionRecentIterationsWithoutMapDRCs)
-                                            *  (1.0   -         routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
 
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("\nDEBUG (thread %2d): Randomly increasing congestion_scale_factor in findPath:, congestion_scale_factor = %.4f for path %d in iter #%d, with recent map DRC-free fraction=%1.3f and path DRC-free fraction=%1.3f\n\n",
-               omp_get_thread_num(), congestion_scale_factor, pathNum, mapInfo->current_iteration,
-               routability->fractionRecentIterationsWithoutMapDRCs, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
-      }
-      #endif
-    }  // End of else-block for (random_reduction_flag == INCREASE)
-  }  // End of if-block for random_reduction_flag != zero
+//-----------------------------------------------------------------------------
+// Name: parentCell
+// Desc: Return the cell that is reached from 'coord' by moving against
+//       ('sign' = -1) or along ('sign' = +1) the transition with code
+//       'direction' (E, N, ..., Up, Down). In the forward search tree, whose
+//       'parentDirection' array holds the move from each cell's parent to the
+//       cell, the parent is found with 'sign' = -1. In the backward tree of the
+//       bidirectional search, whose 'parentDirection_reverse' array holds the
+//       move from each cell to the next cell toward the end-terminal, the next
+//       cell is found with 'sign' = +1.
+//-----------------------------------------------------------------------------
+static inline Coordinate_t parentCell(const Coordinate_t coord, const unsigned char direction, const int sign)  {
 
-  // Define variable that will hold the congestion-related G-cost:
-  unsigned long congestion_penalty;
+  Coordinate_t parent;
+  parent.X    = coord.X + sign * transitionDeltaX[direction];
+  parent.Y    = coord.Y + sign * transitionDeltaY[direction];
+  parent.Z    = coord.Z + sign * transitionDeltaZ[direction];
+  parent.flag = FALSE;
 
-  #ifdef DEBUG_findPath
-  if (DEBUG_ON)  {
-    printf("DEBUG: (thread %2d) In findPath for path %d for iteration %d: fractionRecentIterationsWithoutPathDRCs = %6.3f.\n",
-           omp_get_thread_num(), pathNum, mapInfo->current_iteration, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
-    printf("DEBUG: (thread %2d)   fractionRecentIterationsWithoutMapDRCs = %6.3f.\n",
-           omp_get_thread_num(), routability->fractionRecentIterationsWithoutMapDRCs);
-  }
-  #endif
+  return(parent);
 
-  // Capture the swap-zone number of this path if its start-terminal is in a swap-zone. Otherwise,
-  // assign the swap-zone number to zero. (Even though a net's user-defined terminal might lie in
-  // a swap-zone, this function is also used to connect intermediate points along such paths. For
-  // these intermediate path-finding exercises, we don't want findPath to explore a swap-zone):
-  unsigned short pathSwapZone;
-  if (cellInfo[startCoord.X][startCoord.Y][startCoord.Z].swap_zone)  {
-    pathSwapZone = mapInfo->swapZone[pathNum];
-  }
+}  // End of function 'parentCell'
+
+
+//-----------------------------------------------------------------------------
+// Name: expandSearchBox
+// Desc: Expand the box between the coordinates 'searchMin' and 'searchMax' so
+//       that it contains cell (x,y,z).
+//-----------------------------------------------------------------------------
+static inline void expandSearchBox(Coordinate_t *searchMin, Coordinate_t *searchMax, const int x, const int y, const int z)  {
+
+  if (x < searchMin->X)  searchMin->X = x;
+  if (x > searchMax->X)  searchMax->X = x;
+  if (y < searchMin->Y)  searchMin->Y = y;
+  if (y > searchMax->Y)  searchMax->Y = y;
+  if (z < searchMin->Z)  searchMin->Z = z;
+  if (z > searchMax->Z)  searchMax->Z = z;
+
+}  // End of function 'expandSearchBox'
+
+
+//-----------------------------------------------------------------------------
+// Name: calc_previousPath_Gcost
+// Desc: Calculate the G-cost of the path in 'previousPathCoords', which has
+//       'previousPathLength' cells (excluding the start-coordinate), using the
+//       same rules (transitionIsAllowed) and the same G-costs as findPath()
+//       under the current congestion. Because this path is a feasible route
+//       from 'startCoord' to 'endCoord', its cost is an upper bound for the
+//       cost of the path that findPath() will find. Returns ULONG_MAX if the
+//       path does not run from 'startCoord' to 'endCoord' through allowed
+//       transitions, in which case it provides no bound.
+//-----------------------------------------------------------------------------
+static unsigned long calc_previousPath_Gcost(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                                             InputValues_t *user_inputs, const int pathNum,
+                                             const Coordinate_t startCoord, const Coordinate_t endCoord,
+                                             const Coordinate_t previousPathCoords[], const int previousPathLength,
+                                             const PathFinding_t *pathFinding, const RoutingRestriction_t *routingRestrictions,
+                                             const int recognizeSelfCongestion, const int random_reduction_flag,
+                                             const float congestion_scale_factor, const unsigned short pathSwapZone,
+                                             const int num_transitions, const int allowedTransitions[],
+                                             const int allowedDeltaX[], const int allowedDeltaY[], const int allowedDeltaZ[])  {
+
+  // The path must end at the end-coordinate:
+  if (   (previousPathLength <= 0)
+      || (previousPathCoords[previousPathLength - 1].X != endCoord.X)
+      || (previousPathCoords[previousPathLength - 1].Y != endCoord.Y)
+      || (previousPathCoords[previousPathLength - 1].Z != endCoord.Z))  {
+    return(ULONG_MAX);
+  }
+
+  unsigned long total_Gcost = 0;
+  Coordinate_t parent = startCoord;
+  for (int cellPosition = 0; cellPosition < previousPathLength; cellPosition++)  {
+    const Coordinate_t child = previousPathCoords[cellPosition];
+
+    // Find the transition that moves from the parent cell to the child cell:
+    int transitionIndex = -1;
+    for (int i = 0; i < num_transitions; i++)  {
+      if (   (child.X - parent.X == allowedDeltaX[i])
+          && (child.Y - parent.Y == allowedDeltaY[i])
+          && (child.Z - parent.Z == allowedDeltaZ[i]))  {
+        transitionIndex = i;
+        break;
+      }
+    }  // End of for-loop for index 'i'
+
+    int minimum_allowedRoutingDirections;
+    unsigned short shapeType;
+    if (   (transitionIndex < 0)
+        || (! transitionIsAllowed(mapInfo, cellInfo, user_inputs, pathNum, pathSwapZone, endCoord, routingRestrictions,
+                                  pathFinding, parent.X, parent.Y, parent.Z, transitionIndex, allowedTransitions[transitionIndex],
+                                  allowedDeltaX[transitionIndex], allowedDeltaY[transitionIndex], allowedDeltaZ[transitionIndex],
+                                  &minimum_allowedRoutingDirections, &shapeType)))  {
+      return(ULONG_MAX);
+    }
+
+    unsigned long congestion_penalty = calc_congestion_penalty(child.X, child.Y, child.Z, parent.X, parent.Y, parent.Z, pathNum,
+                                                               shapeType, cellInfo, user_inputs, mapInfo, FALSE, 0, recognizeSelfCongestion);
+    if (random_reduction_flag)  {
+      congestion_penalty = (long)(congestion_penalty * congestion_scale_factor);
+    }
+    total_Gcost += calc_distance_G_cost(child.X, child.Y, child.Z, parent.X, parent.Y, parent.Z, user_inputs, cellInfo, mapInfo, pathNum)
+                   + congestion_penalty;
+
+    parent = child;
+  }  // End of for-loop for index 'cellPosition'
+
+  return(total_Gcost);
+
+}  // End of function 'calc_previousPath_Gcost'
+
+
+//-----------------------------------------------------------------------------
+// Name: restorePreviousPath
+// Desc: Copy the path in 'previousPathCoords', which has 'previousPathLength'
+//       cells, to the path that findPath() returns in 'pathCoords' and
+//       'pathLength'. The two paths may share the same memory, in which case
+//       only the path-length is restored.
+//-----------------------------------------------------------------------------
+static void restorePreviousPath(Coordinate_t *pathCoords[], int *pathLength,
+                                const Coordinate_t previousPathCoords[], const int previousPathLength)  {
+
+  if (*pathCoords != previousPathCoords)  {
+    *pathCoords = realloc(*pathCoords, previousPathLength * sizeof(Coordinate_t));
+    if (*pathCoords == 0)  {
+      printf("\nERROR: Failed to re-allocate memory for 'pathCoords' array in function 'restorePreviousPath'.\n\n");
+      exit(1);
+    }
+    memcpy(*pathCoords, previousPathCoords, previousPathLength * sizeof(Coordinate_t));
+  }
+  *pathLength = previousPathLength;
+
+}  // End of function 'restorePreviousPath'
+
+
+//-----------------------------------------------------------------------------
+// Name: calc_findPath_heuristic
+// Desc: Return the H-cost used by findPath() between cell (x,y,z) and the
+//       target cell (targetX, targetY, targetZ). This is the geometric
+//       heuristic from calc_heuristic(), or the landmark-based lower bound
+//       from calc_landmark_heuristic() if the map has landmarks and that bound
+//       is larger. Both are lower bounds, so their maximum is also a lower bound.
+//       The landmarks are not used for paths that start in a pin-swap zone, i.e.,
+//       if 'pathSwapZone' is non-zero.
+//-----------------------------------------------------------------------------
+static unsigned long calc_findPath_heuristic(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                                             InputValues_t *user_inputs, const unsigned short pathSwapZone,
+                                             const int x, const int y, const int z,
+                                             const int targetX, const int targetY, const int targetZ,
+                                             const int routeDirections)  {
+
+  unsigned long H_value = calc_heuristic(x, y, z, targetX, targetY, targetZ, routeDirections, user_inputs, cellInfo);
+
+  if ((mapInfo->landmarks != NULL) && (pathSwapZone == 0))  {
+    H_value = max(H_value, calc_landmark_heuristic(mapInfo->landmarks, mapInfo, x, y, z, targetX, targetY, targetZ));
+  }
+
+  return(H_value);
+
+}  // End of function 'calc_findPath_heuristic'
+
+
+//-----------------------------------------------------------------------------
+// Name: BidirectionalSearch_t
+// Desc: State of a bidirectional search by findPathBidirectional(), shared by
+//       the functions that grow its two search trees. Index 0 of the arrays
+//       refers to the forward tree from the start-coordinate, and index 1 to
+//       the backward tree from the end-coordinate. When the two trees are
+//       grown by two threads at the same time, each thread writes only to the
+//       members of its own tree, except for 'bestCost', 'meetingCoord',
+//       'pathFound' and 'done', which are shared.
+//-----------------------------------------------------------------------------
+enum {FORWARD = 0, BACKWARD = 1};
+typedef struct BidirectionalSearch_t  {
+  // Parameters of the search, as passed to findPathBidirectional():
+  const MapInfo_t *mapInfo;
+  CellInfo_t ***cellInfo;
+  InputValues_t *user_inputs;
+  int pathNum;
+  PathFinding_t *pathFinding;
+  int record_explored_cells;
+  int useDijkstra;
+  const RoutingRestriction_t *routingRestrictions;
+  int recognizeSelfCongestion;
+  int random_reduction_flag;
+  float congestion_scale_factor;
+  unsigned short pathSwapZone;
+  int num_transitions;
+  const int *allowedTransitions;
+  const int *allowedDeltaX;
+  const int *allowedDeltaY;
+  const int *allowedDeltaZ;
+  unsigned long costBound;
+  Coordinate_t endCoord;
+
+  // Constants for the 'whichList' arrays, which share the search-generation of findPath():
+  unsigned short onOpenList;
+  unsigned short onClosedList;
+
+  // Per-tree state:
+  unsigned short *whichList[2];
+  unsigned long  *Gcost[2];
+  unsigned char  *parentDirection[2];
+  RadixHeap_t    *openList[2];
+  Coordinate_t    rootCoord[2];        // Root of each search tree
+  Coordinate_t    goalCoord[2];        // Target of each search tree's heuristic
+  int             numOpenCells[2];     // Number of distinct cells on each Open List
+  int             numExploredCells[2]; // Number of cells added to each Open List
+  Coordinate_t    searchMin[2];        // Box that contains the cells explored by each tree
+  Coordinate_t    searchMax[2];
+  unsigned long   topKey[2];           // Lowest sort-key on each Open List, as last published by
+                                       // the thread that grows the tree. Used only by two threads.
+
+  // Shared state:
+  unsigned long bestCost;      // Cost of the cheapest complete path found so far
+  int pathFound;               // TRUE if a path cheaper than 'costBound' was found
+  Coordinate_t meetingCoord;   // Cell at which the cheapest path joins the two trees
+  int done;                    // Set by either thread to stop both threads
+} BidirectionalSearch_t;
+
+
+//-----------------------------------------------------------------------------
+// Name: loadShared_ushort, storeShared_ushort, loadShared_ulong, storeShared_ulong
+// Desc: Read or write a value that the other thread of a bidirectional search
+//       can access at the same time. If 'concurrent' is FALSE, then only one
+//       thread grows the search trees, and the access is an ordinary one.
+//-----------------------------------------------------------------------------
+static inline unsigned short loadShared_ushort(const unsigned short *address, const int concurrent)  {
+  unsigned short value;
+  if (concurrent)  {
+    #pragma omp atomic read seq_cst
+    value = *address;
+  }
+  else  {
+    value = *address;
+  }
+  return(value);
+}
+
+static inline void storeShared_ushort(unsigned short *address, const unsigned short value, const int concurrent)  {
+  if (concurrent)  {
+    #pragma omp atomic write seq_cst
+    *address = value;
+  }
+  else  {
+    *address = value;
+  }
+}
+
+static inline unsigned long loadShared_ulong(const unsigned long *address, const int concurrent)  {
+  unsigned long value;
+  if (concurrent)  {
+    #pragma omp atomic read seq_cst
+    value = *address;
+  }
+  else  {
+    value = *address;
+  }
+  return(value);
+}
+
+static inline void storeShared_ulong(unsigned long *address, const unsigned long value, const int concurrent)  {
+  if (concurrent)  {
+    #pragma omp atomic write seq_cst
+    *address = value;
+  }
+  else  {
+    *address = value;
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: expandBidirectionalTree
+// Desc: Remove cell 'currentCoord' from the Open List of search tree 'dir' in
+//       'search', move it to the Closed List, and add its neighbors to the Open
+//       List. Whenever a neighbor has already been reached by the other tree,
+//       the path through the neighbor is a candidate for the best path. If
+//       Boolean parameter 'concurrent' is TRUE, then the other tree is being
+//       grown by another thread at the same time, so the cells that the two
+//       trees share are accessed atomically, and the best path is updated
+//       within a critical section.
+//-----------------------------------------------------------------------------
+static void expandBidirectionalTree(BidirectionalSearch_t *search, const int dir, const Coordinate_t currentCoord,
+                                    const int concurrent)  {
+
+  const int other = 1 - dir;
+  PathFinding_t *pathFinding = search->pathFinding;
+  unsigned short *whichList = search->whichList[dir];
+  unsigned long  *Gcost     = search->Gcost[dir];
+
+  const size_t currentIndex = pathFindingCoordIndex(pathFinding, currentCoord);
+  popRadixHeap(search->openList[dir]);
+  storeShared_ushort(&(whichList[currentIndex]), search->onClosedList, concurrent);
+  search->numOpenCells[dir]--;
+
+  for (int i = 0; i < search->num_transitions; i++)  {
+
+    // The forward tree moves from the current cell (parent) to its neighbor (child). The backward
+    // tree reaches the current cell (child) from its neighbor (parent) with the same transition:
+    const int sign = (dir == FORWARD) ? 1 : -1;
+    const int neighborX = currentCoord.X + sign * search->allowedDeltaX[i];
+    const int neighborY = currentCoord.Y + sign * search->allowedDeltaY[i];
+    const int neighborZ = currentCoord.Z + sign * search->allowedDeltaZ[i];
+    const int parentX = (dir == FORWARD) ? currentCoord.X : neighborX;
+    const int parentY = (dir == FORWARD) ? currentCoord.Y : neighborY;
+    const int parentZ = (dir == FORWARD) ? currentCoord.Z : neighborZ;
+
+    int minimum_allowedRoutingDirections;
+    unsigned short shapeType;
+    if (! transitionIsAllowed(search->mapInfo, search->cellInfo, search->user_inputs, search->pathNum, search->pathSwapZone,
+                              search->endCoord, search->routingRestrictions, pathFinding, parentX, parentY, parentZ, i,
+                              search->allowedTransitions[i], search->allowedDeltaX[i], search->allowedDeltaY[i],
+                              search->allowedDeltaZ[i], &minimum_allowedRoutingDirections, &shapeType))  {
+      continue;
+    }
+
+    const size_t neighborIndex = pathFindingIndex(pathFinding, neighborX, neighborY, neighborZ);
+    if (whichList[neighborIndex] == search->onClosedList)  {
+      continue;
+    }
+
+    // Calculate the G-cost of the move from parent to child, exactly as in findPath():
+    const int childX = parentX + search->allowedDeltaX[i];
+    const int childY = parentY + search->allowedDeltaY[i];
+    const int childZ = parentZ + search->allowedDeltaZ[i];
+    unsigned long congestion_penalty = calc_congestion_penalty(childX, childY, childZ, parentX, parentY, parentZ, search->pathNum,
+                                                               shapeType, search->cellInfo, search->user_inputs, search->mapInfo,
+                                                               FALSE, 0, search->recognizeSelfCongestion);
+    if (search->random_reduction_flag)  {
+      congestion_penalty = (long)(congestion_penalty * search->congestion_scale_factor);
+    }
+    unsigned long distance_G_cost = calc_distance_G_cost(childX, childY, childZ, parentX, parentY, parentZ,
+                                                         search->user_inputs, search->cellInfo, search->mapInfo, search->pathNum);
+    unsigned long neighborGcost = Gcost[currentIndex] + distance_G_cost + congestion_penalty;
+    if (neighborGcost < Gcost[currentIndex])  {
+      printf("\nERROR: An unexpected problem occurred. The variable 'neighborGcost' exceeded the maximum allowed value\n");
+      printf(  "       for a 64-bit unsigned integer at cell (%d,%d,%d) for net number %d in function findPathBidirectional.\n",
+             neighborX, neighborY, neighborZ, search->pathNum);
+      printf(  "       Please inform the software developer of this fatal error message. The program is exiting.\n\n");
+      exit(1);
+    }
+
+    // Skip the neighbor if it's already on the Open List with a lower or equal G-cost:
+    const int isOnOpenList = (whichList[neighborIndex] == search->onOpenList);
+    if (isOnOpenList && (neighborGcost >= Gcost[neighborIndex]))  {
+      continue;
+    }
+
+    // Heuristics towards this tree's goal and towards this tree's root:
+    unsigned long goalHcost = 0;
+    unsigned long rootHcost = 0;
+    if (! search->useDijkstra)  {
+      goalHcost = calc_findPath_heuristic(search->mapInfo, search->cellInfo, search->user_inputs, search->pathSwapZone,
+                                          neighborX, neighborY, neighborZ, search->goalCoord[dir].X, search->goalCoord[dir].Y,
+                                          search->goalCoord[dir].Z, minimum_allowedRoutingDirections);
+      rootHcost = calc_findPath_heuristic(search->mapInfo, search->cellInfo, search->user_inputs, search->pathSwapZone,
+                                          neighborX, neighborY, neighborZ, search->rootCoord[dir].X, search->rootCoord[dir].Y,
+                                          search->rootCoord[dir].Z, minimum_allowedRoutingDirections);
+    }
+
+    // Skip the neighbor if no path through it can be cheaper than the cost-bound:
+    if ((search->costBound != ULONG_MAX) && (neighborGcost + goalHcost >= search->costBound))  {
+      continue;
+    }
+
+    // Write the G-cost before the cell appears on the Open List, so that the other
+    // thread never reads a G-cost from an earlier search:
+    storeShared_ulong(&(Gcost[neighborIndex]), neighborGcost, concurrent);
+    search->parentDirection[dir][neighborIndex] = search->allowedTransitions[i];
+
+    if (! isOnOpenList)  {
+      storeShared_ushort(&(whichList[neighborIndex]), search->onOpenList, concurrent);
+      search->numOpenCells[dir]++;
+      search->numExploredCells[dir]++;
+      expandSearchBox(&(search->searchMin[dir]), &(search->searchMax[dir]), neighborX, neighborY, neighborZ);
+
+      // Flag the explored cells in the same manner as findPath():
+      if (search->record_explored_cells & 1)  {
+        search->cellInfo[neighborX][neighborY][neighborZ].explored = TRUE;
+      }
+      if (search->record_explored_cells & 2)  {
+        search->cellInfo[neighborX][neighborY][neighborZ].explored_PP = TRUE;
+      }
+    }  // End of if-block for a cell that's new to the Open List
+
+    Coordinate_t neighborCoord;
+    neighborCoord.X    = neighborX;
+    neighborCoord.Y    = neighborY;
+    neighborCoord.Z    = neighborZ;
+    neighborCoord.flag = FALSE;
+
+    // The sort-key is twice the G-cost plus the heuristic towards this tree's goal, minus the
+    // heuristic towards this tree's root. Averaging the two heuristics in this manner gives both
+    // trees the same reduced edge-costs, which allows the stopping rule in the calling functions:
+    long sortKey = 2 * neighborGcost + (long)goalHcost - (long)rootHcost;
+    pushRadixHeap(search->openList[dir], max(sortKey, 0), neighborCoord);
+
+    // If the other search tree has already reached this cell, then the two trees
+    // form a complete path through it:
+    const unsigned short otherList = loadShared_ushort(&(search->whichList[other][neighborIndex]), concurrent);
+    if ((otherList == search->onOpenList) || (otherList == search->onClosedList))  {
+      const unsigned long pathCost = neighborGcost + loadShared_ulong(&(search->Gcost[other][neighborIndex]), concurrent);
+      if (concurrent)  {
+        #pragma omp critical (bidirectionalBestCost)
+        {
+          if (pathCost < search->bestCost)  {
+            storeShared_ulong(&(search->bestCost), pathCost, TRUE);
+            search->meetingCoord = neighborCoord;
+            search->pathFound    = TRUE;
+          }
+        }  // End of critical section 'bidirectionalBestCost'
+      }
+      else if (pathCost < search->bestCost)  {
+        search->bestCost     = pathCost;
+        search->meetingCoord = neighborCoord;
+        search->pathFound    = TRUE;
+      }
+    }  // End of if-block for a cell that was reached by the other tree
+  }  // End of for-loop for index 'i' (0 to num_transitions)
+
+}  // End of function 'expandBidirectionalTree'
+
+
+//-----------------------------------------------------------------------------
+// Name: growBidirectionalTreesAlternately
+// Desc: Grow both search trees of 'search' in the calling thread, expanding
+//       the tree with the fewer cells on its Open List next, until the best
+//       path is known. If 'spareSearchThreads' is not NULL, then it points to
+//       a counter, shared by all threads, of idle threads that the search may
+//       borrow. If the function claims such a thread by decrementing the
+//       counter, it returns TRUE before the search is complete, so that the
+//       calling function can grow the two trees in parallel. Otherwise, it
+//       returns FALSE.
+//-----------------------------------------------------------------------------
+static int growBidirectionalTreesAlternately(BidirectionalSearch_t *search, int *spareSearchThreads)  {
+
+  do  {
+    const RadixHeapEntry_t *forwardTop  = peekRadixHeap(search->openList[FORWARD], search->pathFinding,
+                                                        search->whichList[FORWARD], search->onClosedList);
+    const RadixHeapEntry_t *backwardTop = peekRadixHeap(search->openList[BACKWARD], search->pathFinding,
+                                                        search->whichList[BACKWARD], search->onClosedList);
+
+    // If either Open List is empty, then every path has been considered:
+    if ((forwardTop == NULL) || (backwardTop == NULL))  {
+      break;
+    }
+
+    // Stopping rule: every path that has not been found yet passes through a cell on each Open
+    // List, so its cost is at least the lowest F-cost on either list:
+    if ((search->bestCost != ULONG_MAX) && (forwardTop->Fcost + backwardTop->Fcost >= 2 * search->bestCost))  {
+      break;
+    }
+
+    // If another thread has become idle, then claim it and return, so that the calling
+    // function continues the search with one thread per tree:
+    if (spareSearchThreads != NULL)  {
+      int numSpareThreads;
+      #pragma omp atomic read
+      numSpareThreads = *spareSearchThreads;
+      if (numSpareThreads > 0)  {
+        #pragma omp atomic capture
+        numSpareThreads = (*spareSearchThreads)--;
+        if (numSpareThreads > 0)  {
+          search->topKey[FORWARD]  = forwardTop->Fcost;
+          search->topKey[BACKWARD] = backwardTop->Fcost;
+          return(TRUE);
+        }
+        // Another search claimed the thread first, so give back the count:
+        #pragma omp atomic
+        (*spareSearchThreads)++;
+      }
+    }  // End of if-block for (spareSearchThreads != NULL)
+
+    // Expand the search tree with the smaller Open List:
+    const int dir = (search->numOpenCells[FORWARD] <= search->numOpenCells[BACKWARD]) ? FORWARD : BACKWARD;
+    expandBidirectionalTree(search, dir, (dir == FORWARD) ? forwardTop->coord : backwardTop->coord, FALSE);
+
+  } while (1);  // End of do/while-loop for growing the two search trees
+
+  return(FALSE);
+
+}  // End of function 'growBidirectionalTreesAlternately'
+
+
+//-----------------------------------------------------------------------------
+// Name: growBidirectionalTreeConcurrently
+// Desc: Grow search tree 'dir' of 'search' while another thread grows the
+//       other tree, until the best path is known. Each thread publishes the
+//       lowest sort-key on its Open List in 'search->topKey'. Because the
+//       sort-keys that a tree removes from its Open List never decrease, the
+//       most recently published key of the other tree is a lower bound for
+//       its current Open List, so the stopping rule of function
+//       growBidirectionalTreesAlternately() remains valid. Either thread
+//       stops both threads by setting 'search->done'.
+//-----------------------------------------------------------------------------
+static void growBidirectionalTreeConcurrently(BidirectionalSearch_t *search, const int dir)  {
+
+  const int other = 1 - dir;
+  int done;
+
+  do  {
+    #pragma omp atomic read
+    done = search->done;
+    if (done)  {
+      break;
+    }
+
+    const RadixHeapEntry_t *top = peekRadixHeap(search->openList[dir], search->pathFinding,
+                                                search->whichList[dir], search->onClosedList);
+
+    // If this tree's Open List is empty, then every path has been considered:
+    if (top == NULL)  {
+      #pragma omp atomic write
+      search->done = TRUE;
+      break;
+    }
+
+    // Publish this tree's lowest sort-key, and apply the stopping rule with the other tree's key:
+    storeShared_ulong(&(search->topKey[dir]), top->Fcost, TRUE);
+    const unsigned long otherTopKey = loadShared_ulong(&(search->topKey[other]), TRUE);
+    const unsigned long bestCost    = loadShared_ulong(&(search->bestCost), TRUE);
+    if ((bestCost != ULONG_MAX) && (top->Fcost + otherTopKey >= 2 * bestCost))  {
+      #pragma omp atomic write
+      search->done = TRUE;
+      break;
+    }
+
+    expandBidirectionalTree(search, dir, top->coord, TRUE);
+
+  } while (1);  // End of do/while-loop for growing search tree 'dir'
+
+}  // End of function 'growBidirectionalTreeConcurrently'
+
+
+//-----------------------------------------------------------------------------
+// Name: findPathBidirectional
+// Desc: Find a path from 'startCoord' to 'endCoord' by growing two A* search
+//       trees at the same time: a forward tree from the start-coordinate and a
+//       backward tree from the end-coordinate. This function is called by
+//       findPath() for paths whose 'bidirectional_search' flag is set, after
+//       findPath() has checked the terminals and prepared the shuffled
+//       transitions, the congestion scale-factor, and the path's swap-zone.
+//
+//       Each move is evaluated in the forward direction, from parent to child,
+//       with the same rules (transitionIsAllowed) and the same G-costs
+//       (calc_distance_G_cost and calc_congestion_penalty) as findPath(). The
+//       backward tree therefore explores the parents of its cells. The tree
+//       with the fewer cells on its Open List is expanded next. Whenever a cell
+//       is reached by both trees, the sum of its two G-costs is a candidate for
+//       the best path cost, 'bestCost'.
+//
+//       Each tree sorts its Open List by the average of the two heuristics,
+//       i.e., by 2*G + H(cell to goal) - H(cell to root). With this sort-key,
+//       both trees see the same reduced cost for every move, so the search can
+//       stop when the sum of the two lowest sort-keys is at least 2*bestCost.
+//
+//       If 'pathFinding->spareSearchThreads' is not NULL and another thread
+//       becomes idle during the search, then that thread is borrowed, and the
+//       two trees are grown in parallel by two threads for the rest of the
+//       search. The path then has the same cost, but may differ from the path
+//       of a single-threaded search if several paths have the same cost.
+//
+//       Both Open Lists are radix heaps, regardless of 'openList_engine'. The
+//       path is written to 'pathCoords' in the same format as findPath()
+//       (excluding the start-coordinate), and the number of explored cells is
+//       written to 'numExploredCells'. The box that contains the explored
+//       cells is written to 'searchMin' and 'searchMax'. Returns the G-cost of
+//       the path, or zero if no path was found.
+//
+//       If 'costBound' is less than ULONG_MAX, then only paths that are cheaper
+//       than 'costBound' are searched for, and zero is returned if none exists.
+//-----------------------------------------------------------------------------
+static unsigned long findPathBidirectional(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                       const int pathNum, const Coordinate_t startCoord, const Coordinate_t endCoord,
+                       Coordinate_t *pathCoords[], int *pathLength, InputValues_t *user_inputs,
+                       PathFinding_t *pathFinding, const int record_explored_cells, const int useDijkstra,
+                       const RoutingRestriction_t *routingRestrictions, const int recognizeSelfCongestion,
+                       const int random_reduction_flag, const float congestion_scale_factor,
+                       const unsigned short pathSwapZone, const int num_transitions, const int allowedTransitions[],
+                       const int allowedDeltaX[], const int allowedDeltaY[], const int allowedDeltaZ[],
+                       const unsigned long costBound, int *numExploredCells,
+                       Coordinate_t *searchMin, Coordinate_t *searchMax)  {
+
+  // Allocate the backward search tree if this is the first bidirectional search with this structure:
+  allocateReversePathFindingArrays(pathFinding);
+
+  BidirectionalSearch_t search;
+  search.mapInfo                 = mapInfo;
+  search.cellInfo                = cellInfo;
+  search.user_inputs             = user_inputs;
+  search.pathNum                 = pathNum;
+  search.pathFinding             = pathFinding;
+  search.record_explored_cells   = record_explored_cells;
+  search.useDijkstra             = useDijkstra;
+  search.routingRestrictions     = routingRestrictions;
+  search.recognizeSelfCongestion = recognizeSelfCongestion;
+  search.random_reduction_flag   = random_reduction_flag;
+  search.congestion_scale_factor = congestion_scale_factor;
+  search.pathSwapZone            = pathSwapZone;
+  search.num_transitions         = num_transitions;
+  search.allowedTransitions      = allowedTransitions;
+  search.allowedDeltaX           = allowedDeltaX;
+  search.allowedDeltaY           = allowedDeltaY;
+  search.allowedDeltaZ           = allowedDeltaZ;
+  search.costBound               = costBound;
+  search.endCoord                = endCoord;
+  search.onOpenList              = 2 * pathFinding->searchGeneration;
+  search.onClosedList            = 2 * pathFinding->searchGeneration + 1;
+
+  search.whichList[FORWARD]     = pathFinding->whichList;
+  search.whichList[BACKWARD]    = pathFinding->whichList_reverse;
+  search.Gcost[FORWARD]         = pathFinding->Gcost;
+  search.Gcost[BACKWARD]        = pathFinding->Gcost_reverse;
+  search.parentDirection[FORWARD]  = pathFinding->parentDirection;
+  search.parentDirection[BACKWARD] = pathFinding->parentDirection_reverse;
+  search.openList[FORWARD]      = &(pathFinding->radixHeap);
+  search.openList[BACKWARD]     = &(pathFinding->radixHeap_reverse);
+  search.rootCoord[FORWARD]     = startCoord;
+  search.rootCoord[BACKWARD]    = endCoord;
+  search.goalCoord[FORWARD]     = endCoord;
+  search.goalCoord[BACKWARD]    = startCoord;
+
+  // Place the root of each search tree on its Open List:
+  for (int dir = FORWARD; dir <= BACKWARD; dir++)  {
+    size_t rootIndex = pathFindingCoordIndex(pathFinding, search.rootCoord[dir]);
+    emptyRadixHeap(search.openList[dir]);
+    search.whichList[dir][rootIndex]    = search.onOpenList;
+    search.Gcost[dir][rootIndex]        = 0;
+    search.parentDirection[dir][rootIndex] = NO_PARENT;
+    pushRadixHeap(search.openList[dir], 0, search.rootCoord[dir]);
+    search.numOpenCells[dir]     = 1;
+    search.numExploredCells[dir] = 0;
+    search.searchMin[dir]        = startCoord;
+    search.searchMax[dir]        = startCoord;
+    expandSearchBox(&(search.searchMin[dir]), &(search.searchMax[dir]), endCoord.X, endCoord.Y, endCoord.Z);
+    search.topKey[dir]           = 0;
+  }  // End of for-loop for index 'dir'
+
+  // Cost of the cheapest complete path found so far. If a cost-bound was provided, then
+  // only paths that are cheaper than the bound are of interest:
+  search.bestCost     = costBound;
+  search.pathFound    = FALSE;
+  search.meetingCoord = startCoord;
+  search.done         = FALSE;
+
+  //
+  // Grow the two trees in this thread. If an idle thread was claimed before the search was
+  // complete, then grow each tree in its own thread for the rest of the search:
+  //
+  if (growBidirectionalTreesAlternately(&search, pathFinding->spareSearchThreads))  {
+    printf("INFO: (thread %2d) Path %d continues its bidirectional search with a second thread after exploring %'d cells.\n",
+           omp_get_thread_num(), pathNum, search.numExploredCells[FORWARD] + search.numExploredCells[BACKWARD]);
+
+    #pragma omp parallel num_threads(2)
+    {
+      // Nested parallelism may provide fewer threads than requested:
+      if (omp_get_num_threads() == 2)  {
+        growBidirectionalTreeConcurrently(&search, omp_get_thread_num());
+      }
+      else  {
+        growBidirectionalTreesAlternately(&search, NULL);
+      }
+    }  // End of parallel block
+
+    // Return the borrowed thread:
+    #pragma omp atomic
+    (*(pathFinding->spareSearchThreads))++;
+  }  // End of if-block for growing the trees with two threads
+
+  *numExploredCells = search.numExploredCells[FORWARD] + search.numExploredCells[BACKWARD];
+  *searchMin = search.searchMin[FORWARD];
+  *searchMax = search.searchMax[FORWARD];
+  expandSearchBox(searchMin, searchMax, search.searchMin[BACKWARD].X, search.searchMin[BACKWARD].Y, search.searchMin[BACKWARD].Z);
+  expandSearchBox(searchMin, searchMax, search.searchMax[BACKWARD].X, search.searchMax[BACKWARD].Y, search.searchMax[BACKWARD].Z);
+
+  if (! search.pathFound)  {
+    return(0);
+  }
+
+  //
+  // Count the cells in the forward part of the path, from the meeting cell back to (but not
+  // including) the start-coordinate, and in the backward part, from the meeting cell (not
+  // included) to the end-coordinate:
+  //
+  const unsigned char * const parentDirection[2] = {search.parentDirection[FORWARD], search.parentDirection[BACKWARD]};
+  const Coordinate_t meetingCoord = search.meetingCoord;
+  int numForwardCells = 0;
+  Coordinate_t coord = meetingCoord;
+  while ((coord.X != startCoord.X) || (coord.Y != startCoord.Y) || (coord.Z != startCoord.Z))  {
+    numForwardCells++;
+    coord = parentCell(coord, parentDirection[FORWARD][pathFindingCoordIndex(pathFinding, coord)], -1);
+  }
+  int numBackwardCells = 0;
+  coord = meetingCoord;
+  while ((coord.X != endCoord.X) || (coord.Y != endCoord.Y) || (coord.Z != endCoord.Z))  {
+    numBackwardCells++;
+    coord = parentCell(coord, parentDirection[BACKWARD][pathFindingCoordIndex(pathFinding, coord)], +1);
+  }
+
+  *pathLength = numForwardCells + numBackwardCells;
+  *pathCoords = realloc(*pathCoords, *pathLength * sizeof(Coordinate_t));
+  if (*pathCoords == 0)  {
+    printf("\nERROR: Failed to re-allocate memory for 'pathCoords' array in function 'findPathBidirectional'.\n\n");
+    exit(1);
+  }
+
+  // Copy the forward part of the path in reverse order, ending with the meeting cell:
+  coord = meetingCoord;
+  for (int cellPosition = numForwardCells - 1; cellPosition >= 0; cellPosition--)  {
+    (*pathCoords)[cellPosition]      = coord;
+    (*pathCoords)[cellPosition].flag = FALSE;
+    coord = parentCell(coord, parentDirection[FORWARD][pathFindingCoordIndex(pathFinding, coord)], -1);
+  }
+
+  // Copy the backward part of the path, which follows the meeting cell:
+  coord = meetingCoord;
+  for (int cellPosition = numForwardCells; cellPosition < *pathLength; cellPosition++)  {
+    coord = parentCell(coord, parentDirection[BACKWARD][pathFindingCoordIndex(pathFinding, coord)], +1);
+    (*pathCoords)[cellPosition]      = coord;
+    (*pathCoords)[cellPosition].flag = FALSE;
+  }
+
+  return(search.bestCost);
+
+}  // End of function 'findPathBidirectional'
+
+
+//-----------------------------------------------------------------------------
+// Name: cellBlocksTrace
+// Desc: Return TRUE if a trace of path 'pathNum' may not traverse cell (x,y,z)
+//       because the cell is in a user-defined barrier, or too close to a
+//       barrier or the map's edge. The 48-bit proximity field in 'cellInfo' is
+//       read only if the cell is near a barrier for any design-rule subset.
+//-----------------------------------------------------------------------------
+static inline int cellBlocksTrace(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                                  const InputValues_t *user_inputs, int x, int y, int z, int pathNum)  {
+
+  const CellRoutingInfo_t routingInfo = getCellRoutingInfo(mapInfo, cellInfo, x, y, z);
+
+  return(   routingInfo.forbiddenTraceBarrier
+         || (routingInfo.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, x, y, z, pathNum, TRACE)));
+
+}  // End of function 'cellBlocksTrace'
+
+
+//-----------------------------------------------------------------------------
+// Name: findPath
+// Desc: Finds a path using A* algorithm. The information in structure
+//       'routingRestrictions' is used to limit the lateral search within a
+//       given distance of a given (x,y) coordinate on a given layer, or within
+//       a corridor around the path from the previous iteration. This
+//       function returns the G-cost of the path, which will be zero if no
+//       path was found. The 'record_explored_cells' parameter tells function
+//       which cells to flag as having been explored:
+//
+//       record_explored_cells   Action
+//       ---------------------   ---------------------------------------------
+//                 0             Record no explored cells
+//                 1             Record explored cells in '.explored' variable
+//                 2             Record explored cells in '.explored_PP' variable
+//                 3             Record explored cells in '.explored' and
+//                               in '.explored_PP' variables
+//
+//       If Boolean parameter 'record_elapsed_time' is TRUE, then the elapsed
+//       (wall-clock) time for finding the path will be saved in variable:
+//       routability->path_elapsed_time[pathNum].
+//
+//       If Boolean input parameter 'useDijkstra' is TRUE, then this function
+//       uses a heuristic value of zero. Otherwise, it uses a heuristic that
+//       depends on the distance to the target and the DRC histories of the
+//       routed path and of other paths in the map.
+//
+//       If Boolean parameter 'disableRandomCosts' is TRUE, then findPath()
+//       disables any randomized changes to the congestion-related G-cost.
+//
+//       If 'previousPathCoords' is not NULL, then it contains a previous path
+//       with 'previousPathLength' cells between the same terminals, such as
+//       the path from the previous iteration. The G-cost of this path under
+//       the current congestion is an upper bound for the new path, so cells
+//       whose F-cost reaches this bound are not added to the Open List. If no
+//       cheaper path exists, then the previous path is returned again.
+//
+//-----------------------------------------------------------------------------
+//
+// Define 'DEBUG_findPath' and re-compile if you want verbose debugging print-statements enabled:
+//
+// #define DEBUG_findPath 1
+#undef DEBUG_findPath
+
+unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                       int pathNum, const Coordinate_t startCoord, const Coordinate_t endCoord,
+                       Coordinate_t *pathCoords[], int *pathLength, InputValues_t *user_inputs,
+                       RoutingMetrics_t *routability, PathFinding_t *pathFinding, const int record_explored_cells,
+                       const int record_elapsed_time, const int useDijkstra, const RoutingRestriction_t *routingRestrictions,
+                       const int disableRandomCosts, const int recognizeSelfCongestion,
+                       const Coordinate_t *previousPathCoords, const int previousPathLength)  {
+
+  // Return-value to inform the calling routine that the start-
+  // and end-coordinates are identical:
+  const int zeroLength = 0;
+
+  // Value to assign to 'pathLength' before/until a path is found:
+  const int notStarted = 0;
+
+  // Constants for the variable 'path':
+  const int nonexistent = 0;
+  const int found = 1;
+
+
+  #ifdef DEBUG_findPath
+  // DEBUG code follows:
+  //
+  // For very large maps, define here the 3-dimensional window in (x,y,z) for which you want
+  // detailed information sent to the log file. Without these constraints, the log file can
+  // grow to >10 gigabytes:
+  int x_window_min =    0;
+  int x_window_max =  200;
+  int y_window_min =    0;
+  int y_window_max =  300;
+  int z_window_min =    0;
+  int z_window_max =    5;
+  //
+  // Check if the input parameters satisfy specific requirements. If so, then set the
+  // 'DEBUG_ON' flag to TRUE so that this function will print out additional debug information:
+  int DEBUG_ON = FALSE;
+  int DEBUG_CRITERIA_MET = FALSE;
+  if ((mapInfo->current_iteration >= 1) && (mapInfo->current_iteration <= 288) && ((pathNum == 0) || (pathNum == 0)))  {
+    printf("\n\nDEBUG: (thread %2d) Setting DEBUG_ON to TRUE in findPath() because specific requirements were met.\n\n", omp_get_thread_num());
+    DEBUG_ON = TRUE;  // TRUE for now, but will be set to FALSE for certain x/y/z coordinates
+    DEBUG_CRITERIA_MET = TRUE;  // TRUE throughout this function, regardless of x/y/z coordinates
+  }  // End of if-block for determining whether to set DEBUG_ON to TRUE
+
+  // DEBUG code follows:
+  if (DEBUG_ON)  {
+    time_t tim = time(NULL);
+    struct tm *now = localtime(&tim);
+    printf("\nDEBUG: Entered 'findPath' at %02d-%02d-%d, %02d:%02d in thread %d for path %d from (%d,%d,%d) to (%d,%d,%d)...\n",
+           now->tm_mon+1, now->tm_mday, now->tm_year+1900, now->tm_hour, now->tm_min, omp_get_thread_num(),
+           pathNum, startCoord.X, startCoord.Y, startCoord.Z, endCoord.X, endCoord.Y, endCoord.Z);
+    if (routingRestrictions->restrictionFlag)  {
+      printf("DEBUG: (thread %2d)\n", omp_get_thread_num());
+      printf("DEBUG: (thread %2d) Routing restrictions are in effect:\n", omp_get_thread_num());
+      printf("DEBUG: (thread %2d)     centerX: %d\n", omp_get_thread_num(), routingRestrictions->centerX);
+      printf("DEBUG: (thread %2d)     centerY: %d\n", omp_get_thread_num(), routingRestrictions->centerY);
+      for (int layer = 0; layer < mapInfo->numLayers; layer++)  {
+        if (routingRestrictions->allowedLayers[layer])
+          printf("DEBUG: (thread %2d) layer %d: routing ALLOWED with radius %6.3f microns (%6.3f cells)\n",
+                 omp_get_thread_num(), layer, routingRestrictions->allowedRadiiMicrons[layer], routingRestrictions->allowedRadiiCells[layer]);
+        else
+        printf("DEBUG: (thread %2d) layer %d: routing NOT ALLOWED\n", omp_get_thread_num(), layer);
+      }
+    }
+    else  {
+      printf("DEBUG: (thread %2d) No routing restrictions are in effect.\n", omp_get_thread_num());
+    }
+    printf("DEBUG: (thread %2d)\n", omp_get_thread_num());
+  }
+  // End of DEBUG code.
+  #endif
+
+
+  // Keep track of how much elapsed time this call to function 'findPath' uses:
+  time_t start, end;
+  start = time(NULL); // Get number of seconds since the Epoch (Jan 1, 1970)
+
+  // Create arrays that define the 18 allowed transitions from one cell to another cell:
+  int num_transitions = 18;
+  int allowedTransitions[] = {E,  N,  W,  S, NE, SE, NW, SW, NxNE, ExNE, ExSE, SxSE, SxSW, WxSW, WxNW, NxNW,   Up, Down};
+  int allowedDeltaX[]      = {1,  0, -1,  0,  1,  1, -1, -1,    1,    2,    2,    1,   -1,   -2,   -2,   -1,    0,    0};
+  int allowedDeltaY[]      = {0,  1,  0, -1,  1, -1,  1, -1,    2,    1,   -1,   -2,   -2,   -1,    1,    2,    0,    0};
+  int allowedDeltaZ[]      = {0,  0,  0,  0,  0,  0,  0,  0,    0,    0,    0,    0,    0,    0,    0,    0,    1,   -1};
+
+  // After the first iteration, shuffle the sequence of the above arrays so that the child-cells
+  // are explored in a pseudo-random order each time this function is called. The seed for the
+  // pseudo-random number generator is the cost of this path (in cell units) from the most recent
+  // iteration. The for-loops below use the Fisher�Yates shuffle algorithm.
+  if (mapInfo->current_iteration > 1)  {
+    unsigned int seed = abs((unsigned int) routability->path_cost[pathNum]);
+    // printf("DEBUG: (thread %2d) Seed for pseudo-random numbers is %'d for path %d ( = cost from previous iteration)\n",
+    //         omp_get_thread_num(), seed, pathNum);
+
+    for (int i = num_transitions - 1; i > 0; i--)  {
+      // Generate a random index value from 0 to i
+      int j = rand_r(&seed) % (i + 1);
+
+      // Exchange elements for 'allowedTransitions' array:
+      int temp = allowedTransitions[j];
+      allowedTransitions[j] = allowedTransitions[i];
+      allowedTransitions[i] = temp;
+
+      // Exchange elements for 'allowedDeltaX' array:
+      temp = allowedDeltaX[j];
+      allowedDeltaX[j] = allowedDeltaX[i];
+      allowedDeltaX[i] = temp;
+
+      // Exchange elements for 'allowedDeltaY' array:
+      temp = allowedDeltaY[j];
+      allowedDeltaY[j] = allowedDeltaY[i];
+      allowedDeltaY[i] = temp;
+
+      // Exchange elements for 'allowedDeltaZ' array:
+      temp = allowedDeltaZ[j];
+      allowedDeltaZ[j] = allowedDeltaZ[i];
+      allowedDeltaZ[i] = temp;
+    }  // End of for-loop for index 'i' to shuffle arrays
+  }  // End of if-block for current_iteration > 1
+
+  // Tabulate the allowed routing directions for this path for each pair of design-rule sets, so
+  // the loop over child cells needs only one table look-up per transition:
+  calcAllowedTransitionMasks(pathFinding, pathNum, user_inputs, num_transitions, allowedDeltaX, allowedDeltaY, allowedDeltaZ);
+
+
+  #ifdef DEBUG_findPath
+  if (DEBUG_ON)  {
+    printf("\nDEBUG: (thread %2d) In iteration #%d, the sequence of child-cell exploration for path %d follows:\n",
+           omp_get_thread_num(), mapInfo->current_iteration, pathNum);
+    for (int i = 0; i < num_transitions; i++)  {
+      printf("DEBUG: (thread %2d)     (delta-X, delta-Y, delta-Z) = (%d,%d,%d)\n", omp_get_thread_num(), allowedDeltaX[i], allowedDeltaY[i], allowedDeltaZ[i]);
+    }  // End of for-loop for index 'i'
+    printf("DEBUG: (thread %2d) ----------------------\n", omp_get_thread_num());
+  }
+  #endif
+
+  // Fetch the Boolean flag (randomize_congestion) that determines whether the current
+  // path was randomly selected to have its congestion-related G-cost increased or reduced:
+  int random_reduction_flag;
+  if (disableRandomCosts)  {
+    random_reduction_flag = FALSE;
+  }
+  else  {
+    random_reduction_flag = routability->randomize_congestion[pathNum];
+  }
+
+  // If this path was randomly selected to have it's congestion-related G-cost modified, then
+  // calculate the scaling factor, which ranges from 0.02 to 1.00 (for reductions), or from
+  // 1.00 to 4.0 (for increases), based on the history of DRC violations in the map and
+  // history of DRC violations for this specific path. Also disable any routing restrictions
+  // for this pseudo-randomly selected path:
+  float congestion_scale_factor = 1.0;
+  if (random_reduction_flag)  {
+
+    // We got here, so the random_reduction_flag equals either 'DECREASE' or 'INCREASE'
+
+    // Reduce the 'congestion_scale_factor' if the flag is set to 'DECREASE':
+    if (random_reduction_flag == DECREASE)  {
+
+      congestion_scale_factor = 1.0 - 0.98  *  (1.0   -   0.2 * routability->fractionRecentIterationsWithoutMapDRCs)
+                                            *  (1.0   -         routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+
+      #ifdef DEBUG_findPath
+      if (DEBUG_ON)  {
+        printf("\nDEBUG (thread %2d): Randomly decreasing congestion_scale_factor in findPath: congestion_scale_factor = %.4f for path %d in iter #%d, with recent map DRC-free fraction=%1.3f and path DRC-free fraction=%1.3f\n\n",
+               omp_get_thread_num(), congestion_scale_factor, pathNum, mapInfo->current_iteration,
+               routability->fractionRecentIterationsWithoutMapDRCs, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+      }
+      #endif
+
+    }  // End of if-block for (random_reduction_flag == DECREASE)
+
+    // Increase the 'congestion_scale_factor' because the flag is set to 'INCREASE':
+    else  {
+
+      congestion_scale_factor = 1.0 +  4.0  *  (1.0   -   0.2 * routability->fractionRecentIterationsWithoutMapDRCs)
+                                            *  (1.0   -         routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+
+      #ifdef DEBUG_findPath
+      if (DEBUG_ON)  {
+        printf("\nDEBUG (thread %2d): Randomly increasing congestion_scale_factor in findPath:, congestion_scale_factor = %.4f for path %d in iter #%d, with recent map DRC-free fraction=%1.3f and path DRC-free fraction=%1.3f\n\n",
+               omp_get_thread_num(), congestion_scale_factor, pathNum, mapInfo->current_iteration,
+               routability->fractionRecentIterationsWithoutMapDRCs, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+      }
+      #endif
+    }  // End of else-block for (random_reduction_flag == INCREASE)
+  }  // End of if-block for random_reduction_flag != zero
+
+  // Define variable that will hold the congestion-related G-cost:
+  unsigned long congestion_penalty;
+
+  #ifdef DEBUG_findPath
+  if (DEBUG_ON)  {
+    printf("DEBUG: (thread %2d) In findPath for path %d for iteration %d: fractionRecentIterationsWithoutPathDRCs = %6.3f.\n",
+           omp_get_thread_num(), pathNum, mapInfo->current_iteration, routability->fractionRecentIterationsWithoutPathDRCs[pathNum]);
+    printf("DEBUG: (thread %2d)   fractionRecentIterationsWithoutMapDRCs = %6.3f.\n",
+           omp_get_thread_num(), routability->fractionRecentIterationsWithoutMapDRCs);
+  }
+  #endif
+
+  // Capture the swap-zone number of this path if its start-terminal is in a swap-zone. Otherwise,
+  // assign the swap-zone number to zero. (Even though a net's user-defined terminal might lie in
+  // a swap-zone, this function is also used to connect intermediate points along such paths. For
+  // these intermediate path-finding exercises, we don't want findPath to explore a swap-zone):
+  unsigned short pathSwapZone;
+  if (cellInfo[startCoord.X][startCoord.Y][startCoord.Z].swap_zone)  {
+    pathSwapZone = mapInfo->swapZone[pathNum];
+  }
   else  {
     // The user-defined terminal might lie in a pin-swap zone, but not the start-coordinate
     // for this path-finding run. So we assign 'pathSwapZone' to zero, thereby preventing findPath()
@@ -2124,6 +3211,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
   cellPosition, newOpenListItemID=0;
   unsigned long tempGcost = 0;
   int tempx, tempy, tempz, pathX, pathY, pathZ;
+  size_t parentIndex = 0;  // Index of the parent cell in the flat path-finding arrays
 
   // Returned result from this function:
   unsigned long path = 0;
@@ -2131,9 +3219,15 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
   // Variable to record the final path's total G-cost:
   unsigned long total_Gcost = 0;
 
-  // Initialize the 'whichList' and 'sortNumber' arrays:
+  // Start a new search-generation for the 'whichList' array:
   initializePathFindingArrays(pathFinding, mapInfo);
 
+  // Constants for the 'pathFinding->whichList[]' array. These values are unique to the
+  // current search-generation, so cells that were written by previous calls to findPath()
+  // are treated as being on neither the Open List nor the Closed List:
+  const unsigned short onOpenList   = 2 * pathFinding->searchGeneration;      // Denotes that cell is on the Open List
+  const unsigned short onClosedList = 2 * pathFinding->searchGeneration + 1;  // Denotes that cell is on the Closed List
+
   #ifdef DEBUG_findPath
   if (DEBUG_ON)  {
     printf("DEBUG: (thread %2d) In iteration #%d, searching for path %d from (%d, %d, %d) to (%d, %d, %d)...\n",
@@ -2255,8 +3349,64 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
     }
   }  // End of block for checking start- and end-coordinates for 'NONE' routing direction
 
+  // Index the path-finding arrays over only the cells that the restrictions allow
+  // this search to reach:
+  setSearchWindow(pathFinding, mapInfo, routingRestrictions, pathSwapZone, startCoord, endCoord);
+
   *pathLength = notStarted; // i.e, = 0
-  pathFinding->Gcost[startCoord.X][startCoord.Y][startCoord.Z] = 0; // Reset starting square's G value to 0
+  pathFinding->Gcost[pathFindingCoordIndex(pathFinding, startCoord)] = 0; // Reset starting square's G value to 0
+
+  //
+  // If a previous path was provided, then calculate its G-cost under the current congestion.
+  // No path whose cost reaches this value needs to be explored, because the previous path
+  // would be at least as good. A value of ULONG_MAX means that there is no bound:
+  //
+  unsigned long costBound = ULONG_MAX;
+  if (previousPathCoords != NULL)  {
+    costBound = calc_previousPath_Gcost(mapInfo, cellInfo, user_inputs, pathNum, startCoord, endCoord, previousPathCoords,
+                                        previousPathLength, pathFinding, routingRestrictions, recognizeSelfCongestion,
+                                        random_reduction_flag, congestion_scale_factor, pathSwapZone, num_transitions,
+                                        allowedTransitions, allowedDeltaX, allowedDeltaY, allowedDeltaZ);
+  }
+
+  // Box that contains the cells explored by the search, starting with the two terminals:
+  Coordinate_t searchMin = startCoord;
+  Coordinate_t searchMax = startCoord;
+  expandSearchBox(&searchMin, &searchMax, endCoord.X, endCoord.Y, endCoord.Z);
+
+  //
+  // For paths that explored many cells in the previous iteration, search from both ends of
+  // the path at the same time. This search uses the same routing rules and G-costs as the
+  // unidirectional search below, but typically explores fewer cells:
+  //
+  if (routability->bidirectional_search[pathNum])  {
+    total_Gcost = findPathBidirectional(mapInfo, cellInfo, pathNum, startCoord, endCoord, pathCoords, pathLength,
+                                        user_inputs, pathFinding, record_explored_cells, useDijkstra, routingRestrictions,
+                                        recognizeSelfCongestion, random_reduction_flag, congestion_scale_factor,
+                                        pathSwapZone, num_transitions, allowedTransitions, allowedDeltaX, allowedDeltaY,
+                                        allowedDeltaZ, costBound, &newOpenListItemID,
+                                        &(routability->path_search_min[pathNum]), &(routability->path_search_max[pathNum]));
+    routability->path_explored_cells[pathNum] = newOpenListItemID;
+
+    // If no path is cheaper than the previous path, then return the previous path again:
+    if ((total_Gcost == 0) && (costBound != ULONG_MAX))  {
+      restorePreviousPath(pathCoords, pathLength, previousPathCoords, previousPathLength);
+      total_Gcost = costBound;
+    }
+
+    if (total_Gcost == 0)  {
+      *pathLength = notStarted;
+      goto noPath;
+    }
+
+    // Calculate elapsed (wall-clock) time to find this path:
+    if (record_elapsed_time)  {
+      end = time(NULL);
+      routability->path_elapsed_time[pathNum] = (int) (end - start);
+    }
+
+    return(total_Gcost);
+  }  // End of if-block for bidirectional_search
 
   #ifdef DEBUG_findPath
   if (DEBUG_ON)  {
@@ -2266,13 +3416,20 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
   // Step 2: Add the starting location to the open list of squares to be checked.
   numberOfOpenListItems = 1;
-  pathFinding->openList[1] = 1;  // Assign it as the top (and currently only) item in the open list,
-                                 // which is maintained as a binary heap (explained below)
   pathFinding->openListCoords[1].X = startCoord.X;
   pathFinding->openListCoords[1].Y = startCoord.Y;
   pathFinding->openListCoords[1].Z = startCoord.Z;
-  // Capture the current sort-number for the first item, indexed by the (x,y,z) coordinate
-  pathFinding->sortNumber[startCoord.X][startCoord.Y][startCoord.Z] = 1;
+  if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+    // Entries in the radix heap carry their own coordinates, so neither an ID number
+    // nor a sort-number is needed:
+    pushRadixHeap(&(pathFinding->radixHeap), 0, startCoord);
+  }
+  else  {
+    pathFinding->openList[1] = 1;  // Assign it as the top (and currently only) item in the open list,
+                                   // which is maintained as a binary heap (explained below)
+    // Capture the current sort-number for the first item, indexed by the (x,y,z) coordinate
+    pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, startCoord)] = 1;
+  }
 
   #ifdef DEBUG_findPath
   if (DEBUG_ON)  {
@@ -2285,16 +3442,31 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
   do  {
 
     // Step 4: If the open list is not empty, take the first cell off of the list.
-    //    This is the lowest F cost cell on the open list.
-    if (numberOfOpenListItems != 0)  {
+    //    This is the lowest F cost cell on the open list. For the radix-heap engine,
+    //    entries for cells that already reached the Closed List are discarded while
+    //    looking for this cell.
+    Coordinate_t topCoord = {0};
+    int openListIsEmpty;
+    if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+      const RadixHeapEntry_t *radixHeapTop = peekRadixHeap(&(pathFinding->radixHeap), pathFinding, pathFinding->whichList, onClosedList);
+      openListIsEmpty = (radixHeapTop == NULL);
+      if (! openListIsEmpty)
+        topCoord = radixHeapTop->coord;
+    }
+    else  {
+      openListIsEmpty = (numberOfOpenListItems == 0);
+      topCoord = pathFinding->openListCoords[pathFinding->openList[1]];
+    }
+
+    if (! openListIsEmpty)  {
 
       // Step 5: Pop the first item off the open list.
-      parentXval = pathFinding->openListCoords[pathFinding->openList[1]].X;
-      parentYval = pathFinding->openListCoords[pathFinding->openList[1]].Y;
-      parentZval = pathFinding->openListCoords[pathFinding->openList[1]].Z; // Record cell coordinates of the item
+      parentXval = topCoord.X;
+      parentYval = topCoord.Y;
+      parentZval = topCoord.Z; // Record cell coordinates of the item
+      parentIndex = pathFindingIndex(pathFinding, parentXval, parentYval, parentZval);
 
-      pathFinding->whichList[parentXval][parentYval][parentZval] = onClosedList; // Add the item to the closed list
-      pathFinding->sortNumber[parentXval][parentYval][parentZval] = 0;  // Since this cell is no longer on open list, change its sort number to zero.
+      pathFinding->whichList[parentIndex] = onClosedList; // Add the item to the closed list
 
       #ifdef DEBUG_findPath
       if (   DEBUG_CRITERIA_MET
@@ -2316,87 +3488,101 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
       }
       #endif
 
-      //  Open List = Binary Heap: Delete this item from the open list, which
-      //  is maintained as a binary heap. For more information on binary heaps, see:
-      //  http://www.policyalmanac.org/games/binaryHeaps.htm
-      numberOfOpenListItems = numberOfOpenListItems - 1; //reduce number of open list items by 1
-
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("DEBUG: (thread %2d) After removing (%d,%d,%d) from Open List, numberOfOpenListItems = %d\n", omp_get_thread_num(), parentXval, parentYval,
-               parentZval, numberOfOpenListItems);
+      if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+        // Remove the entry from the radix heap. Any other entries for this cell will
+        // be discarded when they reach the top of the heap:
+        popRadixHeap(&(pathFinding->radixHeap));
       }
-      #endif
+      else  {
+        pathFinding->sortNumber[parentIndex] = 0;  // Since this cell is no longer on open list, change its sort number to zero.
 
-      //  Delete the top item in binary heap and reorder the heap, with the
-      //  lowest F-cost item rising to the top.
-      pathFinding->openList[1] = pathFinding->openList[numberOfOpenListItems+1]; // Move the last item in the heap up to slot #1
-      pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[1]].X][pathFinding->openListCoords[pathFinding->openList[1]].Y][pathFinding->openListCoords[pathFinding->openList[1]].Z] = 1;
-
-      v = 1;
-
-      //  Repeat the following until the new item in slot #1 sinks to its proper spot in the heap.
-      do  {
-        u = v;
-        if (2*u+1 <= numberOfOpenListItems) {  // if both children exist
-          // Check if the F-cost of the parent is greater than each child.
-          // Select the lower of the two children.
-          if (pathFinding->Fcost[pathFinding->openList[u]] > pathFinding->Fcost[pathFinding->openList[2*u]])
-            v = 2*u;
-          if (pathFinding->Fcost[pathFinding->openList[v]] > pathFinding->Fcost[pathFinding->openList[2*u+1]])
-            v = 2*u+1;
-          }
-        else {
-          if (2*u <= numberOfOpenListItems)  {  // If only child #1 exists
-            // Check if the F cost of the parent is greater than child #1
+        //  Open List = Binary Heap: Delete this item from the open list, which
+        //  is maintained as a binary heap. For more information on binary heaps, see:
+        //  http://www.policyalmanac.org/games/binaryHeaps.htm
+        numberOfOpenListItems = numberOfOpenListItems - 1; //reduce number of open list items by 1
+
+        #ifdef DEBUG_findPath
+        if (DEBUG_ON)  {
+          printf("DEBUG: (thread %2d) After removing (%d,%d,%d) from Open List, numberOfOpenListItems = %d\n", omp_get_thread_num(), parentXval, parentYval,
+                 parentZval, numberOfOpenListItems);
+        }
+        #endif
+
+        //  Delete the top item in binary heap and reorder the heap, with the
+        //  lowest F-cost item rising to the top.
+        pathFinding->openList[1] = pathFinding->openList[numberOfOpenListItems+1]; // Move the last item in the heap up to slot #1
+        pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[1]])] = 1;
+
+        v = 1;
+
+        //  Repeat the following until the new item in slot #1 sinks to its proper spot in the heap.
+        do  {
+          u = v;
+          if (2*u+1 <= numberOfOpenListItems) {  // if both children exist
+            // Check if the F-cost of the parent is greater than each child.
+            // Select the lower of the two children.
             if (pathFinding->Fcost[pathFinding->openList[u]] > pathFinding->Fcost[pathFinding->openList[2*u]])
               v = 2*u;
-          }
-        }  // End of else-clause
+            if (pathFinding->Fcost[pathFinding->openList[v]] > pathFinding->Fcost[pathFinding->openList[2*u+1]])
+              v = 2*u+1;
+            }
+          else {
+            if (2*u <= numberOfOpenListItems)  {  // If only child #1 exists
+              // Check if the F cost of the parent is greater than child #1
+              if (pathFinding->Fcost[pathFinding->openList[u]] > pathFinding->Fcost[pathFinding->openList[2*u]])
+                v = 2*u;
+            }
+          }  // End of else-clause
 
-        if (u != v)  { // If parent's F is > one of its children, swap them
+          if (u != v)  { // If parent's F is > one of its children, swap them
 
-          // Swap the sort-numbers in the 'sortNumber[x][y][z]' array:
-          temp = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[u]].X][pathFinding->openListCoords[pathFinding->openList[u]].Y][pathFinding->openListCoords[pathFinding->openList[u]].Z];
-          pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[u]].X][pathFinding->openListCoords[pathFinding->openList[u]].Y][pathFinding->openListCoords[pathFinding->openList[u]].Z]
-                      = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[v]].X][pathFinding->openListCoords[pathFinding->openList[v]].Y][pathFinding->openListCoords[pathFinding->openList[v]].Z];
-          pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[v]].X][pathFinding->openListCoords[pathFinding->openList[v]].Y][pathFinding->openListCoords[pathFinding->openList[v]].Z] = temp;
+            // Swap the sort-numbers in the 'sortNumber[x][y][z]' array:
+            temp = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[u]])];
+            pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[u]])]
+                        = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[v]])];
+            pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[v]])] = temp;
 
 
-          // Swap the ID numbers for sort numbers 'u' and 'v':
-          temp = pathFinding->openList[u];
-          pathFinding->openList[u] = pathFinding->openList[v];
-          pathFinding->openList[v] = temp;
-        }
-        else
-          break; // otherwise, exit loop
+            // Swap the ID numbers for sort numbers 'u' and 'v':
+            temp = pathFinding->openList[u];
+            pathFinding->openList[u] = pathFinding->openList[v];
+            pathFinding->openList[v] = temp;
+          }
+          else
+            break; // otherwise, exit loop
 
-      }
-      while (1);  // End of do-while block
+        }
+        while (1);  // End of do-while block
 
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("DEBUG: (thread %2d)     openList[1] = %'d after moving (%d,%d,%d) from  Open List to Closed List, and removing it from heap\n", omp_get_thread_num(),
-               pathFinding->openList[1], parentXval, parentYval, parentZval);
-        printf("DEBUG: (thread %2d)     Fcost[%'d] = %'lu at (%d,%d,%d) near top of findPath\n", omp_get_thread_num(), pathFinding->openList[1],
-               pathFinding->Fcost[pathFinding->openList[1]],
-               pathFinding->openListCoords[pathFinding->openList[1]].X,
-               pathFinding->openListCoords[pathFinding->openList[1]].Y,
-               pathFinding->openListCoords[pathFinding->openList[1]].Z);
-
-        printf("DEBUG: (thread %2d) About to start Step 6 for path %d.\n", omp_get_thread_num(), pathNum);
-        printf("DEBUG: (thread %2d)       (parentXval, parentYval, parentZval) = (%d,%d,%d)\n",
-               omp_get_thread_num(), parentXval, parentYval, parentZval);
-      }
-      #endif
+        #ifdef DEBUG_findPath
+        if (DEBUG_ON)  {
+          printf("DEBUG: (thread %2d)     openList[1] = %'d after moving (%d,%d,%d) from  Open List to Closed List, and removing it from heap\n", omp_get_thread_num(),
+                 pathFinding->openList[1], parentXval, parentYval, parentZval);
+          printf("DEBUG: (thread %2d)     Fcost[%'d] = %'lu at (%d,%d,%d) near top of findPath\n", omp_get_thread_num(), pathFinding->openList[1],
+                 pathFinding->Fcost[pathFinding->openList[1]],
+                 pathFinding->openListCoords[pathFinding->openList[1]].X,
+                 pathFinding->openListCoords[pathFinding->openList[1]].Y,
+                 pathFinding->openListCoords[pathFinding->openList[1]].Z);
+
+          printf("DEBUG: (thread %2d) About to start Step 6 for path %d.\n", omp_get_thread_num(), pathNum);
+          printf("DEBUG: (thread %2d)       (parentXval, parentYval, parentZval) = (%d,%d,%d)\n",
+                 omp_get_thread_num(), parentXval, parentYval, parentZval);
+        }
+        #endif
+      }  // End of if/else-block for radix-heap or binary-heap Open List
 
       // Get the allowed directions for routing from the parent cell. This information
       // is based on the design-rule number (location-specific) and design-rule subset
       // (net-specific):
-      int parent_DR_num    = cellInfo[parentXval][parentYval][parentZval].designRuleSet;
+      const CellRoutingInfo_t parentRouting = getCellRoutingInfo(mapInfo, cellInfo, parentXval, parentYval, parentZval);
+      int parent_DR_num    = parentRouting.designRuleSet;
       int parent_DR_subset = user_inputs->designRuleSubsetMap[pathNum][parent_DR_num];
       int parent_allowedRoutingDirections = user_inputs->designRules[parent_DR_num][parent_DR_subset].routeDirections;
 
+      // Rows of the look-up tables for the parent cell's design-rule set:
+      const int *minimumRoutingDirections       = pathFinding->minimumRoutingDirections[parent_DR_num];
+      const unsigned int *allowedTransitionMask = pathFinding->allowedTransitionMask[parent_DR_num];
+
       // Step 6: Check the 18 nearby 'children' cells. Add these nearby cells
       //    to the open list for later consideration if appropriate (see
       //    various if-statements below).
@@ -2442,6 +3628,12 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
           continue;
         }
 
+        // Index of the child cell in the flat path-finding arrays:
+        const size_t childIndex = pathFindingIndex(pathFinding, a, b, c);
+
+        // Static routing attributes of the child cell:
+        const CellRoutingInfo_t childRouting = getCellRoutingInfo(mapInfo, cellInfo, a, b, c);
+
         // For each allowed transition, also calculate the absolute value of the delta-X, -Y, -Z:
         deltaX = abs(allowedDeltaX[i]);
         deltaY = abs(allowedDeltaY[i]);
@@ -2457,19 +3649,17 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
         }
         #endif
 
-        // Get the allowed directions for routing *to* the child cell. This information
-        // is based on the design-rule number (location-specific) and design-rule subset
-        // (net-specific):
-        int child_DR_num    = cellInfo[a][b][c].designRuleSet;
-        int child_DR_subset = user_inputs->designRuleSubsetMap[pathNum][child_DR_num];
-        int child_allowedRoutingDirections = user_inputs->designRules[child_DR_num][child_DR_subset].routeDirections;
-
-        // Calculate the minimum allowed routing directions based on the allowed directions
-        // in the parent cell and the child cell:
-        int minimum_allowedRoutingDirections = calcMinimumAllowedDirection(parent_allowedRoutingDirections, child_allowedRoutingDirections);
+        // Get the minimum allowed routing directions based on the allowed directions in the
+        // parent cell and the child cell. This information is based on the design-rule number
+        // (location-specific) and design-rule subset (net-specific), and was tabulated by
+        // function calcAllowedTransitionMasks():
+        int child_DR_num = childRouting.designRuleSet;
+        int minimum_allowedRoutingDirections = minimumRoutingDirections[child_DR_num];
 
         #ifdef DEBUG_findPath
         if (DEBUG_ON)  {
+          int child_DR_subset = user_inputs->designRuleSubsetMap[pathNum][child_DR_num];
+          int child_allowedRoutingDirections = user_inputs->designRules[child_DR_num][child_DR_subset].routeDirections;
           char *route_direction_text; // String to hold routing direction
           route_direction_text = malloc(50 * sizeof(char)); // Allocate memory for routing description
 
@@ -2493,8 +3683,9 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
         #endif
 
         // Confirm that cell at (a,b,c) is not a prohibited direction for routing from the parent cell,
-        // based on the design-rules at the parent cell:
-        direction_allowed = allowedDirection(deltaX, deltaY, deltaZ, minimum_allowedRoutingDirections);
+        // based on the design-rules at the parent cell. The table look-up is equivalent to
+        // allowedDirection(deltaX, deltaY, deltaZ, minimum_allowedRoutingDirections):
+        direction_allowed = (allowedTransitionMask[child_DR_num] >> i) & 1;
         #ifdef DEBUG_findPath
         if (DEBUG_ON)  {
           printf("DEBUG: (thread %2d) For cell at (%d,%d,%d), direction_allowed is provisionally set to %d\n", omp_get_thread_num(),
@@ -2519,7 +3710,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
         // is in a pin-swap zone. Use the '__builtin_expect' compiler directive to tell the compiler to expect the
         // result to be FALSE more often than TRUE:
         if (__builtin_expect((parent_allowedRoutingDirections == X_ROUTING)
-            && (cellInfo[parentXval][parentYval][parentZval].swap_zone || cellInfo[a][b][c].swap_zone)
+            && (parentRouting.swap_zone || childRouting.swap_zone)
             && (deltaX + deltaY + deltaZ == 1), FALSE))  {
           direction_allowed = TRUE;
           #ifdef DEBUG_findPath
@@ -2549,18 +3740,18 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
         //   b. The child cell is in close proximity to a barrier or swap-zone, or
         //   c. The parent cell is in close proximity to a barrier or swap-zone.
         if ((allowedTransitions[i] == Up)
-              && (   cellInfo[parentXval][parentYval][parentZval].forbiddenUpViaBarrier
-                  || cellInfo[a][b][c].forbiddenDownViaBarrier
-                  || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN)
-                  || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN)
-                  || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_UP)
-                  || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_UP))) {
+              && (   parentRouting.forbiddenUpViaBarrier
+                  || childRouting.forbiddenDownViaBarrier
+                  || (childRouting.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN))
+                  || (childRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN))
+                  || (parentRouting.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_UP))
+                  || (parentRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_UP)))) {
 
           #ifdef DEBUG_findPath
           if (DEBUG_ON)  {
             printf("DEBUG: (thread %2d)  Skipping child cell (%d,%d,%d) because via is blocked up to that layer:\n", omp_get_thread_num(), a, b, c);
             printf("DEBUG: (thread %2d)                      forbiddenUpViaBarrier = %d at parent cell (%d,%d,%d)\n",
-                   omp_get_thread_num(), cellInfo[parentXval][parentYval][parentZval].forbiddenUpViaBarrier, parentXval, parentYval, parentZval);
+                   omp_get_thread_num(), parentRouting.forbiddenUpViaBarrier, parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)    VIA_UP get_unwalkable_barrier_proximity_by_path = %d at parent cell (%d,%d,%d)\n",
                    omp_get_thread_num(), get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval,
                    pathNum, VIA_UP), parentXval, parentYval, parentZval);
@@ -2568,15 +3759,15 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                    omp_get_thread_num(), get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval,
                    pathNum, VIA_UP), parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)                    forbiddenDownViaBarrier = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[a][b][c].forbiddenDownViaBarrier, a, b, c);
+                    childRouting.forbiddenDownViaBarrier, a, b, c);
             printf("DEBUG: (thread %2d)  VIA_DOWN get_unwalkable_barrier_proximity_by_path = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
                     get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN), a, b, c);
             printf("DEBUG: (thread %2d)  VIA_DOWN get_unwalkable_pinSwap_proximity_by_path = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
                     get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_DOWN), a, b, c);
             printf("DEBUG: (thread %2d)                                  swap zone = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[parentXval][parentYval][parentZval].swap_zone, parentXval, parentYval, parentZval);
+                    parentRouting.swap_zone, parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)                                  swap zone = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[a][b][c].swap_zone, a, b, c);
+                    childRouting.swap_zone, a, b, c);
           }
           #endif
 
@@ -2588,19 +3779,19 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
         //   b. The child cell is in close proximity to a barrier or swap-zone, or
         //   c. The parent cell is in close proximity to a barrier or swap-zone.
         else if ((allowedTransitions[i] == Down)
-              && (   cellInfo[parentXval][parentYval][parentZval].forbiddenDownViaBarrier
-                  || cellInfo[a][b][c].forbiddenUpViaBarrier
-                  || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP)
-                  || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP)
-                  || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN)
-                  || get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN)))  {
+              && (   parentRouting.forbiddenDownViaBarrier
+                  || childRouting.forbiddenUpViaBarrier
+                  || (childRouting.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP))
+                  || (childRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP))
+                  || (parentRouting.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN))
+                  || (parentRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN))))  {
 
           #ifdef DEBUG_findPath
           if (DEBUG_ON)  {
             printf("DEBUG: (thread %2d)  Skipping child cell (%d,%d,%d) because via is blocked down to that layer:\n",
                    omp_get_thread_num(), a, b, c);
             printf("DEBUG: (thread %2d)                    forbiddenDownViaBarrier = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[parentXval][parentYval][parentZval].forbiddenDownViaBarrier, parentXval, parentYval, parentZval);
+                    parentRouting.forbiddenDownViaBarrier, parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)  VIA_DOWN get_unwalkable_barrier_proximity_by_path = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
                     get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN),
                     parentXval, parentYval, parentZval);
@@ -2608,15 +3799,15 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                     get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, VIA_DOWN),
                     parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)                      forbiddenUpViaBarrier = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[a][b][c].forbiddenUpViaBarrier, a, b, c);
+                    childRouting.forbiddenUpViaBarrier, a, b, c);
             printf("DEBUG: (thread %2d)    VIA_UP get_unwalkable_barrier_proximity_by_path = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
                     get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP), a, b, c);
             printf("DEBUG: (thread %2d)    VIA_UP get_unwalkable_pinSwap_proximity_by_path = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
                     get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, VIA_UP), a, b, c);
             printf("DEBUG: (thread %2d)                                  swap zone = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[parentXval][parentYval][parentZval].swap_zone, parentXval, parentYval, parentZval);
+                    parentRouting.swap_zone, parentXval, parentYval, parentZval);
             printf("DEBUG: (thread %2d)                                  swap zone = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                    cellInfo[a][b][c].swap_zone, a, b, c);
+                    childRouting.swap_zone, a, b, c);
           }
           #endif
 
@@ -2630,18 +3821,18 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
           //   b. The child cell is in close proximity to a barrier or swap-zone, and the parent
           //      cell is not in a proximity zone that is not part of a swap-zone. (In other words,
           //      we're getting too close to a barrier or swap zone.)
-          if (   cellInfo[a][b][c].forbiddenTraceBarrier
-              || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE)
-              || (get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE)
-                  && (! get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, TRACE))
-                  && (! cellInfo[parentXval][parentYval][parentZval].swap_zone))) {
+          if (   childRouting.forbiddenTraceBarrier
+              || (childRouting.nearBarrier && get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE))
+              || ((childRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE))
+                  && (! (parentRouting.nearPinSwap && get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, TRACE)))
+                  && (! parentRouting.swap_zone))) {
 
             #ifdef DEBUG_findPath
             if (DEBUG_ON)  {
               printf("DEBUG: (thread %2d)  Skipping child cell (%d,%d,%d) because cell is blocked at that location:\n",
                      omp_get_thread_num(), a, b, c);
               printf("DEBUG: (thread %2d)                      forbiddenTraceBarrier = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                      cellInfo[a][b][c].forbiddenTraceBarrier, a, b, c);
+                      childRouting.forbiddenTraceBarrier, a, b, c);
               printf("DEBUG: (thread %2d)     TRACE get_unwalkable_barrier_proximity_by_path = %d at child cell (%d,%d,%d)\n",
                      omp_get_thread_num(), get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, a, b, c, pathNum, TRACE), a, b, c);
               printf("DEBUG: (thread %2d)     TRACE get_unwalkable_barrier_proximity_by_path = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
@@ -2653,9 +3844,9 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                       get_unwalkable_pinSwap_proximity_by_path(cellInfo, user_inputs, parentXval, parentYval, parentZval, pathNum, TRACE),
                       parentXval, parentYval, parentZval);
               printf("DEBUG: (thread %2d)                                  swap zone = %d at parent cell (%d,%d,%d)\n", omp_get_thread_num(),
-                      cellInfo[parentXval][parentYval][parentZval].swap_zone, parentXval, parentYval, parentZval);
+                      parentRouting.swap_zone, parentXval, parentYval, parentZval);
               printf("DEBUG: (thread %2d)                                  swap zone = %d at child cell (%d,%d,%d)\n", omp_get_thread_num(),
-                      cellInfo[a][b][c].swap_zone, a, b, c);
+                      childRouting.swap_zone, a, b, c);
             }
             #endif
 
@@ -2665,11 +3856,11 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
         // Don't check the cell if it's part of a pin-swappable zone, and the swap-zone
         // number of the zone does not match the current path's pin-swap zone:
-        if ((cellInfo[a][b][c].swap_zone) && (cellInfo[a][b][c].swap_zone != pathSwapZone))  {
+        if ((childRouting.swap_zone) && (childRouting.swap_zone != pathSwapZone))  {
           #ifdef DEBUG_findPath
           if (DEBUG_ON)  {
             printf("DEBUG: (thread %2d) Skipping cell (%d, %d, %d) because it's in a pin-swappable zone (%d)\n",
-                   omp_get_thread_num(), a, b, c, cellInfo[a][b][c].swap_zone);
+                   omp_get_thread_num(), a, b, c, childRouting.swap_zone);
             printf("DEBUG: (thread %2d)       that does not match the swap-zone number (%d) of path %d.\n",
                    omp_get_thread_num(), pathSwapZone, pathNum);
           }
@@ -2680,16 +3871,19 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
         // If 'restrictionFlag' is TRUE and the cell is not in a swap-zone, then don't
         // check this cell if it's on a routing layer that is prohibited (based on
-        // 'allowedLayers' value), or the cell is beyond a distance 'allowedRadiiCells'
-        // from coordinate (centerX, centerY):
+        // 'allowedLayers' value), the cell is outside of the corridor (if one is
+        // used), or the cell is beyond a distance 'allowedRadiiCells' from
+        // coordinate (centerX, centerY):
         if (routingRestrictions->restrictionFlag
-             && (! cellInfo[a][b][c].swap_zone)
+             && (! childRouting.swap_zone)
              && ((! routingRestrictions->allowedLayers[c])
+                  // Cell is outside of the corridor around the path from the previous iteration:
+                  || (routingRestrictions->corridorFlag && (! cellIsInCorridor(routingRestrictions, a, b)))
                   || (   (deltaZ == 0)    // Current cell is on same layer as previous cell (it's not a via)
                       // Routing radius is not zero (which would imply an infinite radius):
                       && (routingRestrictions->allowedRadiiCells[c] > 0.1)
                       // Cell is farther from center-point than allowed radius:
-                      && (calc_2D_Pythagorean_distance_ints(a, b, routingRestrictions->centerX, routingRestrictions->centerY) > routingRestrictions->allowedRadiiCells[c])) ))  {
+                      && cellIsBeyondRoutingRadius(routingRestrictions, pathFinding, a, b, c)) ))  {
           #ifdef DEBUG_findPath
           if (DEBUG_ON)  {
             printf("DEBUG: (thread %2d) Cell (%d,%d,%d) is subject to routing restrictions. Mid-point located at (%d,%d).\n",
@@ -2713,7 +3907,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
         //  If not already on the closed list (items on the closed list have
         //  already been considered and can now be ignored).
-        if (pathFinding->whichList[a][b][c] != onClosedList)  {
+        if (pathFinding->whichList[childIndex] != onClosedList)  {
 
           // Don't cut across corners: For each of the 16 neighbors within the 5x5
           // grid (on same routing layer), check that the path from the parent cell to the
@@ -2723,10 +3917,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
           switch (allowedTransitions[i])  {
             case WxSW :
               // Check cell located at (-2, -1) relative to parent:
-              if (  cellInfo[parentXval-1][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval-1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval-1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum, TRACE) )  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval-1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum) )  {
 
                 corner = unwalkable;
               }
@@ -2734,10 +3926,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case WxNW :
               // Check cell located at (-2, +1) relative to parent:
-              if (  cellInfo[parentXval-1][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval+1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval-1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval+1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2745,10 +3935,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case SW :
               // Check cell at location (-1,-1) relative to parent cell:
-              if (  cellInfo[parentXval-1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval  , parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval-1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval-1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2756,10 +3944,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case NW :
               // Check cell at location (-1,+1) relative to parent cell:
-              if (  cellInfo[parentXval  ][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval+1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval-1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval  , parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval+1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2767,10 +3953,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case SxSW :
               // Check cell at location (-1, -2) relative to parent:
-              if (  cellInfo[parentXval-1][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval-1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval-1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval-1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval-1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2778,10 +3962,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case NxNW :
               // Check cell at location (-1, +2) relative to parent:
-              if (  cellInfo[parentXval-1][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval-1, parentYval+1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval+1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval-1, parentYval+1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval+1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2789,10 +3971,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case SE :
               // Check 1 cell to lower right:
-              if (  cellInfo[parentXval  ][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval-1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval+1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval  , parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval-1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2800,10 +3980,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case NE :
               // Check 1 cell to upper right:
-              if (  cellInfo[parentXval+1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval  , parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval+1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval+1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2811,10 +3989,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case SxSE :
               // Check cell at location (+1, -2) relative to parent:
-              if (  cellInfo[parentXval+1][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval-1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval-1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval-1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval-1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2822,10 +3998,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case NxNE :
               // Check cell at location (+1, +2) relative to parent:
-              if (  cellInfo[parentXval+1][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval+1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval  ][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval  , parentYval+1, parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval+1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval, parentYval+1, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2833,10 +4007,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case ExSE :
               // Check cell located at (+2, -1) relative to parent:
-              if (  cellInfo[parentXval+1][parentYval-1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval-1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval+1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval  , parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval-1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2844,10 +4016,8 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
             case ExNE :
               // Check cell located at (+2, +1) relative to parent:
-              if (  cellInfo[parentXval+1][parentYval+1][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval+1, parentZval, pathNum, TRACE)
-                 || cellInfo[parentXval+1][parentYval  ][parentZval].forbiddenTraceBarrier
-                 || get_unwalkable_barrier_proximity_by_path(cellInfo, user_inputs, parentXval+1, parentYval  , parentZval, pathNum, TRACE))  {
+              if (  cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval+1, parentZval, pathNum)
+                 || cellBlocksTrace(mapInfo, cellInfo, user_inputs, parentXval+1, parentYval, parentZval, pathNum))  {
 
                 corner = unwalkable;
               }
@@ -2864,7 +4034,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
           //   (b) If child cell is in a pin-swap zone, it will only be checked if the parent
           //       cell is north, south, east, or west of child cell.
           swap_interface = walkable_swap_interface;  // Initialize 'swap_interface' to a walkable value
-          if ((cellInfo[parentXval][parentYval][parentZval].swap_zone || cellInfo[a][b][c].swap_zone)
+          if ((parentRouting.swap_zone || childRouting.swap_zone)
               && (deltaX + deltaY + deltaZ != 1))  {
             // The parent and child cells are oriented in a diagonal manner or via a knight's
             // move, and at least one of the cells is in a pin-swappable zone, so we flag
@@ -2903,7 +4073,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
               shapeType = VIA_DOWN;
 
             //  If not already on the open list, add it to the open list.
-            if (pathFinding->whichList[a][b][c] != onOpenList)  {
+            if (pathFinding->whichList[childIndex] != onOpenList)  {
 
               #ifdef DEBUG_findPath
               if (DEBUG_ON)  {
@@ -2914,18 +4084,12 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
               }
               #endif
 
-              // Create a new open-list item in the binary heap.
+              // Create a new open-list item, which has a unique ID number:
               newOpenListItemID = newOpenListItemID + 1; // each new item has a unique ID #
-              m = numberOfOpenListItems+1;
-              pathFinding->openList[m] = newOpenListItemID; // place the new open list item (actually,
-                                                 // its ID#) at the bottom of the heap
               pathFinding->openListCoords[newOpenListItemID].X = a;
               pathFinding->openListCoords[newOpenListItemID].Y = b;
               pathFinding->openListCoords[newOpenListItemID].Z = c; // record the x, y, and z coordinates of the new item
 
-              // Add this open-list item's coordinates and current sort-number to the 'sortNumber' array:
-              pathFinding->sortNumber[a][b][c] = m;
-
               // Calculate the congestion-related G-cost between the parent cell and the cell at (a,b,c):
               congestion_penalty = calc_congestion_penalty(a, b, c, parentXval, parentYval, parentZval, pathNum, shapeType,
                                                            cellInfo, user_inputs, mapInfo, FALSE, 0, recognizeSelfCongestion);
@@ -2952,16 +4116,16 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
               // Calculate the G-cost for child cell:
               unsigned long distance_G_cost = calc_distance_G_cost(a, b, c, parentXval, parentYval, parentZval, user_inputs, cellInfo, mapInfo, pathNum);
-              pathFinding->Gcost[a][b][c]
-                               = pathFinding->Gcost[parentXval][parentYval][parentZval]
+              pathFinding->Gcost[childIndex]
+                               = pathFinding->Gcost[parentIndex]
                                  + distance_G_cost
                                  + congestion_penalty;
 
               #ifdef DEBUG_findPath
               if (DEBUG_ON)  {
                  printf("DEBUG: (thread %2d) Calculated Gcost for child cell (%d,%d,%d) is %'lu, consisting of:\n", omp_get_thread_num(),
-                        a, b, c, pathFinding->Gcost[a][b][c]);
-                 printf("DEBUG: (thread %2d)        Parent's G-cost: %'lu\n", omp_get_thread_num(), pathFinding->Gcost[parentXval][parentYval][parentZval]);
+                        a, b, c, pathFinding->Gcost[childIndex]);
+                 printf("DEBUG: (thread %2d)        Parent's G-cost: %'lu\n", omp_get_thread_num(), pathFinding->Gcost[parentIndex]);
                  printf("DEBUG: (thread %2d)        Distance G-cost: %'lu\n", omp_get_thread_num(), distance_G_cost);
                  printf("DEBUG: (thread %2d)      Congestion G-cost: %'lu\n", omp_get_thread_num(), congestion_penalty);
               }
@@ -2969,17 +4133,17 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
               // Check that G-cost has not exceeded the maximum allowed value of an unsigned long integer (2^64-1) by ensuring that
               // this value is larger than each of the three components that comprise it:
-              if (   (pathFinding->Gcost[a][b][c] < pathFinding->Gcost[parentXval][parentYval][parentZval])
-                  || (pathFinding->Gcost[a][b][c] < distance_G_cost)
-                  || (pathFinding->Gcost[a][b][c] < congestion_penalty))  {
+              if (   (pathFinding->Gcost[childIndex] < pathFinding->Gcost[parentIndex])
+                  || (pathFinding->Gcost[childIndex] < distance_G_cost)
+                  || (pathFinding->Gcost[childIndex] < congestion_penalty))  {
 
                 printf("ERROR: An unexpected problem occurred. The variable 'Gcost' exceeded the maximum allowed value\n");
                 printf("       for a 64-bit unsigned integer (%'lu) at cell (%d,%d,%d) for net number %d.\n", 0xFFFFFFFFFFFFFFFF-1, a, b, c, pathNum);
                 printf("       This can be caused by exceptionally large designs, very long nets/traces, or large values for\n");
-                printf("       parameter 'trace_cost_multiplier' in the input file. The value of Gcost is %'lu.\n\n", pathFinding->Gcost[a][b][c]);
+                printf("       parameter 'trace_cost_multiplier' in the input file. The value of Gcost is %'lu.\n\n", pathFinding->Gcost[childIndex]);
                 printf("       Please inform the software developer of this fatal error message. The program is exiting.\n\n");
                 printf("       Diagnostic information: G-cost is the sum of these three variables\n");
-                printf("               Parent G-cost = %'lu\n", pathFinding->Gcost[parentXval][parentYval][parentZval]);
+                printf("               Parent G-cost = %'lu\n", pathFinding->Gcost[parentIndex]);
                 printf("             Distance G-cost = %'lu\n", distance_G_cost);
                 printf("           Congestion G-cost = %'lu\n\n", congestion_penalty);
                 exit(1);
@@ -2999,81 +4163,99 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                 }
                 #endif
 
-                pathFinding->Hcost[pathFinding->openList[m]] = calc_heuristic(a, b, c, endCoord.X, endCoord.Y, endCoord.Z,
-                                                                              minimum_allowedRoutingDirections, user_inputs, cellInfo);
+                pathFinding->Hcost[newOpenListItemID] = calc_findPath_heuristic(mapInfo, cellInfo, user_inputs, pathSwapZone, a, b, c,
+                                                                                endCoord.X, endCoord.Y, endCoord.Z,
+                                                                                minimum_allowedRoutingDirections);
 
               }
               else  {
                 // If 'useDijkstra' is TRUE, then set the H-cost to zero:
-                pathFinding->Hcost[pathFinding->openList[m]] = 0.0;
+                pathFinding->Hcost[newOpenListItemID] = 0.0;
               }
 
               //
               // Now that G and H costs are calculated, determine the F cost and parent:
               //
-              pathFinding->Fcost[pathFinding->openList[m]] = pathFinding->Gcost[a][b][c] + pathFinding->Hcost[pathFinding->openList[m]];
+              pathFinding->Fcost[newOpenListItemID] = pathFinding->Gcost[childIndex] + pathFinding->Hcost[newOpenListItemID];
 
               // Check that F-cost has not exceeded the maximum allowed value of a long, unsigned integer (2^64-1) by
               // confirming that its value is larger than each of the two components that comprise it:
-              if (   (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Gcost[a][b][c])
-                  || (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Hcost[pathFinding->openList[m]]))  {
+              if (   (pathFinding->Fcost[newOpenListItemID] < pathFinding->Gcost[childIndex])
+                  || (pathFinding->Fcost[newOpenListItemID] < pathFinding->Hcost[newOpenListItemID]))  {
                 printf("\nERROR: An unexpected problem occurred. The variable 'Fcost' exceeded the maximum allowed value\n");
                 printf(  "       for a 64-bit integer (%'lu) at cell (%d,%d,%d) for net number %d.\n", 0xFFFFFFFFFFFFFFFF-1, a, b, c, pathNum);
                 printf(  "       This can be caused by exceptionally large designs, very long nets/traces, or large values for\n");
                 printf(  "       parameter 'trace_cost_multiplier' in the input file. Diagnostic information follows:\n");
-                printf(  "            Gcost = %'lu\n", pathFinding->Gcost[a][b][c]);
-                printf(  "            Hcost = %'lu\n", pathFinding->Hcost[pathFinding->openList[m]]);
-                printf(  "            Fcost = %'lu\n", pathFinding->Fcost[pathFinding->openList[m]]);
+                printf(  "            Gcost = %'lu\n", pathFinding->Gcost[childIndex]);
+                printf(  "            Hcost = %'lu\n", pathFinding->Hcost[newOpenListItemID]);
+                printf(  "            Fcost = %'lu\n", pathFinding->Fcost[newOpenListItemID]);
                 printf(  "       Please inform the software developer of this fatal error message. The program is exiting.\n\n");
                 exit(1);
               }
 
               // Define the parent X/Y/Z locations for the child cell at (a,b,c):
-              pathFinding->parentCoords[a][b][c].X = parentXval;
-              pathFinding->parentCoords[a][b][c].Y = parentYval;
-              pathFinding->parentCoords[a][b][c].Z = parentZval;
+              // Don't add the cell to the Open List if its F-cost reaches the cost of the previous
+              // path, because no path through this cell can be cheaper than the previous path:
+              if (pathFinding->Fcost[newOpenListItemID] >= costBound)  {
+                newOpenListItemID = newOpenListItemID - 1;  // Re-use this item's ID number
+                continue;
+              }
+
+              pathFinding->parentDirection[childIndex] = allowedTransitions[i];
 
               #ifdef DEBUG_findPath
               if (DEBUG_ON)  {
                 printf("DEBUG: (thread %2d) From parent cell (%d,%d,%d), child cell (%d,%d,%d)'s   G = %'lu   H = %'lu   F = %'lu   for path %d\n",
-                       omp_get_thread_num(), parentXval, parentYval, parentZval, a, b, c, pathFinding->Gcost[a][b][c],
-                       pathFinding->Hcost[pathFinding->openList[m]], pathFinding->Fcost[pathFinding->openList[m]], pathNum) ;
+                       omp_get_thread_num(), parentXval, parentYval, parentZval, a, b, c, pathFinding->Gcost[childIndex],
+                       pathFinding->Hcost[newOpenListItemID], pathFinding->Fcost[newOpenListItemID], pathNum) ;
               }
               #endif
 
-              // Move the new open-list item to the proper place in the binary heap.
-              // Starting at the bottom, successively compare to parent items,
-              // swapping as needed until the item finds its place in the heap
-              // or bubbles all the way to the top (if it has the lowest F cost).
-              while (m != 1)  {  // While item hasn't bubbled to the top (m==1)
-                // Check if child's F cost is < parent's F cost. If so, swap them.
-                if (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Fcost[pathFinding->openList[m/2]])  {
+              if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+                // Add the new item to the radix heap:
+                pushRadixHeap(&(pathFinding->radixHeap), pathFinding->Fcost[newOpenListItemID], pathFinding->openListCoords[newOpenListItemID]);
+              }
+              else  {
+                // Place the new open-list item (actually, its ID#) at the bottom of the binary heap,
+                // and add its current sort-number to the 'sortNumber' array:
+                m = numberOfOpenListItems+1;
+                pathFinding->openList[m] = newOpenListItemID;
+                pathFinding->sortNumber[childIndex] = m;
+
+                // Move the new open-list item to the proper place in the binary heap.
+                // Starting at the bottom, successively compare to parent items,
+                // swapping as needed until the item finds its place in the heap
+                // or bubbles all the way to the top (if it has the lowest F cost).
+                while (m != 1)  {  // While item hasn't bubbled to the top (m==1)
+                  // Check if child's F cost is < parent's F cost. If so, swap them.
+                  if (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Fcost[pathFinding->openList[m/2]])  {
+
+                    // Swap 'sortNumber' elements:
+                    temp = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m/2]])];
+                    pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m/2]])]
+                      = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m]])];
+                    pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m]])] = temp;
 
-                  // Swap 'sortNumber' elements:
-                  temp = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m/2]].X][pathFinding->openListCoords[pathFinding->openList[m/2]].Y][pathFinding->openListCoords[pathFinding->openList[m/2]].Z];
-                  pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m/2]].X][pathFinding->openListCoords[pathFinding->openList[m/2]].Y][pathFinding->openListCoords[pathFinding->openList[m/2]].Z]
-                    = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m]].X][pathFinding->openListCoords[pathFinding->openList[m]].Y][pathFinding->openListCoords[pathFinding->openList[m]].Z];
-                  pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m]].X][pathFinding->openListCoords[pathFinding->openList[m]].Y][pathFinding->openListCoords[pathFinding->openList[m]].Z] = temp;
+                    // Swap 'openList' elements:
+                    temp = pathFinding->openList[m/2];
+                    pathFinding->openList[m/2] = pathFinding->openList[m];
+                    pathFinding->openList[m] = temp;
 
-                  // Swap 'openList' elements:
-                  temp = pathFinding->openList[m/2];
-                  pathFinding->openList[m/2] = pathFinding->openList[m];
-                  pathFinding->openList[m] = temp;
+                    // Cut 'm' in half and continue until m == 1:
+                    m = m/2;
 
-                  // Cut 'm' in half and continue until m == 1:
-                  m = m/2;
+                  }
+                  else
+                    break;
+                }  // End of while-loop for (m != 1)
 
+                #ifdef DEBUG_findPath
+                if (DEBUG_ON)  {
+                  printf("DEBUG: (thread %2d)     openList[1] = %'d after adding child cell (%d,%d,%d) to binary heap in middle of findPath (with parent (%d,%d,%d))\n",
+                         omp_get_thread_num(), pathFinding->openList[1], a, b, c, parentXval, parentYval, parentZval);
                 }
-                else
-                  break;
-              }  // End of while-loop for (m != 1)
-
-              #ifdef DEBUG_findPath
-              if (DEBUG_ON)  {
-                printf("DEBUG: (thread %2d)     openList[1] = %'d after adding child cell (%d,%d,%d) to binary heap in middle of findPath (with parent (%d,%d,%d))\n",
-                       omp_get_thread_num(), pathFinding->openList[1], a, b, c, parentXval, parentYval, parentZval);
-              }
-              #endif
+                #endif
+              }  // End of if/else-block for radix-heap or binary-heap Open List
 
               // Add one to the number of items in the heap
               numberOfOpenListItems = numberOfOpenListItems + 1;
@@ -3084,7 +4266,10 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
               #endif
 
               // Change whichList to show that the new item is on the open list.
-              pathFinding->whichList[a][b][c] = onOpenList;
+              pathFinding->whichList[childIndex] = onOpenList;
+
+              // Expand the box that contains the explored cells:
+              expandSearchBox(&searchMin, &searchMax, a, b, c);
 
               // If the 'record_explored_cells' flag is 1 or 3, then set the 'explored' flag in 'cellInfo' data
               // structure to show that this cell was explored during the A* path-finding algorithm:
@@ -3147,7 +4332,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
               // Calculate G-cost for child cell:
               unsigned long distance_G_cost = calc_distance_G_cost(a, b, c, parentXval, parentYval, parentZval, user_inputs, cellInfo, mapInfo, pathNum);
 
-              tempGcost = pathFinding->Gcost[parentXval][parentYval][parentZval]
+              tempGcost = pathFinding->Gcost[parentIndex]
                            + distance_G_cost
                            + congestion_penalty;
 
@@ -3155,7 +4340,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
               if (DEBUG_ON)  {
                 printf("DEBUG: (thread %2d) Calculated tempGcost for child cell (%d,%d,%d) is %'lu, consisting of:\n", omp_get_thread_num(),
                        a, b, c, tempGcost);
-                printf("DEBUG: (thread %2d)         Parent's G-cost: %'lu\n", omp_get_thread_num(), pathFinding->Gcost[parentXval][parentYval][parentZval]);
+                printf("DEBUG: (thread %2d)         Parent's G-cost: %'lu\n", omp_get_thread_num(), pathFinding->Gcost[parentIndex]);
                 printf("DEBUG: (thread %2d)         Distance G-cost: %'lu\n", omp_get_thread_num(), distance_G_cost);
                 printf("DEBUG: (thread %2d)       Congestion G-cost: %'lu\n", omp_get_thread_num(), congestion_penalty);
               }
@@ -3163,7 +4348,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
               // Check that tempGcost has not exceeded the maximum allowed value of an unsigned long integer (2^64-1) by ensuring that
               // this value is larger than each of the three components that comprise it:
-              if (   (tempGcost < pathFinding->Gcost[parentXval][parentYval][parentZval])
+              if (   (tempGcost < pathFinding->Gcost[parentIndex])
                   || (tempGcost < distance_G_cost)
                   || (tempGcost < congestion_penalty))  {
 
@@ -3173,7 +4358,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                 printf("       parameter 'trace_cost_multiplier' in the input file. The value of tempGcost is %'lu.\n\n", tempGcost);
                 printf("       Please inform the software developer of this fatal error message. The program is exiting.\n\n");
                 printf("       Diagnostic information: tempGcost is the sum of these three variables\n");
-                printf("               Parent G-cost = %'lu\n", pathFinding->Gcost[parentXval][parentYval][parentZval]);
+                printf("               Parent G-cost = %'lu\n", pathFinding->Gcost[parentIndex]);
                 printf("             Distance G-cost = %'lu\n", distance_G_cost);
                 printf("           Congestion G-cost = %'lu\n\n", congestion_penalty);
                 exit(1);
@@ -3182,80 +4367,98 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
               // If this path is shorter (G cost is lower), then change
               // the parent cell, G cost and F cost.
-              if (tempGcost < pathFinding->Gcost[a][b][c])  {  // If G cost is less,
+              if (tempGcost < pathFinding->Gcost[childIndex])  {  // If G cost is less,
 
                 #ifdef DEBUG_findPath
                 if (DEBUG_ON)  {
                   printf("DEBUG: (thread %2d) A lower G-cost was found for cell (%d,%d,%d): %'ld (was %'ld), with new parent cell (%d,%d,%d).\n",
-                         omp_get_thread_num(), a, b, c, tempGcost, pathFinding->Gcost[a][b][c], parentXval, parentYval, parentZval);
+                         omp_get_thread_num(), a, b, c, tempGcost, pathFinding->Gcost[childIndex], parentXval, parentYval, parentZval);
                   printf("DEBUG: (thread %2d)  Program will next look through the %d cells to find its location in the sorted binary heap.\n",
                          omp_get_thread_num(), numberOfOpenListItems);
                 }
                 #endif
 
-                pathFinding->parentCoords[a][b][c].X = parentXval; // Change the cell's parent
-                pathFinding->parentCoords[a][b][c].Y = parentYval;
-                pathFinding->parentCoords[a][b][c].Z = parentZval;
-
-                pathFinding->Gcost[a][b][c] = tempGcost;    // Change the G cost
-
-
-                // Because changing the G cost also changes the F cost, and because this
-                // cell is on the open list, we need to change the cell's recorded F-cost
-                // and its position on the open list to make sure that we maintain a
-                // properly ordered open list.
-                m = pathFinding->sortNumber[a][b][c];
-
-                pathFinding->Fcost[pathFinding->openList[m]] = pathFinding->Gcost[a][b][c] + pathFinding->Hcost[pathFinding->openList[m]]; // Change the F cost
-
-                // Check that F-cost has not exceeded the maximum allowed value of a long, unsigned integer (2^64-1) by
-                // confirming that its value is larger than each of the two components that comprise it:
-                if (   (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Gcost[a][b][c])
-                    || (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Hcost[pathFinding->openList[m]]))  {
-                  printf("\nERROR: An unexpected problem occurred. The variable 'Fcost' exceeded the maximum allowed value\n");
-                  printf(  "       for a 64-bit integer (%'lu) at cell (%d,%d,%d) for net number %d.\n", 0xFFFFFFFFFFFFFFFF-1, a, b, c, pathNum);
-                  printf(  "       This can be caused by exceptionally large designs, very long nets/traces, or large values for\n");
-                  printf(  "       parameter 'trace_cost_multiplier' in the input file. Diagnostic information follows:\n");
-                  printf(  "            Gcost = %'lu\n", pathFinding->Gcost[a][b][c]);
-                  printf(  "            Hcost = %'lu\n", pathFinding->Hcost[pathFinding->openList[m]]);
-                  printf(  "            Fcost = %'lu\n", pathFinding->Fcost[pathFinding->openList[m]]);
-                  printf(  "       Please inform the software developer of this fatal error message.  The program is exiting.\n\n");
-                  exit(1);
-                }
-
-                // See if changing the F score bubbles the item up from
-                // its current location in the heap
-                while (m != 1) {  // While item hasn't bubbled to the top (m==1)
-                  // Check if child is < parent. If so, swap them.
-                  if (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Fcost[pathFinding->openList[m/2]])  {
-
-                    // Swap 'sortNumber' elements:
-                    temp = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m/2]].X][pathFinding->openListCoords[pathFinding->openList[m/2]].Y][pathFinding->openListCoords[pathFinding->openList[m/2]].Z];
-                    pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m/2]].X][pathFinding->openListCoords[pathFinding->openList[m/2]].Y][pathFinding->openListCoords[pathFinding->openList[m/2]].Z]
-                      = pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m]].X][pathFinding->openListCoords[pathFinding->openList[m]].Y][pathFinding->openListCoords[pathFinding->openList[m]].Z];
-                    pathFinding->sortNumber[pathFinding->openListCoords[pathFinding->openList[m]].X][pathFinding->openListCoords[pathFinding->openList[m]].Y][pathFinding->openListCoords[pathFinding->openList[m]].Z] = temp;
-
-                    // Swap 'openList' elements:
-                    temp = pathFinding->openList[m/2];
-                    pathFinding->openList[m/2] = pathFinding->openList[m];
-                    pathFinding->openList[m] = temp;
+                pathFinding->parentDirection[childIndex] = allowedTransitions[i]; // Change the cell's parent
 
-                    // Cut 'm' in half and continue until m == 1:
-                    m = m/2;
-                  }  // End of if-block for (Fcost[openList[m]...
-                  else
-                    break;
-                }   // End of while-loop for (m != 1)
+                pathFinding->Gcost[childIndex] = tempGcost;    // Change the G cost
 
-                #ifdef DEBUG_findPath
-                if (DEBUG_ON)  {
-                  printf("DEBUG: (thread %2d)     openList[1] = %'d at bottom of findPath, after calculating new G- and F-values for cell (%d,%d,%d)\n",
-                         omp_get_thread_num(), pathFinding->openList[1], a, b, c);
-                  printf("DEBUG: (thread %2d)     Fcost[%'d] = %'lu at (%d,%d,%d) at bottom of findPath\n", omp_get_thread_num(), pathFinding->openList[1],
-                         pathFinding->Fcost[pathFinding->openList[1]], pathFinding->openListCoords[pathFinding->openList[1]].X,
-                         pathFinding->openListCoords[pathFinding->openList[1]].Y, pathFinding->openListCoords[pathFinding->openList[1]].Z);
+
+                if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+                  // The radix heap has no sort-numbers for locating this cell's existing entry,
+                  // so a second entry is added with the lower F-cost. The older entry will be
+                  // discarded after the cell reaches the Closed List. Because the cell's ID
+                  // number is also unknown, its H-cost is re-calculated from the new parent:
+                  unsigned long child_Hcost = 0;
+                  if (! useDijkstra)  {
+                    child_Hcost = calc_findPath_heuristic(mapInfo, cellInfo, user_inputs, pathSwapZone, a, b, c,
+                                                          endCoord.X, endCoord.Y, endCoord.Z, minimum_allowedRoutingDirections);
+                  }
+                  Coordinate_t childCoord;
+                  childCoord.X    = a;
+                  childCoord.Y    = b;
+                  childCoord.Z    = c;
+                  childCoord.flag = FALSE;
+                  pushRadixHeap(&(pathFinding->radixHeap), pathFinding->Gcost[childIndex] + child_Hcost, childCoord);
                 }
-                #endif
+                else  {
+                  // Because changing the G cost also changes the F cost, and because this
+                  // cell is on the open list, we need to change the cell's recorded F-cost
+                  // and its position on the open list to make sure that we maintain a
+                  // properly ordered open list.
+                  m = pathFinding->sortNumber[childIndex];
+
+                  pathFinding->Fcost[pathFinding->openList[m]] = pathFinding->Gcost[childIndex] + pathFinding->Hcost[pathFinding->openList[m]]; // Change the F cost
+
+                  // Check that F-cost has not exceeded the maximum allowed value of a long, unsigned integer (2^64-1) by
+                  // confirming that its value is larger than each of the two components that comprise it:
+                  if (   (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Gcost[childIndex])
+                      || (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Hcost[pathFinding->openList[m]]))  {
+                    printf("\nERROR: An unexpected problem occurred. The variable 'Fcost' exceeded the maximum allowed value\n");
+                    printf(  "       for a 64-bit integer (%'lu) at cell (%d,%d,%d) for net number %d.\n", 0xFFFFFFFFFFFFFFFF-1, a, b, c, pathNum);
+                    printf(  "       This can be caused by exceptionally large designs, very long nets/traces, or large values for\n");
+                    printf(  "       parameter 'trace_cost_multiplier' in the input file. Diagnostic information follows:\n");
+                    printf(  "            Gcost = %'lu\n", pathFinding->Gcost[childIndex]);
+                    printf(  "            Hcost = %'lu\n", pathFinding->Hcost[pathFinding->openList[m]]);
+                    printf(  "            Fcost = %'lu\n", pathFinding->Fcost[pathFinding->openList[m]]);
+                    printf(  "       Please inform the software developer of this fatal error message.  The program is exiting.\n\n");
+                    exit(1);
+                  }
+
+                  // See if changing the F score bubbles the item up from
+                  // its current location in the heap
+                  while (m != 1) {  // While item hasn't bubbled to the top (m==1)
+                    // Check if child is < parent. If so, swap them.
+                    if (pathFinding->Fcost[pathFinding->openList[m]] < pathFinding->Fcost[pathFinding->openList[m/2]])  {
+
+                      // Swap 'sortNumber' elements:
+                      temp = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m/2]])];
+                      pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m/2]])]
+                        = pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m]])];
+                      pathFinding->sortNumber[pathFindingCoordIndex(pathFinding, pathFinding->openListCoords[pathFinding->openList[m]])] = temp;
+
+                      // Swap 'openList' elements:
+                      temp = pathFinding->openList[m/2];
+                      pathFinding->openList[m/2] = pathFinding->openList[m];
+                      pathFinding->openList[m] = temp;
+
+                      // Cut 'm' in half and continue until m == 1:
+                      m = m/2;
+                    }  // End of if-block for (Fcost[openList[m]...
+                    else
+                      break;
+                  }   // End of while-loop for (m != 1)
+
+                  #ifdef DEBUG_findPath
+                  if (DEBUG_ON)  {
+                    printf("DEBUG: (thread %2d)     openList[1] = %'d at bottom of findPath, after calculating new G- and F-values for cell (%d,%d,%d)\n",
+                           omp_get_thread_num(), pathFinding->openList[1], a, b, c);
+                    printf("DEBUG: (thread %2d)     Fcost[%'d] = %'lu at (%d,%d,%d) at bottom of findPath\n", omp_get_thread_num(), pathFinding->openList[1],
+                           pathFinding->Fcost[pathFinding->openList[1]], pathFinding->openListCoords[pathFinding->openList[1]].X,
+                           pathFinding->openListCoords[pathFinding->openList[1]].Y, pathFinding->openListCoords[pathFinding->openList[1]].Z);
+                  }
+                  #endif
+                }  // End of if/else-block for radix-heap or binary-heap Open List
+
 
               }  // End of if-clause for (tempGcost < Gcost[a][b][c]...)
               else  {
@@ -3287,7 +4490,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
       }  // End of for-loop for index 'i' (0 to num_transitions)
 
-    }  // End of if-clause for (numberOfOpenListItems != 0)
+    }  // End of if-clause for (! openListIsEmpty)
 
     // Step 8: If open list is empty then there is no path.
     else  {
@@ -3304,7 +4507,7 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 
 
     #ifdef DEBUG_findPath
-    if (DEBUG_ON)  {
+    if (DEBUG_ON && (pathFinding->openListEngine == BINARY_HEAP_ENGINE))  {
       //
       // In DEBUG mode, print out the coordinates with the 10 lowest F-costs:
       //
@@ -3322,25 +4525,30 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
     //
     // If cell with lowest F-cost is the target, then lowest-cost path has been found
     //
-    if (   (pathFinding->openListCoords[pathFinding->openList[1]].X == endCoord.X)
-        && (pathFinding->openListCoords[pathFinding->openList[1]].Y == endCoord.Y)
-        && (pathFinding->openListCoords[pathFinding->openList[1]].Z == endCoord.Z))  {
+    if (pathFinding->openListEngine == RADIX_HEAP_ENGINE)  {
+      const RadixHeapEntry_t *radixHeapTop = peekRadixHeap(&(pathFinding->radixHeap), pathFinding, pathFinding->whichList, onClosedList);
+      if (radixHeapTop != NULL)
+        topCoord = radixHeapTop->coord;
+    }
+    else  {
+      topCoord = pathFinding->openListCoords[pathFinding->openList[1]];
+    }
+    if ((topCoord.X == endCoord.X) && (topCoord.Y == endCoord.Y) && (topCoord.Z == endCoord.Z))  {
 
       #ifdef DEBUG_findPath
       if (DEBUG_ON)  {
+        Coordinate_t endParent = parentCell(endCoord, pathFinding->parentDirection[pathFindingCoordIndex(pathFinding, endCoord)], -1);
         printf("DEBUG: (thread %2d) We found the target cell (%d,%d,%d) on the Open List, with parent cell (%d,%d,%d).\n",
-               omp_get_thread_num(), endCoord.X, endCoord.Y, endCoord.Z, pathFinding->parentCoords[endCoord.X][endCoord.Y][endCoord.Z].X,
-               pathFinding->parentCoords[endCoord.X][endCoord.Y][endCoord.Z].Y, pathFinding->parentCoords[endCoord.X][endCoord.Y][endCoord.Z].Z);
-        printf("DEBUG: (thread %2d) Lowest F-value is %'lu for cell (%d,%d,%d)\n", omp_get_thread_num(),
-               pathFinding->Fcost[pathFinding->openList[1]], pathFinding->openListCoords[pathFinding->openList[1]].X,
-               pathFinding->openListCoords[pathFinding->openList[1]].Y, pathFinding->openListCoords[pathFinding->openList[1]].Z);
+               omp_get_thread_num(), endCoord.X, endCoord.Y, endCoord.Z, endParent.X, endParent.Y, endParent.Z);
+        printf("DEBUG: (thread %2d) Lowest-cost cell is (%d,%d,%d) with G-value %'lu\n", omp_get_thread_num(),
+               topCoord.X, topCoord.Y, topCoord.Z, pathFinding->Gcost[pathFindingCoordIndex(pathFinding, topCoord)]);
       }
       #endif
 
       // We got here, so we found a path. Capture the G-cost, which
       // will be returned from this function:
       path = found;
-      total_Gcost = pathFinding->Gcost[endCoord.X][endCoord.Y][endCoord.Z];
+      total_Gcost = pathFinding->Gcost[pathFindingCoordIndex(pathFinding, endCoord)];
 
       break;  // Break out of the while-loop
 
@@ -3355,6 +4563,22 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
   // this path-finding algorithm, including cells on the open list and the closed list. Capture
   // this value in the 'routability' structure to report to the user later on:
   routability->path_explored_cells[pathNum] = newOpenListItemID;
+  routability->path_search_min[pathNum]     = searchMin;
+  routability->path_search_max[pathNum]     = searchMax;
+
+  // If the Open List was exhausted because no cell could lead to a path that is cheaper than
+  // the previous path, then the previous path is still the best path. Return it again:
+  if ((path == nonexistent) && (costBound != ULONG_MAX))  {
+    restorePreviousPath(pathCoords, pathLength, previousPathCoords, previousPathLength);
+    total_Gcost = costBound;
+
+    if (record_elapsed_time)  {
+      end = time(NULL);
+      routability->path_elapsed_time[pathNum] = (int) (end - start);
+    }
+
+    return(total_Gcost);
+  }  // End of if-block for returning the previous path
 
   #ifdef DEBUG_findPath
   if (DEBUG_CRITERIA_MET)  {
@@ -3377,9 +4601,10 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
     pathZ = endCoord.Z;
     do  {
       //Look up the parent of the current cell.
-      tempx = pathFinding->parentCoords[pathX][pathY][pathZ].X;
-      tempy = pathFinding->parentCoords[pathX][pathY][pathZ].Y;
-      tempz = pathFinding->parentCoords[pathX][pathY][pathZ].Z;
+      unsigned char direction = pathFinding->parentDirection[pathFindingIndex(pathFinding, pathX, pathY, pathZ)];
+      tempx = pathX - transitionDeltaX[direction];
+      tempy = pathY - transitionDeltaY[direction];
+      tempz = pathZ - transitionDeltaZ[direction];
       pathZ = tempz;
       pathY = tempy;
       pathX = tempx;
@@ -3399,104 +4624,687 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
     }
     #endif
 
-    // b. Resize the data bank to the right size in bytes
-    *pathCoords = realloc(*pathCoords, *pathLength * sizeof(Coordinate_t));
-    if (*pathCoords == 0)  {
-      printf("\nERROR: Failed to re-allocate memory for 'pathCoords' array.\n\n");
-      exit(1);
+    // b. Resize the data bank to the right size in bytes
+    *pathCoords = realloc(*pathCoords, *pathLength * sizeof(Coordinate_t));
+    if (*pathCoords == 0)  {
+      printf("\nERROR: Failed to re-allocate memory for 'pathCoords' array.\n\n");
+      exit(1);
+    }
+
+    // c. Now copy the path information over to the path coordinates array.
+    //    Since we are working backwards from the target to the start location,
+    //    we copy the information to the data bank in reverse order. The result
+    //    is a properly ordered set of path data, from the first step to the last.
+    pathX = endCoord.X;
+    pathY = endCoord.Y;
+    pathZ = endCoord.Z;
+    cellPosition = *pathLength;  //start at the end
+    #ifdef DEBUG_findPath
+    if (DEBUG_ON)  {
+      printf("\nDEBUG: (thread %2d) For path #%d ('%s'), target cell is (%d,%d,%d)\n", omp_get_thread_num(), pathNum, user_inputs->net_name[pathNum], pathX, pathY, pathZ);
+      printf("DEBUG: (thread %2d) Entering do/while loop to determine path...\n", omp_get_thread_num());
+    }
+    #endif
+    do  {
+      cellPosition = cellPosition - 1;  // Work backwards by 1 cell position in the path
+      (*pathCoords)[cellPosition].X    = pathX;
+      (*pathCoords)[cellPosition].Y    = pathY;
+      (*pathCoords)[cellPosition].Z    = pathZ;
+      (*pathCoords)[cellPosition].flag = FALSE;
+
+      #ifdef DEBUG_findPath
+      if (DEBUG_ON)  {
+        printf("DEBUG: (thread %2d) At end of function 'findPath' for path %d, segment %d = (%d,%d,%d)\n",
+               omp_get_thread_num(), pathNum, cellPosition, (*pathCoords)[cellPosition].X, (*pathCoords)[cellPosition].Y, (*pathCoords)[cellPosition].Z);
+      }
+      #endif
+
+      // d. Look up the parent of the current cell.
+      unsigned char direction = pathFinding->parentDirection[pathFindingIndex(pathFinding, pathX, pathY, pathZ)];
+      tempx = pathX - transitionDeltaX[direction];
+      tempy = pathY - transitionDeltaY[direction];
+      tempz = pathZ - transitionDeltaZ[direction];
+      pathZ = tempz;
+      pathY = tempy;
+      pathX = tempx;
+
+      #ifdef DEBUG_findPath
+      if (DEBUG_ON)  {
+        printf("DEBUG: (thread %2d)    Segment %d of path %d: (%d,%d,%d)\n", omp_get_thread_num(), cellPosition, pathNum, pathX, pathY, pathZ);
+      }
+      #endif
+
+      // e. If we have reached the starting cell, exit the loop.
+    }  // End of do/while-block
+    while ((pathX != startCoord.X) || (pathY != startCoord.Y) || (pathZ != startCoord.Z));
+
+    #ifdef DEBUG_findPath
+    if (DEBUG_ON)  {
+      printf("DEBUG: (thread %2d) Finished Step 9.\n", omp_get_thread_num());
+    }
+    #endif
+
+  }  // End of if-block for (path == found)
+
+  // Calculate elapsed (wall-clock) time to find this path:
+  if (record_elapsed_time)  {
+    end = time(NULL);
+    routability->path_elapsed_time[pathNum] = (int) (end - start);
+    // printf("DEBUG: In iteration %d, path %d took %d seconds to find.\n", mapInfo->current_iteration, pathNum, routability->path_elapsed_time[pathNum]);
+  }
+
+  #ifdef DEBUG_findPath
+  if (DEBUG_ON)  {
+    // Return the G-cost of the full path:
+    printf("DEBUG: (thread %2d) About to return from 'findPath()'. Gcost = %'lu. Number of segments = %d.\n\n",
+           omp_get_thread_num(), total_Gcost, *pathLength);
+  }
+  #endif
+
+  return(total_Gcost);
+
+noPath:
+  // 13. There is no path to the selected target
+
+  #ifdef DEBUG_findPath
+  if (DEBUG_ON)  {
+    printf("DEBUG: (thread %2d) Exiting function 'findPath' through the 'noPath' label.\n", omp_get_thread_num());
+  }
+  #endif
+
+  // Calculate elapsed (wall-clock) time to find this path:
+  if (record_elapsed_time)  {
+    end = time(NULL);
+    routability->path_elapsed_time[pathNum] = (int) (end - start);
+  }
+
+  printf("\nINFO: No path was found to route net #%d ('%s') after exploring %'d cells in %'d seconds.\n\n",
+         pathNum, user_inputs->net_name[pathNum], newOpenListItemID, routability->path_elapsed_time[pathNum]);
+
+  return(nonexistent);
+}  // End of function 'findPath'
+
+
+//
+// Define structure for an index of the cells on one routing layer whose
+// 'pathCenters' arrays are not empty. The Y-coordinates of such cells in column 'x'
+// are stored in ascending order in elements columnStart[x] through
+// columnStart[x+1] - 1 of array 'y'.
+//
+typedef struct PathCenterIndex_t  {
+  int *columnStart;  // Array of 'mapWidth + 1' elements
+  int *y;            // Array of 'numCells' elements
+  int  numCells;     // Number of cells in the index
+  int  maxCells;     // Number of elements allocated for array 'y'
+} PathCenterIndex_t;  // End of struct definition 'PathCenterIndex_t'
+
+
+//-----------------------------------------------------------------------------
+// Name: buildPathCenterIndex
+// Desc: Populate 'index' with the cells on layer 'z' that are traversed by at
+//       least one path-center, visiting the columns in order of increasing x and
+//       the cells in each column in order of increasing y. The arrays of 'index'
+//       are (re-)allocated as needed, and must later be freed with function
+//       freePathCenterIndex(). 'index' must be zeroed before the first call.
+//-----------------------------------------------------------------------------
+static void buildPathCenterIndex(PathCenterIndex_t *index, CellInfo_t ***cellInfo,
+                                 const MapInfo_t *mapInfo, const int z)  {
+
+  if (index->columnStart == NULL)  {
+    index->columnStart = malloc((mapInfo->mapWidth + 1) * sizeof(int));
+    if (index->columnStart == NULL)  {
+      printf("\n\nERROR: Failed to allocate memory for the index of path-centers in a map %d cells wide.\n",
+             mapInfo->mapWidth);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+  }
+
+  index->numCells = 0;
+  for (int x = 0; x < mapInfo->mapWidth; x++)  {
+    index->columnStart[x] = index->numCells;
+    for (int y = 0; y < mapInfo->mapHeight; y++)  {
+      if (cellInfo[x][y][z].numTraversingPathCenters == 0)  {
+        continue;
+      }
+
+      // Grow the array of Y-coordinates if it's full:
+      if (index->numCells == index->maxCells)  {
+        index->maxCells = max(2 * index->maxCells, mapInfo->mapHeight);
+        index->y = realloc(index->y, index->maxCells * sizeof(int));
+        if (index->y == NULL)  {
+          printf("\n\nERROR: Failed to allocate memory for %d cells in the index of path-centers.\n",
+                 index->maxCells);
+          printf(    "       Please inform the software developer of this fatal error.\n\n");
+          exit(1);
+        }
+      }
+      index->y[index->numCells] = y;
+      index->numCells++;
+    }  // End of for-loop for index 'y'
+  }  // End of for-loop for index 'x'
+  index->columnStart[mapInfo->mapWidth] = index->numCells;
+
+}  // End of function 'buildPathCenterIndex'
+
+
+//-----------------------------------------------------------------------------
+// Name: findPathCenterIndexElement
+// Desc: Return the first element of 'index' in column 'x' whose Y-coordinate is
+//       at least 'y'. Returns columnStart[x+1] if there is no such element.
+//-----------------------------------------------------------------------------
+static inline int findPathCenterIndexElement(const PathCenterIndex_t *index, const int x, const int y)  {
+
+  int low  = index->columnStart[x];
+  int high = index->columnStart[x + 1];
+  while (low < high)  {
+    const int middle = (low + high) / 2;
+    if (index->y[middle] < y)  {
+      low = middle + 1;
+    }
+    else  {
+      high = middle;
+    }
+  }  // End of while-loop for (low < high)
+
+  return(low);
+
+}  // End of function 'findPathCenterIndexElement'
+
+
+//-----------------------------------------------------------------------------
+// Name: freePathCenterIndex
+// Desc: Free the memory allocated by function buildPathCenterIndex().
+//-----------------------------------------------------------------------------
+static void freePathCenterIndex(PathCenterIndex_t *index)  {
+
+  free(index->columnStart);  index->columnStart = NULL;
+  free(index->y);            index->y = NULL;
+  index->numCells = 0;
+  index->maxCells = 0;
+
+}  // End of function 'freePathCenterIndex'
+
+
+//
+// Define structure for the design-rule-check results of one cell, which function
+// calcRoutabilityMetrics() records before applying them, so that they can be re-applied
+// in later calls if no nearby path changes. The first 4-byte unit is a header that holds
+// the metal-fill flags (bits 0-5), the number of violations (bits 6-18), and the number of
+// congestion deposits (bits 19-31). The header is followed by 2 units for each violation
+// and then 1 unit for each congestion deposit. Each thread records into its own structure.
+//
+typedef struct DRCRecords_t  {
+  unsigned int *units;        // Header, violations, and congestion deposits
+  int numUnits;               // Number of units in use, including the header
+  int maxUnits;               // Number of units allocated in 'units'
+  int numViolations;          // Number of recorded violations
+  int numDeposits;            // Number of recorded congestion deposits
+  unsigned int fillFlags;     // Metal-fill flags, composed of the DRC_RECORD_*_FILL bits below
+} DRCRecords_t;  // End of struct definition 'DRCRecords_t'
+
+//
+// Bits of the metal-fill flags in DRCRecords_t, which correspond to the flags
+// with similar names in the CellInfo_t structure:
+//
+#define DRC_RECORD_METAL_FILL              0x01
+#define DRC_RECORD_PSEUDO_METAL_FILL       0x02
+#define DRC_RECORD_VIA_ABOVE_FILL          0x04
+#define DRC_RECORD_PSEUDO_VIA_ABOVE_FILL   0x08
+#define DRC_RECORD_VIA_BELOW_FILL          0x10
+#define DRC_RECORD_PSEUDO_VIA_BELOW_FILL   0x20
+
+//
+// Maximum number of violations or congestion deposits in the header of a cell's records:
+//
+#define maxDRCRecordCount  0x1FFF
+
+
+//-----------------------------------------------------------------------------
+// Name: clearDRCRecords
+// Desc: Remove all records from 'records', leaving room for the header unit.
+//-----------------------------------------------------------------------------
+static inline void clearDRCRecords(DRCRecords_t *records)  {
+
+  records->numUnits      = 1;
+  records->numViolations = 0;
+  records->numDeposits   = 0;
+  records->fillFlags     = 0;
+
+}  // End of function 'clearDRCRecords'
+
+
+//-----------------------------------------------------------------------------
+// Name: addDRCRecordUnit
+// Desc: Append the 4-byte unit 'unit' to the records in 'records', increasing
+//       the allocated memory if necessary.
+//-----------------------------------------------------------------------------
+static inline void addDRCRecordUnit(DRCRecords_t *records, const unsigned int unit)  {
+
+  if (records->numUnits >= records->maxUnits)  {
+    records->maxUnits = 2 * records->maxUnits;
+    records->units = realloc(records->units, records->maxUnits * sizeof(unsigned int));
+    if (records->units == NULL)  {
+      printf("\n\nERROR: Failed to allocate memory for %d design-rule-check records of a cell in function 'addDRCRecordUnit'.\n",
+             records->maxUnits);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+  }
+  records->units[records->numUnits] = unit;
+  records->numUnits++;
+
+}  // End of function 'addDRCRecordUnit'
+
+
+//-----------------------------------------------------------------------------
+// Name: recordDRCViolation
+// Desc: Record a violation between path 'path_number' with shape-type 'shape_type'
+//       and path 'interacting_path_num' with shape-type 'interacting_shape_type',
+//       whose path-center is in a cell with design-rule set 'interacting_DR_num'.
+//       Violations must be recorded before any congestion deposits.
+//-----------------------------------------------------------------------------
+static inline void recordDRCViolation(DRCRecords_t *records, const int path_number, const int shape_type,
+                                      const int interacting_path_num, const int interacting_shape_type,
+                                      const int interacting_DR_num)  {
+
+  addDRCRecordUnit(records, (unsigned int)path_number | ((unsigned int)interacting_path_num << 16));
+  addDRCRecordUnit(records, (unsigned int)shape_type | ((unsigned int)interacting_shape_type << 8)
+                              | ((unsigned int)interacting_DR_num << 16));
+  records->numViolations++;
+
+}  // End of function 'recordDRCViolation'
+
+
+//-----------------------------------------------------------------------------
+// Name: recordCongestionDeposit
+// Desc: Record that congestion of path 'path_number' with design-rule subset
+//       'DR_subset' and shape-type 'shape_type' must be added to the cell.
+//-----------------------------------------------------------------------------
+static inline void recordCongestionDeposit(DRCRecords_t *records, const int path_number,
+                                           const int DR_subset, const int shape_type)  {
+
+  addDRCRecordUnit(records, (unsigned int)path_number | ((unsigned int)DR_subset << 16)
+                              | ((unsigned int)shape_type << 24));
+  records->numDeposits++;
+
+}  // End of function 'recordCongestionDeposit'
+
+
+//-----------------------------------------------------------------------------
+// Name: getDRCRecordsHeader
+// Desc: Return the header unit for the records in 'records'.
+//-----------------------------------------------------------------------------
+static inline unsigned int getDRCRecordsHeader(const DRCRecords_t *records)  {
+
+  return(records->fillFlags | ((unsigned int)records->numViolations << 6) | ((unsigned int)records->numDeposits << 19));
+
+}  // End of function 'getDRCRecordsHeader'
+
+
+//-----------------------------------------------------------------------------
+// Name: getDRCRecordsUnits
+// Desc: Return the number of 4-byte units, including the header, of the records
+//       whose header is 'header'.
+//-----------------------------------------------------------------------------
+static inline unsigned int getDRCRecordsUnits(const unsigned int header)  {
+
+  return(1 + 2 * ((header >> 6) & maxDRCRecordCount) + (header >> 19));
+
+}  // End of function 'getDRCRecordsUnits'
+
+
+//-----------------------------------------------------------------------------
+// Name: saveCellDRCRecords
+// Desc: Replace the recorded results of the cell with index 'cellIndex' in
+//       'incrementalDRC' with the records in 'records'. The cell has no recorded
+//       results if 'records' is empty. If the records don't fit in one block of
+//       the slabs, then the cell's results are not saved, and the cell will be
+//       checked again in the next call to calcRoutabilityMetrics().
+//-----------------------------------------------------------------------------
+static void saveCellDRCRecords(IncrementalDRC_t *incrementalDRC, const size_t cellIndex, DRCRecords_t *records)  {
+
+  // Free the cell's previous records:
+  if (incrementalDRC->records[cellIndex] != 0)  {
+    const unsigned int *previousRecords = cellArrayAddress(incrementalDRC->records[cellIndex]);
+    freeDRCRecords(incrementalDRC->records[cellIndex], getDRCRecordsUnits(previousRecords[0]));
+    incrementalDRC->records[cellIndex] = 0;
+  }
+
+  if (   (records->numViolations > maxDRCRecordCount) || (records->numDeposits > maxDRCRecordCount)
+      || (records->numUnits > cellArraySlabUnits))  {
+    incrementalDRC->recheckCell[cellIndex] = TRUE;
+    return;
+  }
+
+  records->units[0] = getDRCRecordsHeader(records);
+  if (records->units[0] != 0)  {
+    incrementalDRC->records[cellIndex] = allocateDRCRecords(records->numUnits);
+    memcpy(cellArrayAddress(incrementalDRC->records[cellIndex]), records->units, records->numUnits * sizeof(unsigned int));
+  }
+  incrementalDRC->recheckCell[cellIndex] = FALSE;
+
+}  // End of function 'saveCellDRCRecords'
+
+
+//
+// Define structure for the working arrays that function calcRoutabilityMetrics() uses
+// to check one cell for design-rule violations and congestion. Each thread allocates
+// its own structure before the cells are checked, and re-uses it for each cell. The
+// (m,n) elements of the 2-dimensional arrays are at index m * maxSubsetShapeTypes + n,
+// where 'maxSubsetShapeTypes' is the largest number of design-rule subsets in any
+// design-rule set, multiplied by NUM_SHAPE_TYPES. The lists of interacting nets and
+// congestion nets start small and are enlarged as needed.
+//
+typedef struct DRCScanScratch_t  {
+  int maxSubsetShapeTypes;                 // Number of rows and columns in the 2-dimensional arrays
+  int *interaction_count;                  // Number of elements in use in each list of 'interacting_nets'
+  int *interaction_capacity;               // Number of elements allocated in each list of 'interacting_nets'
+  Path_DR_Shape_Info_t **interacting_nets; // Lists of nets that interact with the cell
+  int *congestion_count;                   // Number of elements in use in each list of 'congestion_nets'
+  int *congestion_capacity;                // Number of elements allocated in each list of 'congestion_nets'
+  short **congestion_nets;                 // Lists of nets whose congestion is added to the cell
+  Path_DR_Shape_Info_t *overlapping_nets;  // Nets and shape-types that overlap the cell, with one element
+                                           // for each combination of net and shape-type
+  DRCPairSet_t current_cell_DRCs;          // Design-rule violations found at the cell
+} DRCScanScratch_t;  // End of struct definition 'DRCScanScratch_t'
+
+//
+// Initial number of elements in each list of interacting nets and congestion nets
+// in the DRCScanScratch_t structure:
+//
+#define initialDRCScanListLength 8
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateDRCScanScratch
+// Desc: Allocate the arrays of a DRCScanScratch_t structure for 'total_nets'
+//       nets and pseudo-nets and the design-rule sets in 'user_inputs'. The
+//       memory must later be freed with function freeDRCScanScratch().
+//-----------------------------------------------------------------------------
+static void allocateDRCScanScratch(DRCScanScratch_t *scratch, const int total_nets,
+                                   const InputValues_t *user_inputs)  {
+
+  scratch->maxSubsetShapeTypes = NUM_SHAPE_TYPES;
+  for (int DR_num = 0; DR_num < user_inputs->numDesignRuleSets; DR_num++)  {
+    scratch->maxSubsetShapeTypes = max(scratch->maxSubsetShapeTypes,
+                                       user_inputs->numDesignRuleSubsets[DR_num] * NUM_SHAPE_TYPES);
+  }
+  const int numLists = scratch->maxSubsetShapeTypes * scratch->maxSubsetShapeTypes;
+
+  scratch->interaction_count    = calloc(numLists, sizeof(int));
+  scratch->interaction_capacity = malloc(numLists * sizeof(int));
+  scratch->interacting_nets     = malloc(numLists * sizeof(Path_DR_Shape_Info_t *));
+  scratch->congestion_count     = calloc(numLists, sizeof(int));
+  scratch->congestion_capacity  = malloc(numLists * sizeof(int));
+  scratch->congestion_nets      = malloc(numLists * sizeof(short *));
+  scratch->overlapping_nets     = malloc(total_nets * NUM_SHAPE_TYPES * sizeof(Path_DR_Shape_Info_t));
+  if (   (scratch->interaction_count == NULL) || (scratch->interaction_capacity == NULL)
+      || (scratch->interacting_nets == NULL)  || (scratch->congestion_count == NULL)
+      || (scratch->congestion_capacity == NULL) || (scratch->congestion_nets == NULL)
+      || (scratch->overlapping_nets == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the working arrays of the design-rule check.\n");
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit(1);
+  }
+
+  for (int i = 0; i < numLists; i++)  {
+    scratch->interaction_capacity[i] = initialDRCScanListLength;
+    scratch->interacting_nets[i]     = malloc(initialDRCScanListLength * sizeof(Path_DR_Shape_Info_t));
+    scratch->congestion_capacity[i]  = initialDRCScanListLength;
+    scratch->congestion_nets[i]      = malloc(initialDRCScanListLength * sizeof(short));
+    if ((scratch->interacting_nets[i] == NULL) || (scratch->congestion_nets[i] == NULL))  {
+      printf("\n\nERROR: Failed to allocate memory for the working arrays of the design-rule check.\n");
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+  }  // End of for-loop for index 'i'
+
+  allocateDRCPairSet(&(scratch->current_cell_DRCs), 64);
+
+}  // End of function 'allocateDRCScanScratch'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeDRCScanScratch
+// Desc: Free the memory allocated by function allocateDRCScanScratch().
+//-----------------------------------------------------------------------------
+static void freeDRCScanScratch(DRCScanScratch_t *scratch)  {
+
+  const int numLists = scratch->maxSubsetShapeTypes * scratch->maxSubsetShapeTypes;
+  for (int i = 0; i < numLists; i++)  {
+    free(scratch->interacting_nets[i]);  scratch->interacting_nets[i] = NULL;
+    free(scratch->congestion_nets[i]);   scratch->congestion_nets[i] = NULL;
+  }
+  free(scratch->interaction_count);     scratch->interaction_count = NULL;
+  free(scratch->interaction_capacity);  scratch->interaction_capacity = NULL;
+  free(scratch->interacting_nets);      scratch->interacting_nets = NULL;
+  free(scratch->congestion_count);      scratch->congestion_count = NULL;
+  free(scratch->congestion_capacity);   scratch->congestion_capacity = NULL;
+  free(scratch->congestion_nets);       scratch->congestion_nets = NULL;
+  free(scratch->overlapping_nets);      scratch->overlapping_nets = NULL;
+  freeDRCPairSet(&(scratch->current_cell_DRCs));
+
+}  // End of function 'freeDRCScanScratch'
+
+
+//-----------------------------------------------------------------------------
+// Name: addInteractingNet
+// Desc: Append the path number, design-rule number, and shape-type to list
+//       'listIndex' of the interacting nets in 'scratch', enlarging the list
+//       if it's full.
+//-----------------------------------------------------------------------------
+static inline void addInteractingNet(DRCScanScratch_t *scratch, const int listIndex, const int path_number,
+                                     const int DR_num, const int shape_type)  {
+
+  if (scratch->interaction_count[listIndex] == scratch->interaction_capacity[listIndex])  {
+    scratch->interaction_capacity[listIndex] *= 2;
+    scratch->interacting_nets[listIndex] = realloc(scratch->interacting_nets[listIndex],
+                                                   scratch->interaction_capacity[listIndex] * sizeof(Path_DR_Shape_Info_t));
+    if (scratch->interacting_nets[listIndex] == NULL)  {
+      printf("\n\nERROR: Failed to re-allocate memory for a list of %d interacting nets.\n", scratch->interaction_capacity[listIndex]);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+  }  // End of if-block for full list
+
+  Path_DR_Shape_Info_t *entry = &(scratch->interacting_nets[listIndex][ scratch->interaction_count[listIndex] ]);
+  entry->pathNum   = path_number;
+  entry->DR_num    = DR_num;
+  entry->shapeType = shape_type;
+  scratch->interaction_count[listIndex]++;
+
+}  // End of function 'addInteractingNet'
+
+
+//-----------------------------------------------------------------------------
+// Name: addCongestionNet
+// Desc: Append the path number to list 'listIndex' of the congestion nets in
+//       'scratch', enlarging the list if it's full.
+//-----------------------------------------------------------------------------
+static inline void addCongestionNet(DRCScanScratch_t *scratch, const int listIndex, const int path_number)  {
+
+  if (scratch->congestion_count[listIndex] == scratch->congestion_capacity[listIndex])  {
+    scratch->congestion_capacity[listIndex] *= 2;
+    scratch->congestion_nets[listIndex] = realloc(scratch->congestion_nets[listIndex],
+                                                  scratch->congestion_capacity[listIndex] * sizeof(short));
+    if (scratch->congestion_nets[listIndex] == NULL)  {
+      printf("\n\nERROR: Failed to re-allocate memory for a list of %d congestion nets.\n", scratch->congestion_capacity[listIndex]);
+      printf(    "       Please inform the software developer of this fatal error.\n\n");
+      exit(1);
+    }
+  }  // End of if-block for full list
+
+  scratch->congestion_nets[listIndex][ scratch->congestion_count[listIndex] ] = path_number;
+  scratch->congestion_count[listIndex]++;
+
+}  // End of function 'addCongestionNet'
+
+
+//-----------------------------------------------------------------------------
+// Name: markDRCRecheckBox
+// Desc: Flag the cells in 'incrementalDRC' that must be checked again because a
+//       path-center at 'coordinate' was added or removed. These are the cells on
+//       the same layer within the larger of 1 cell and the maximum interaction
+//       radius of the layer, which is the region within which function
+//       markCellsNearCenterlinesInMap() flags cells as near a net.
+//-----------------------------------------------------------------------------
+static void markDRCRecheckBox(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo, const Coordinate_t coordinate)  {
+
+  if (pointIsOutsideOfMap(coordinate, mapInfo))  {
+    return;
+  }
+
+  const int z = coordinate.Z;
+  const int radius = max(1, (int)mapInfo->maxInteractionRadiusCellsOnLayer[z]);
+  const int x_min = max((int)coordinate.X - radius, 0);
+  const int x_max = min((int)coordinate.X + radius, (int)mapInfo->mapWidth - 1);
+  const int y_min = max((int)coordinate.Y - radius, 0);
+  const int y_max = min((int)coordinate.Y + radius, (int)mapInfo->mapHeight - 1);
+  for (int x = x_min; x <= x_max; x++)  {
+    size_t cellIndex = ((size_t)x * mapInfo->mapHeight + y_min) * mapInfo->numLayers + z;
+    for (int y = y_min; y <= y_max; y++)  {
+      incrementalDRC->recheckCell[cellIndex] = TRUE;
+      cellIndex += mapInfo->numLayers;
+    }  // End of for-loop for index 'y'
+  }  // End of for-loop for index 'x'
+
+}  // End of function 'markDRCRecheckBox'
+
+
+//-----------------------------------------------------------------------------
+// Name: markChangedDRCRegions
+// Desc: Compare the contiguous path of each net with its path at the previous
+//       call to calcRoutabilityMetrics(), which is saved in 'incrementalDRC', and
+//       flag the cells near the changed parts of the paths to be checked again.
+//       The changed part of a path is found by skipping the segments that the
+//       old and new paths share at their beginnings and at their ends. Because a
+//       segment's shape-type depends on its neighbors, the last shared segment
+//       before the changed part is treated as changed. The new paths are then
+//       saved in 'incrementalDRC'. Returns the number of nets whose paths changed.
+//-----------------------------------------------------------------------------
+static int markChangedDRCRegions(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo,
+                                 const int contiguousPathLength[], Coordinate_t *contigPathCoords[])  {
+
+  int numChangedNets = 0;
+
+  for (int path = 0; path < incrementalDRC->numNets; path++)  {
+    const int oldLength = incrementalDRC->contigPathLength[path];
+    const int newLength = contiguousPathLength[path];
+    const Coordinate_t *oldCoords = incrementalDRC->contigPathCoords[path];
+    const Coordinate_t *newCoords = contigPathCoords[path];
+    const int minLength = min(oldLength, newLength);
+
+    // Count the segments that the old and new paths share at their beginnings:
+    int numPrefix = 0;
+    while (   (numPrefix < minLength)
+           && (oldCoords[numPrefix].X == newCoords[numPrefix].X)
+           && (oldCoords[numPrefix].Y == newCoords[numPrefix].Y)
+           && (oldCoords[numPrefix].Z == newCoords[numPrefix].Z))  {
+      numPrefix++;
+    }
+    if ((numPrefix == oldLength) && (numPrefix == newLength))  {
+      continue;  // The path is unchanged
+    }
+    numChangedNets++;
+
+    // Count the remaining segments that the old and new paths share at their ends:
+    int numSuffix = 0;
+    while (   (numSuffix < minLength - numPrefix)
+           && (oldCoords[oldLength - 1 - numSuffix].X == newCoords[newLength - 1 - numSuffix].X)
+           && (oldCoords[oldLength - 1 - numSuffix].Y == newCoords[newLength - 1 - numSuffix].Y)
+           && (oldCoords[oldLength - 1 - numSuffix].Z == newCoords[newLength - 1 - numSuffix].Z))  {
+      numSuffix++;
     }
 
-    // c. Now copy the path information over to the path coordinates array.
-    //    Since we are working backwards from the target to the start location,
-    //    we copy the information to the data bank in reverse order. The result
-    //    is a properly ordered set of path data, from the first step to the last.
-    pathX = endCoord.X;
-    pathY = endCoord.Y;
-    pathZ = endCoord.Z;
-    cellPosition = *pathLength;  //start at the end
-    #ifdef DEBUG_findPath
-    if (DEBUG_ON)  {
-      printf("\nDEBUG: (thread %2d) For path #%d ('%s'), target cell is (%d,%d,%d)\n", omp_get_thread_num(), pathNum, user_inputs->net_name[pathNum], pathX, pathY, pathZ);
-      printf("DEBUG: (thread %2d) Entering do/while loop to determine path...\n", omp_get_thread_num());
+    // Flag the cells near the changed segments of the old and new paths, including the
+    // shared segments adjacent to the changed segments:
+    for (int segment = max(numPrefix - 1, 0); segment <= min(oldLength - numSuffix, oldLength - 1); segment++)  {
+      markDRCRecheckBox(incrementalDRC, mapInfo, oldCoords[segment]);
+    }
+    for (int segment = max(numPrefix - 1, 0); segment <= min(newLength - numSuffix, newLength - 1); segment++)  {
+      markDRCRecheckBox(incrementalDRC, mapInfo, newCoords[segment]);
     }
-    #endif
-    do  {
-      cellPosition = cellPosition - 1;  // Work backwards by 1 cell position in the path
-      (*pathCoords)[cellPosition].X    = pathX;
-      (*pathCoords)[cellPosition].Y    = pathY;
-      (*pathCoords)[cellPosition].Z    = pathZ;
-      (*pathCoords)[cellPosition].flag = FALSE;
 
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("DEBUG: (thread %2d) At end of function 'findPath' for path %d, segment %d = (%d,%d,%d)\n",
-               omp_get_thread_num(), pathNum, cellPosition, (*pathCoords)[cellPosition].X, (*pathCoords)[cellPosition].Y, (*pathCoords)[cellPosition].Z);
+    // Save the new path:
+    if (newLength > incrementalDRC->maxContigPathLength[path])  {
+      incrementalDRC->maxContigPathLength[path] = newLength;
+      incrementalDRC->contigPathCoords[path] = realloc(incrementalDRC->contigPathCoords[path], newLength * sizeof(Coordinate_t));
+      if (incrementalDRC->contigPathCoords[path] == NULL)  {
+        printf("\n\nERROR: Failed to allocate memory for %d path segments of net #%d in function 'markChangedDRCRegions'.\n",
+               newLength, path);
+        printf(    "       Please inform the software developer of this fatal error.\n\n");
+        exit(1);
       }
-      #endif
-
-      // d. Look up the parent of the current cell.
-      tempx = pathFinding->parentCoords[pathX][pathY][pathZ].X;
-      tempy = pathFinding->parentCoords[pathX][pathY][pathZ].Y;
-      tempz = pathFinding->parentCoords[pathX][pathY][pathZ].Z;
-      pathZ = tempz;
-      pathY = tempy;
-      pathX = tempx;
+    }
+    if (newLength > 0)  {
+      memcpy(incrementalDRC->contigPathCoords[path], newCoords, newLength * sizeof(Coordinate_t));
+    }
+    incrementalDRC->contigPathLength[path] = newLength;
 
-      #ifdef DEBUG_findPath
-      if (DEBUG_ON)  {
-        printf("DEBUG: (thread %2d)    Segment %d of path %d: (%d,%d,%d)\n", omp_get_thread_num(), cellPosition, pathNum, pathX, pathY, pathZ);
-      }
-      #endif
+  }  // End of for-loop for index 'path'
 
-      // e. If we have reached the starting cell, exit the loop.
-    }  // End of do/while-block
-    while ((pathX != startCoord.X) || (pathY != startCoord.Y) || (pathZ != startCoord.Z));
+  return(numChangedNets);
 
-    #ifdef DEBUG_findPath
-    if (DEBUG_ON)  {
-      printf("DEBUG: (thread %2d) Finished Step 9.\n", omp_get_thread_num());
-    }
-    #endif
+}  // End of function 'markChangedDRCRegions'
 
-  }  // End of if-block for (path == found)
 
-  // Calculate elapsed (wall-clock) time to find this path:
-  if (record_elapsed_time)  {
-    end = time(NULL);
-    routability->path_elapsed_time[pathNum] = (int) (end - start);
-    // printf("DEBUG: In iteration %d, path %d took %d seconds to find.\n", mapInfo->current_iteration, pathNum, routability->path_elapsed_time[pathNum]);
+//-----------------------------------------------------------------------------
+// Name: allocateIncrementalDRC
+// Desc: Allocate the arrays of 'incrementalDRC' for the main map described by
+//       'mapInfo', such that the first call to calcRoutabilityMetrics() checks
+//       every cell. The memory must later be freed by function
+//       freeIncrementalDRC().
+//-----------------------------------------------------------------------------
+void allocateIncrementalDRC(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo)  {
+
+  const size_t num_map_cells = (size_t)mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers;
+
+  incrementalDRC->numNets   = mapInfo->numPaths + mapInfo->numPseudoPaths;
+  incrementalDRC->numChecks = 0;
+  incrementalDRC->contigPathLength    = calloc(incrementalDRC->numNets, sizeof(int));
+  incrementalDRC->maxContigPathLength = calloc(incrementalDRC->numNets, sizeof(int));
+  incrementalDRC->contigPathCoords    = calloc(incrementalDRC->numNets, sizeof(Coordinate_t *));
+  incrementalDRC->recheckCell         = malloc(num_map_cells * sizeof(unsigned char));
+  incrementalDRC->records             = calloc(num_map_cells, sizeof(CellArrayHandle_t));
+  if (   (incrementalDRC->contigPathLength == NULL) || (incrementalDRC->maxContigPathLength == NULL)
+      || (incrementalDRC->contigPathCoords == NULL) || (incrementalDRC->recheckCell == NULL)
+      || (incrementalDRC->records == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the design-rule-check results of %'lu cells in function 'allocateIncrementalDRC'.\n",
+           num_map_cells);
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit(1);
   }
+  memset(incrementalDRC->recheckCell, TRUE, num_map_cells * sizeof(unsigned char));
 
-  #ifdef DEBUG_findPath
-  if (DEBUG_ON)  {
-    // Return the G-cost of the full path:
-    printf("DEBUG: (thread %2d) About to return from 'findPath()'. Gcost = %'lu. Number of segments = %d.\n\n",
-           omp_get_thread_num(), total_Gcost, *pathLength);
-  }
-  #endif
+}  // End of function 'allocateIncrementalDRC'
 
-  return(total_Gcost);
 
-noPath:
-  // 13. There is no path to the selected target
+//-----------------------------------------------------------------------------
+// Name: freeIncrementalDRC
+// Desc: Free the memory allocated by function allocateIncrementalDRC(), including
+//       the recorded results of each cell.
+//-----------------------------------------------------------------------------
+void freeIncrementalDRC(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo)  {
 
-  #ifdef DEBUG_findPath
-  if (DEBUG_ON)  {
-    printf("DEBUG: (thread %2d) Exiting function 'findPath' through the 'noPath' label.\n", omp_get_thread_num());
-  }
-  #endif
+  const size_t num_map_cells = (size_t)mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers;
+  for (size_t cellIndex = 0; cellIndex < num_map_cells; cellIndex++)  {
+    if (incrementalDRC->records[cellIndex] != 0)  {
+      const unsigned int *records = cellArrayAddress(incrementalDRC->records[cellIndex]);
+      freeDRCRecords(incrementalDRC->records[cellIndex], getDRCRecordsUnits(records[0]));
+    }
+  }  // End of for-loop for index 'cellIndex'
 
-  // Calculate elapsed (wall-clock) time to find this path:
-  if (record_elapsed_time)  {
-    end = time(NULL);
-    routability->path_elapsed_time[pathNum] = (int) (end - start);
+  for (int path = 0; path < incrementalDRC->numNets; path++)  {
+    free(incrementalDRC->contigPathCoords[path]);
   }
+  free(incrementalDRC->contigPathCoords);     incrementalDRC->contigPathCoords    = NULL;
+  free(incrementalDRC->contigPathLength);     incrementalDRC->contigPathLength    = NULL;
+  free(incrementalDRC->maxContigPathLength);  incrementalDRC->maxContigPathLength = NULL;
+  free(incrementalDRC->recheckCell);          incrementalDRC->recheckCell         = NULL;
+  free(incrementalDRC->records);              incrementalDRC->records             = NULL;
 
-  printf("\nINFO: No path was found to route net #%d ('%s') after exploring %'d cells in %'d seconds.\n\n",
-         pathNum, user_inputs->net_name[pathNum], newOpenListItemID, routability->path_elapsed_time[pathNum]);
-
-  return(nonexistent);
-}  // End of function 'findPath'
+}  // End of function 'freeIncrementalDRC'
 
 
 //-----------------------------------------------------------------------------
@@ -3521,6 +5329,11 @@ noPath:
 //       to STDOUT. This can be useful when calculating routability metrics for
 //       many small sub-maps. If 'parallelProcessing' is TRUE, then processing is
 //       performed in multiple threads.
+//
+//       If 'mapInfo->incrementalDRC' is not NULL, then only the cells near nets
+//       whose contiguous paths changed since the previous call are checked for
+//       design-rule violations and congestion. The recorded results of the other
+//       cells are re-applied, which produces the same results as checking them.
 //-----------------------------------------------------------------------------
 //
 // Define 'DEBUG_routability' and re-compile if you want verbose debugging print-statements enabled:
@@ -3642,6 +5455,15 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
 ////  // non_pseudo_trace2via_DRC_count_per_thread[i] = Number of trace-to-viae spacing violations found by CPU thread 'i'.
 ////  int non_pseudo_trace2via_DRC_count_per_thread[num_threads];
 
+  // DRC_records_per_thread[i] = Design-rule-check results of the cell being checked by CPU thread 'i',
+  //                             which are recorded before they're applied to the cell:
+  DRCRecords_t *DRC_records_per_thread;
+  DRC_records_per_thread = malloc(num_threads * sizeof(DRCRecords_t));
+  for (int i = 0; i < num_threads; i++)  {
+    DRC_records_per_thread[i].maxUnits = 256;
+    DRC_records_per_thread[i].units = malloc(DRC_records_per_thread[i].maxUnits * sizeof(unsigned int));
+  }
+
 
 
 
@@ -3660,16 +5482,16 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
   // (if applicable) pseudo nets for differential pairs:
   int total_nets = mapInfo->numPaths + mapInfo->numPseudoPaths;
 
-  // Calculate the maximum possible number of DRC interactions between all nets
-  // and all shape-types, which will be used to dimension arrays:
-  const int max_DRC_interactions = (total_nets * total_nets  -  total_nets) * NUM_SHAPE_TYPES * NUM_SHAPE_TYPES / 2;
+  // DRC_scratch_per_thread[i] = Working arrays used by CPU thread 'i' to check a cell for
+  //                             design-rule violations and congestion:
+  DRCScanScratch_t *DRC_scratch_per_thread;
+  DRC_scratch_per_thread = malloc(num_threads * sizeof(DRCScanScratch_t));
+  for (int i = 0; i < num_threads; i++)  {
+    allocateDRCScanScratch(&(DRC_scratch_per_thread[i]), total_nets, user_inputs);
+  }
 
-  // Calculate the number of 8-bit bytes needed for max_DRC_interactions bits. Add 1 byte for safety.
-  const int DRC_interaction_byte_length = max_DRC_interactions/8 + 1;
   #ifdef DEBUG_routability
   if (DEBUG_ON)  {
-    printf("DEBUG: (thread %2d) DRC_interaction_byte_length=%d, because max_DRC_interactions=%d.\n", omp_get_thread_num(),
-            DRC_interaction_byte_length, max_DRC_interactions);
     printf("DEBUG: (thread %2d) Entered calcRoutabilityMetrics. routability->total_num_DRC_cells is %d before re-initializing variables.\n",
            omp_get_thread_num(), (*routability).total_num_DRC_cells);
   }
@@ -3817,10 +5639,31 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
   }  // End of for-loop for index 'i'
 
 
+  //
+  // If the design-rule-check results from the previous call are available, then flag the
+  // cells near the nets whose contiguous paths changed, which must be checked again. All
+  // cells are checked in the first call, and when congestion is added for only one diff-pair:
+  //
+  IncrementalDRC_t *incrementalDRC = mapInfo->incrementalDRC;
+  int recheckAllCells = TRUE;
+  if (incrementalDRC != NULL)  {
+    const int numChangedNets = markChangedDRCRegions(incrementalDRC, mapInfo, contiguousPathLength, contigPathCoords);
+    if ((incrementalDRC->numChecks > 0) && (addCongOnlyForDiffPair == ADD_CONGESTION_FOR_ALL_NETS))  {
+      recheckAllCells = FALSE;
+      if (DEBUG_ON || ! beQuiet)  {
+        printf("INFO: (thread %2d) Checking only the cells near the %d of %d nets whose paths changed since the previous design-rule check.\n",
+               omp_get_thread_num(), numChangedNets, total_nets);
+      }
+    }
+  }  // End of if-block for (incrementalDRC != NULL)
+
   //
   // Visit each (x,y,z) location in the map to determine whether it violates
-  // any design rules, and whether to add congestion to the cell.
+  // any design rules, and whether to add congestion to the cell. Only the cells
+  // that contain path-centers can interact with a location, so these cells are
+  // indexed for each layer before the layer is checked:
   //
+  PathCenterIndex_t pathCenterIndex = {NULL, NULL, 0, 0};
   time_t tim = time(NULL);
   struct tm *now = localtime(&tim);
   if (DEBUG_ON || ! beQuiet)  {
@@ -3841,6 +5684,9 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
     // our calculations to cells close to nets.
     const int interaction_radius = mapInfo->maxInteractionRadiusCellsOnLayer[z];
     const int radius_squared     = mapInfo->maxInteractionRadiusSquaredOnLayer[z] ;
+
+    // Index the cells on layer 'z' that contain path-centers:
+    buildPathCenterIndex(&pathCenterIndex, cellInfo, mapInfo, z);
     #ifdef DEBUG_routability
     if (DEBUG_ON)  {
       printf("DEBUG: (thread %2d) interaction_radius = maxInteractionRadiusCellsOnLayer[%d] = %d\n", omp_get_thread_num(),
@@ -3874,10 +5720,26 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
         }
         #endif
 
+        // Determine whether the results of cell (x,y,z) must be calculated, or whether the
+        // results recorded in the previous call can be re-applied. The recorded results
+        // of a cell that is no longer near a net are discarded:
+        size_t cellIndex = 0;
+        int recheckCell = TRUE;
+        if (incrementalDRC != NULL)  {
+          cellIndex = ((size_t)x * mapInfo->mapHeight + y) * mapInfo->numLayers + z;
+          recheckCell = recheckAllCells || incrementalDRC->recheckCell[cellIndex];
+          if (recheckCell && ! cellInfo[x][y][z].near_a_net)  {
+            clearDRCRecords(&(DRC_records_per_thread[omp_get_thread_num()]));
+            saveCellDRCRecords(incrementalDRC, cellIndex, &(DRC_records_per_thread[omp_get_thread_num()]));
+          }
+        }  // End of if-block for (incrementalDRC != NULL)
+
         // If the current (x,y,z) location is not near a net, then
         // there's no reason to check for design-rule violations.
-        // In such cases, continue on to the next (x,y,z) location:
-        if (cellInfo[x][y][z].near_a_net)  {
+        // In such cases, continue on to the next (x,y,z) location.
+        // The results of the cell are recorded in 'DRC_records_per_thread',
+        // and applied to the cell further below:
+        if (cellInfo[x][y][z].near_a_net && recheckCell)  {
 
           // We got here, so the cell at (x,y,z) is within an 'interaction distance' of a path's
           // centerline, based on the design rules used on the layer 'z'.
@@ -3885,6 +5747,10 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           // Get the thread number used for this (x,y,z) location:
           const short current_thread = omp_get_thread_num();
 
+          // Start an empty record of the results at this (x,y,z) location:
+          DRCRecords_t *records = &(DRC_records_per_thread[current_thread]);
+          clearDRCRecords(records);
+
           // printf("  DEBUG: (thread %2d) Analyzing location (%d, %d, %d) for DRCs in parallel-processing part of code, with omp_get_num_threads = %d and omp_get_nested = %d...\n",
           //        omp_get_thread_num(), x, y, z, omp_get_num_threads(), omp_get_nested());
 
@@ -3899,13 +5765,14 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           // dimensioning arrays that we use for design-rule checking and congestion.
           const short num_subset_shapeType_indices = num_source_DR_subsets * NUM_SHAPE_TYPES;
 
-          // Calculate the product of the number of nets and the number of shape-types
-          // (3, or NUM_SHAPE_TYPES).  This product is used for dimensioning arrays
-          // that we use for design-rule checking and congestion.
-          const short num_path_shapeType_indices = total_nets * NUM_SHAPE_TYPES;
+          // Get the working arrays of the current thread. The 2-dimensional arrays below
+          // are views of these arrays with 'maxSubsetShapeTypes' columns, of which the
+          // first 'num_subset_shapeType_indices' rows and columns are used for (x,y,z):
+          DRCScanScratch_t *scratch = &(DRC_scratch_per_thread[current_thread]);
+          const int maxSubsetShapeTypes = scratch->maxSubsetShapeTypes;
 
 
-          // Create the 2-dimensional interaction matrix 'interaction_count[m,n]'
+          // Use the 2-dimensional interaction matrix 'interaction_count[m,n]'
           // that will count the number of interacting nets at a
           // given (x,y,z) location. Interacting nets are those where the
           // perimeter of one shape is separated from the center of an adjacent
@@ -3915,18 +5782,18 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           // shape-types. The value of interaction_count[m,n] represents the
           // number of UNIQUE nets that interact between designRuleSubset/shape-type 'm'
           // and designRuleSubset/shape-type 'n' at a given (x,y,z) location.
-          short interaction_count[num_subset_shapeType_indices][num_subset_shapeType_indices];
+          int (*interaction_count)[maxSubsetShapeTypes] = (int (*)[maxSubsetShapeTypes]) scratch->interaction_count;
 
-          // Create the 3D matrix 'interacting_nets[m,n,p]' that will track the
+          // Use the 3D matrix 'interacting_nets[m,n,p]' that will track the
           // path numbers and shape-types that interact with a given (x,y,z) position.
           // The indices m and n represent all possible combinations of design-rule
-          // sub-types and shape-types. Index 'p' varies from 0 to up to a maximum
-          // of maxNets * NUM_SHAPE_TYPES, and lists the unique path numbers and
-          // shape-types that interact between designRuleSubset/shape-type m and
-          // designRuleSubset/shape-type n at a given location.
-          Path_DR_Shape_Info_t interacting_nets[num_subset_shapeType_indices][num_subset_shapeType_indices][num_path_shapeType_indices];
+          // sub-types and shape-types. Index 'p' varies from 0 to interaction_count[m,n] - 1,
+          // and lists the unique path numbers and shape-types that interact between
+          // designRuleSubset/shape-type m and designRuleSubset/shape-type n at a given
+          // location. Elements are added with function addInteractingNet().
+          Path_DR_Shape_Info_t *(*interacting_nets)[maxSubsetShapeTypes] = (Path_DR_Shape_Info_t *(*)[maxSubsetShapeTypes]) scratch->interacting_nets;
 
-          // Create the 2-dimensional matrix 'congestion_count[m,n]' that
+          // Use the 2-dimensional matrix 'congestion_count[m,n]' that
           // will count the number of nets whose congestion must be added to
           // location (x,y,z). These nets are those whose center-line (or center)
           // is separated from the center of an adjacent shape by a distance
@@ -3937,31 +5804,27 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           // congestion_count[m,n] represents the number of UNIQUE nets whose congestion must be
           // added to (x,y,z) with designRuleSubset/shape-type 'm' and
           // designRuleSubset/shape-type 'n'.
-          short congestion_count[num_subset_shapeType_indices][num_subset_shapeType_indices];
+          int (*congestion_count)[maxSubsetShapeTypes] = (int (*)[maxSubsetShapeTypes]) scratch->congestion_count;
 
-          // Create the 3D matrix 'congestion_nets[m,n,p]' that will track the
+          // Use the 3D matrix 'congestion_nets[m,n,p]' that will track the
           // path numbers whose congestion must be added to a given (x,y,z) position.
           // The indices m and n represent all possible combinations of design-rule
-          // sub-types and shape-types. Index 'p' varies from 0 to up to a maximum
-          // of total_nets, and lists the unique path numbers.
-          short congestion_nets[num_subset_shapeType_indices][num_subset_shapeType_indices][total_nets];
+          // sub-types and shape-types. Index 'p' varies from 0 to congestion_count[m,n] - 1,
+          // and lists the unique path numbers. Elements are added with function
+          // addCongestionNet().
+          short *(*congestion_nets)[maxSubsetShapeTypes] = (short *(*)[maxSubsetShapeTypes]) scratch->congestion_nets;
 
-          // Define 1-dimensional array that lists the unique path-numbers, design-rule numbers,
+          // Use the 1-dimensional array that lists the unique path-numbers, design-rule numbers,
           // and shape-types that overlap a given (x,y,z) location.
-          Path_DR_Shape_Info_t overlapping_nets[num_path_shapeType_indices];
-
-
-          // Create and initialize a 1-dimensional array of 1-bit Boolean flags disguised
-          // as type 'char' to save memory. Each element (bit) in the array corresponds
-          // to a unique combination of these 4 variables: path_1, shapeType_1,
-          // path_2, and shapeType_2. This function sets a bit equals 1 if it finds a
-          // DRC violation between path_1/shapeType_1 and path_2/shapeType_2.
-          char current_cell_DRCs[DRC_interaction_byte_length];
-          // printf("DEBUG: Dimensioned 'current_cell_DRCs[]' array to a length of %d.\n", DRC_interaction_byte_length);
-          for (int i = 0; i < DRC_interaction_byte_length; i++)  {
-            current_cell_DRCs[i] = 0;  // Initialize each element to zero.
-            // printf("DEBUG: Initialized current_cell_DRCs[%d] to zero.\n", i);
-          }
+          Path_DR_Shape_Info_t *overlapping_nets = scratch->overlapping_nets;
+
+
+          // Clear the set of DRC violations found at (x,y,z). Each element of the set
+          // is a unique combination of these 4 variables: path_1, shapeType_1, path_2,
+          // and shapeType_2, for which a DRC violation was found between path_1/shapeType_1
+          // and path_2/shapeType_2. Only the elements added at the previous cell are cleared:
+          DRCPairSet_t *current_cell_DRCs = &(scratch->current_cell_DRCs);
+          clearDRCPairSet(current_cell_DRCs);
 
 
           // Clear the variable num_overlapping_nets, which is the number of
@@ -3982,17 +5845,23 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           }  // End of for-loop for index 'm'
 
           //
-          // Explore the cells around current location (x,y,z) by rastering over a box
-          // with sides +/- interaction_radius.
+          // Explore the cells around current location (x,y,z) that contain path-centers,
+          // within a box with sides +/- interaction_radius. The cells are visited in the
+          // same order as a raster over the box, using the index of path-center cells.
           //
           #ifdef DEBUG_routability
           if (FOUND_XYZ)  {
             printf("  DEBUG: (thread %2d) About to raster around (%d, %d, %d) by +/-%d...\n", omp_get_thread_num(), x, y, z, interaction_radius);
           }
           #endif
-          for (int x_prime = x - interaction_radius; x_prime <= x + interaction_radius; x_prime++)  {
+          const int x_prime_min = max(x - interaction_radius, 0);
+          const int x_prime_max = min(x + interaction_radius, mapInfo->mapWidth - 1);
+          for (int x_prime = x_prime_min; x_prime <= x_prime_max; x_prime++)  {
             const int delta_x_squared = (x - x_prime)  *  (x - x_prime);
-            for (int y_prime = y - interaction_radius; y_prime <= y + interaction_radius; y_prime++)  {
+            const int first_element = findPathCenterIndexElement(&pathCenterIndex, x_prime, y - interaction_radius);
+            const int end_element   = findPathCenterIndexElement(&pathCenterIndex, x_prime, y + interaction_radius + 1);
+            for (int element = first_element; element < end_element; element++)  {
+              const int y_prime = pathCenterIndex.y[element];
               #ifdef DEBUG_routability
               int FOUND_XprimeYprimeZprime;
               if (DEBUG_ON && FOUND_XYZ && (DEBUG_Xprime >= 0) && (x_prime == DEBUG_Xprime) && (DEBUG_Yprime >= 0) && (y_prime == DEBUG_Yprime))  {
@@ -4017,16 +5886,6 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                 continue;
               }
 
-              // If (x_prime, y_prime) is outside of the map, then move on to
-              // next (x_prime, y_prime) location. Use the '__builtin_expect' compiler
-              // directive to tell the compiler to expect the result to be FALSE more often than TRUE:
-              if (__builtin_expect( ((x_prime < 0) || (x_prime >= mapInfo->mapWidth) ||
-                  (y_prime < 0) || (y_prime >= mapInfo->mapHeight)), 0 ))  {
-                // printf("      DEBUG: Skipping (x',y',z) = (%d, %d, %d) because it's outside of the map.\n", x_prime, y_prime, z);
-                continue;
-              }
-
-
               // If cell (x',y',z) is in pin-swappable zone, then move on to the next
               // (x,y,z) location. Use the '__builtin_expect' compiler directive to tell
               // the compiler to expect the 'swap_zone' to be zero more often than TRUE:
@@ -4055,8 +5914,8 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
               for (int i = 0; i < numTraversingPaths; i++)  {
 
                 // Get path number and shape-type of path whose center is at (x',y',z):
-                const short path_number     = cellInfo[x_prime][y_prime][z].pathCenters[i].pathNum;
-                const short path_shape_type = cellInfo[x_prime][y_prime][z].pathCenters[i].shapeType;
+                const short path_number     = cellPathCenters(&(cellInfo[x_prime][y_prime][z]))[i].pathNum;
+                const short path_shape_type = cellPathCenters(&(cellInfo[x_prime][y_prime][z]))[i].shapeType;
 
                 // Get the design-rule subset number for this net at the source cell (x,y,z) and target cell (x',y',z):
                 const short DR_subset_at_source = user_inputs->designRuleSubsetMap[path_number][DR_num_at_source];
@@ -4181,8 +6040,7 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                         }
                         #endif
 
-                        congestion_nets[m_subset_shapeType_index][subset_shapeType_index_at_source][ congestion_count[m_subset_shapeType_index][subset_shapeType_index_at_source] ] = path_number;
-                        congestion_count[m_subset_shapeType_index][subset_shapeType_index_at_source]++;  // Increment number of nets in array
+                        addCongestionNet(scratch, m_subset_shapeType_index * maxSubsetShapeTypes + subset_shapeType_index_at_source, path_number);
                       }
                     }  // End of if-block for distance^2 < cong_radius^2
                     else  {
@@ -4268,10 +6126,8 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                                      user_inputs->DRC_radius_squared[DR_num_at_source][m_subset_shapeType_index][DR_num_at_target][subset_shapeType_index_at_target]);
                             }
                             #endif
-                            interacting_nets[m_subset_shapeType_index][n_subset_shapeType_index][ interaction_count[m_subset_shapeType_index][n_subset_shapeType_index] ].pathNum   = path_number;
-                            interacting_nets[m_subset_shapeType_index][n_subset_shapeType_index][ interaction_count[m_subset_shapeType_index][n_subset_shapeType_index] ].DR_num    = DR_num_at_target;
-                            interacting_nets[m_subset_shapeType_index][n_subset_shapeType_index][ interaction_count[m_subset_shapeType_index][n_subset_shapeType_index] ].shapeType = path_shape_type;
-                            interaction_count[m_subset_shapeType_index][n_subset_shapeType_index]++;  // Increment number of nets in array
+                            addInteractingNet(scratch, m_subset_shapeType_index * maxSubsetShapeTypes + n_subset_shapeType_index,
+                                              path_number, DR_num_at_target, path_shape_type);
                           }  // End of if-block for (! already_in_array)
                         }  // End of if-block for (distance^2 < DRC_radius^2) or (distance^2 == 0)
                         #ifdef DEBUG_routability
@@ -4294,7 +6150,7 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                   }  // End of for-loop for index 'm_shape_type'
                 }  // End of for-loop for index 'm_DR_subset'
               }  // End of for-loop for index i (0 to numTraversingPaths)
-            }  // End of for-loop for index y_prime
+            }  // End of for-loop for index 'element' (y_prime)
           }  // End of for-loop for index x_prime
 
           #ifdef DEBUG_routability
@@ -4304,7 +6160,7 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           }
           #endif
 
-          // Set flags in the cellInfo matrix that determine how the PNG map
+          // Record the flags in the cellInfo matrix that determine how the PNG map
           // will appear for this (x,y,z) location. Later on, some of these values
           // may be changed if we determine there are DRC violations.
           if (! cellInfo[x][y][z].swap_zone)  {  // Disregard cell if it's in a pin-swappable zone
@@ -4319,35 +6175,35 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                   || (overlapping_nets[i].shapeType == VIA_UP)
                   || (overlapping_nets[i].shapeType == VIA_DOWN))  {
 
-                // Set the appropriate cellInfo bit for routing layers, depending on whether
+                // Record the appropriate cellInfo bit for routing layers, depending on whether
                 // the net is a pseudo-net or a non-pseudo-net:
                 if (user_inputs->isPseudoNet[overlapping_nets[i].pathNum])  {
-                  cellInfo[x][y][z].pseudo_routing_layer_metal_fill = TRUE;
+                  records->fillFlags |= DRC_RECORD_PSEUDO_METAL_FILL;
                 }
                 else  {
-                  cellInfo[x][y][z].routing_layer_metal_fill = TRUE;
+                  records->fillFlags |= DRC_RECORD_METAL_FILL;
                 }
               }  // End of if-block for shapeType == TRACE
 
-              // Set the appropriate cellInfo bit for up-vias, depending on
+              // Record the appropriate cellInfo bit for up-vias, depending on
               // whether the net is a pseudo-net or a non-pseudo-net:
               if (overlapping_nets[i].shapeType == VIA_UP)  {
                 if (user_inputs->isPseudoNet[overlapping_nets[i].pathNum])  {
-                  cellInfo[x][y][z].pseudo_via_above_metal_fill = TRUE;
+                  records->fillFlags |= DRC_RECORD_PSEUDO_VIA_ABOVE_FILL;
                 }
                 else  {
-                  cellInfo[x][y][z].via_above_metal_fill = TRUE;
+                  records->fillFlags |= DRC_RECORD_VIA_ABOVE_FILL;
                 }
               }  // End of if-block for shapeType == VIA_UP
 
-              // Set the appropriate cellInfo bit for down-vias, depending on
+              // Record the appropriate cellInfo bit for down-vias, depending on
               // whether the net is a pseudo-net or a non-pseudo-net:
               if (overlapping_nets[i].shapeType == VIA_DOWN)  {
                 if (user_inputs->isPseudoNet[overlapping_nets[i].pathNum])  {
-                  cellInfo[x][y][z].pseudo_via_below_metal_fill = TRUE;
+                  records->fillFlags |= DRC_RECORD_PSEUDO_VIA_BELOW_FILL;
                 }
                 else  {
-                    cellInfo[x][y][z].via_below_metal_fill = TRUE;
+                    records->fillFlags |= DRC_RECORD_VIA_BELOW_FILL;
                 }
               }  // End of if-block for shapeType == VIA_UP
 
@@ -4480,21 +6336,17 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                   const short interacting_DR_num              = interacting_nets[subset_shapeType_index][target_subset_shapetype][path_index].DR_num;
                   const short interacting_shape_type          = interacting_nets[subset_shapeType_index][target_subset_shapetype][path_index].shapeType;
                   const short interacting_DR_subset_at_source = user_inputs->designRuleSubsetMap[interacting_path_num][DR_num_at_source];
-                  const short interacting_DR_subset_at_target = user_inputs->designRuleSubsetMap[interacting_path_num][interacting_DR_num];
 
                   // Calculate the matrix index associated with the interacting design-rule subset and shape-type.
                   // This index is simply 3 * DR_subset  +  shape_type:
                   const short interacting_subset_shapeType = interacting_DR_subset_at_source * NUM_SHAPE_TYPES   +   interacting_shape_type;
 
-                  // Calculate the subset/shapeType index at the target location, which is used for getting the correct DRC_radius:
-                  const short interacting_subset_shapeType_at_target = interacting_DR_subset_at_target * NUM_SHAPE_TYPES + interacting_shape_type;
-
                   #ifdef DEBUG_routability
                   if (FOUND_XYZ)  {
-                    printf("          DEBUG: (thread %2d) Interacting path-index #%d has path number %d, design-rule subset %d at source, DR subset %d at target, shape type %d,\n",
-                           omp_get_thread_num(), path_index, interacting_path_num, interacting_DR_subset_at_source, interacting_DR_subset_at_target, interacting_shape_type);
-                    printf("          DEBUG: (thread %2d)  interacting_subset_shapeType = %d, interacting_subset_shapeType_at_target = %d.\n", omp_get_thread_num(),
-                           interacting_subset_shapeType, interacting_subset_shapeType_at_target);
+                    printf("          DEBUG: (thread %2d) Interacting path-index #%d has path number %d, design-rule subset %d at source, DR #%d at target, shape type %d,\n",
+                           omp_get_thread_num(), path_index, interacting_path_num, interacting_DR_subset_at_source, interacting_DR_num, interacting_shape_type);
+                    printf("          DEBUG: (thread %2d)  interacting_subset_shapeType = %d.\n", omp_get_thread_num(),
+                           interacting_subset_shapeType);
                   }
                   #endif
 
@@ -4545,170 +6397,8 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                       // Record the fact that we detected a DRC violation between the specified paths and shape-types:
                       record_DRC_by_paths(total_nets, current_cell_DRCs, path_number, shape_type, interacting_path_num, interacting_shape_type);
 
-                      // Determine whether the current DRC is a 'pseudo-DRC'. A pseudo-DRC is one in which
-                      // one or both of the interacting nets is a pseudo-net.
-                      int isPseudoDRC = (user_inputs->isPseudoNet[path_number] || user_inputs->isPseudoNet[interacting_path_num]);
-
-                      // Increment the DRC counts for the current thread:
-                      if (! isPseudoDRC)  {
-                        non_pseudo_DRC_count_per_thread[current_thread]++;
-                      }
-
-                      #ifdef DEBUG_routability
-                      if (FOUND_XYZ)  {
-                        printf("DEBUG: (thread %2d) Incremented non_pseudo_DRC_count_per_thread[%d] to %d. num_printed_DRCs_per_thread[%d] = %d.\n",
-                               omp_get_thread_num(), current_thread, non_pseudo_DRC_count_per_thread[current_thread], current_thread,
-                               num_printed_DRCs_per_thread[current_thread]);
-                      }
-                      #endif
-
-                      // Write non-pseudo DRC details to STDOUT if we have not printed more than maxPrintedDRCs_per_thread:
-                      if (num_printed_DRCs_per_thread[current_thread] < maxPrintedDRCs_per_thread)  {
-
-                        // Print out details of non-pseudo DRC violation:
-                        if (! isPseudoDRC)  {
-
-                          if (DEBUG_ON || ! beQuiet)  {
-                            printf("INFO: (thread %2d) Non-pseudo-DRC violation #%'d: Location (%d,%d,%d) within path number %d (shape type %d) is\n",
-                                   current_thread, non_pseudo_DRC_count_per_thread[current_thread], x, y, z, path_number, shape_type);
-                            printf("      (thread %2d) within %.2f cells (%.2f microns) of the center of path number %d (with shape-type %d).\n", current_thread,
-                                   user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target],
-                                   user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target] * user_inputs->cell_size_um,
-                                   interacting_path_num, interacting_shape_type);
-                          }
-
-                          num_printed_DRCs_per_thread[current_thread]++;
-
-                          #ifdef DEBUG_routability
-                          if (FOUND_XYZ)  {
-                            printf("DEBUG: (thread %2d)                           source_DR_num = %d\n", omp_get_thread_num(), DR_num_at_source);
-                            printf("DEBUG: (thread %2d)                             path_number = %d\n", omp_get_thread_num(), path_number);
-                            printf("DEBUG: (thread %2d)                               DR_subset = %d\n", omp_get_thread_num(), DR_subset);
-                            printf("DEBUG: (thread %2d)                              shape_type = %d\n", omp_get_thread_num(), shape_type);
-                            printf("DEBUG: (thread %2d)                  subset_shapeType_index = %d\n", omp_get_thread_num(), subset_shapeType_index);
-                            printf("DEBUG: (thread %2d)                      interacting_DR_num = %d\n", omp_get_thread_num(), interacting_DR_num);
-                            printf("DEBUG: (thread %2d)                    interacting_path_num = %d\n", omp_get_thread_num(), interacting_path_num);
-                            printf("DEBUG: (thread %2d)         interacting_DR_subset_at_source = %d\n", omp_get_thread_num(), interacting_DR_subset_at_source);
-                            printf("DEBUG: (thread %2d)         interacting_DR_subset_at_target = %d\n", omp_get_thread_num(), interacting_DR_subset_at_target);
-                            printf("DEBUG: (thread %2d)                  interacting_shape_type = %d\n", omp_get_thread_num(), interacting_shape_type);
-                            printf("DEBUG: (thread %2d)            interacting_subset_shapeType = %d\n", omp_get_thread_num(), interacting_subset_shapeType);
-                            printf("DEBUG: (thread %2d)  interacting_subset_shapeType_at_target = %d\n", omp_get_thread_num(), interacting_subset_shapeType_at_target);
-                            printf("DEBUG: (thread %2d)              DRC_radius[%d][%d][%d][%d] = %.3f cells\n", omp_get_thread_num(), DR_num_at_source,
-                                    subset_shapeType_index, interacting_DR_num, interacting_subset_shapeType_at_target,
-                                    user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target]);
-                            printf("DEBUG: (thread %2d)         num_printed_DRCs_per_thread[%d] = %d after incrementing.\n", omp_get_thread_num(), current_thread,
-                                    num_printed_DRCs_per_thread[current_thread]);
-                          }
-                          #endif
-
-                        }  // End of if-block for (! isPseudoDRC)
-                      }  // End of if-block for (num_printed_DRCs_per_thread < maxPrintedDRCs_per_thread)
-
-
-                      //
-                      // If the DRC is not a pseudo-DRC, then update the cellInfo matrix with DRC information for the current violation:
-                      //
-                      // Note: Comment out the following if-statement if you want to view the pseudo-DRCs in the PNG maps.
-                      if (! isPseudoDRC)  {
-                        cellInfo[x][y][z].DRC_flag          = TRUE;
-                        if (shape_type == VIA_UP) {
-                          cellInfo[x][y][z].via_above_DRC_flag   = TRUE;
-                        }
-                      }  // End of if-block for (! isPseudoDRC)
-
-                      //
-                      // Add a small amount of congestion to the cell with a non-pseudo-DRC. This causes such cells to
-                      // have a slightly higher cost to traverse. So if the autorouter later finds two paths
-                      // that otherwise could have equal costs, it will choose the one with no (or fewer) DRC cells:
-                      //
-                      #ifdef DEBUG_routability
-                      if (FOUND_XYZ)  {
-                        printf("DEBUG: (thread %2d) Adding %d congestion at (%d,%d,%d) for path/DR_subset/shape-type %d/%d/%d and %d/%d/%d due to DRC violations.\n",
-                               omp_get_thread_num(), DRC_congestion, x, y, z, path_number, DR_subset, shape_type, interacting_path_num, interacting_DR_subset_at_source,
-                               interacting_shape_type);
-                      }
-                      #endif
-                      if (! isPseudoDRC)  {
-                        addCongestion(&(cellInfo[x][y][z]), path_number,          DR_subset,                       shape_type,             DRC_congestion);
-                        addCongestion(&(cellInfo[x][y][z]), interacting_path_num, interacting_DR_subset_at_source, interacting_shape_type, DRC_congestion);
-                      }
-
-                      #ifdef DEBUG_routability
-                      if (FOUND_XYZ)  {
-                        printf("DEBUG: (thread %2d) Done adding congestion due to DRC violations.\n", omp_get_thread_num());
-                      }
-                      #endif
-
-
-                      //
-                      // Capture the DRC details in appropriate arrays. For the 'crossing_matrix' array
-                      // that's shared among all parallel threads, use the 'atomic update' OMP pragma
-                      // to ensure that only 1 thread updates the variable at a time.
-                      //
-                      // printf("DEBUG: About to increment crossing_matrix values for element [%d,%d]...\n",
-                      //         path_number, interacting_path_num);
-
-                      // printf("DEBUG: About to increment crossing_matrix[%d][%d] from %d...\n", path_number,
-                      //         interacting_path_num, routability->crossing_matrix[path_number][interacting_path_num]);
-                      #pragma omp atomic update
-                      routability->crossing_matrix[path_number][interacting_path_num]++;
-                      // printf("done.\n");
-
-                      // printf("DEBUG: About to increment crossing_matrix[%d][%d] from %d...\n", interacting_path_num,
-                      //         path_number, routability->crossing_matrix[interacting_path_num][path_number]);
-                      #pragma omp atomic update
-                      routability->crossing_matrix[interacting_path_num][path_number]++;
-
-                      // printf("DEBUG:    Done incrementing crossing_matrix elements.\n");
-
-
-                      // If DRC is not a pseudo-DRC, then categorize the DRC by (1) via-to-via spacing violation, or
-                      // (2) trace-to-trace spacing violation, or (3) trace-to-via spacing violation. These
-                      // categories can later be used to modify the sensitivity during path-finding of different
-                      // categories of congestion.
-                      if ((shape_type != TRACE) && (interacting_shape_type != TRACE))  {
-                        // We got here, so the two shape-types are vias. Increment the DRC count
-                        // for via-to-via violations:
-                        non_pseudo_via2via_DRC_count_per_thread[current_thread]++;
-                      }
-                      else if ((shape_type == TRACE) && (interacting_shape_type == TRACE))  {
-                        // We got here, so the two shape-types are traces. Increment the DRC count
-                        // for trace-to-trace violations:
-                        non_pseudo_trace2trace_DRC_count_per_thread[current_thread]++;
-                      }
-                      else  {
-                        // We got here, so one of the two shape-types is a trace, and the other is
-                        // a via. Increment the DRC count for trace-to-via violations:
-                        non_pseudo_trace2trace_DRC_count_per_thread[current_thread]++;
-                      }
-
-
-                      // If DRC is not a pseudo-DRC, then add its details to the 'DRC_details_per_thread' array:
-                      // printf("DEBUG: About to check if non_pseudo_DRC_count_per_thread[%d] (%d) is <= maxRecordedDRCs (%d)...\n",
-                      //         current_thread, non_pseudo_DRC_count_per_thread[current_thread], maxRecordedDRCs);
-                      if (! isPseudoDRC)  {
-                        if (non_pseudo_DRC_count_per_thread[current_thread] <= maxRecordedDRCs)  {
-                          // printf("DEBUG: About to update DRC_details_per_thread[%d][%d]... ", current_thread,
-                          //         non_pseudo_DRC_count_per_thread[current_thread]-1);
-
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].x                  = x;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].y                  = y;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].z                  = z;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].pathNum            = path_number;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].shapeType          = shape_type;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].offendingPathNum   = interacting_path_num;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].offendingShapeType = interacting_shape_type;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].minimumAllowedDistance =
-                                       user_inputs->DRC_radius[DR_num_at_source][DR_subset*NUM_SHAPE_TYPES + shape_type][interacting_DR_num][interacting_DR_subset_at_source*NUM_SHAPE_TYPES + interacting_shape_type]
-                                         * user_inputs->cell_size_um;
-                          DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].minimumAllowedSpacing =
-                                    user_inputs->designRules[DR_num_at_source][DR_subset].space_um[shape_type][interacting_shape_type];
-
-                          // printf("DEBUG:    done.\n");
-                        }  // End of if-block for numDRCs <= maxRecordedDRCs
-                        // printf("DEBUG: Done checking if non_pseudo_DRC_count_per_thread[%d] (%d) is <= maxRecordedDRCs (%d)...\n",
-                        //         current_thread, non_pseudo_DRC_count_per_thread[current_thread], maxRecordedDRCs);
-                      }  // End of if-block for (! isPseudoDRC)
+                      // Record the violation, which is applied to the cell further below:
+                      recordDRCViolation(records, path_number, shape_type, interacting_path_num, interacting_shape_type, interacting_DR_num);
                     }  // End of if-block for (! already_in_array)
                     // printf("DEBUG: (thread %2d) Exited if-block for (! already_in_array).\n", current_thread);
 
@@ -4726,12 +6416,13 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
           }  // End of if-block for (! swap_zone)
 
           //
-          // If 'addCongestionFlag' flag is set, then add congestion to this cell if it's
-          // not in a pin-swappable region:
+          // Record the congestion to add to this cell if it's not in a pin-swappable
+          // region. The congestion is added further below if the 'addCongestionFlag'
+          // flag is set:
           //
-          if ((addCongestionFlag) && (! cellInfo[x][y][z].swap_zone))  {
+          if (! cellInfo[x][y][z].swap_zone)  {
             //
-            // Using the information in the m-by-m "congestion_nets" matrix, add congestion
+            // Using the information in the m-by-m "congestion_nets" matrix, record congestion
             // to cell at location (x,y,z). (m = NUM_SHAPE_TYPES x num_source_DR_subsets.) Congestion
             // of design-rule subset/shape-type 'j' should be added to (x,y,z) if the
             // path-center of any net with design-rule subset/shape-type 'i' is within
@@ -4799,31 +6490,8 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                       }
                       #endif
 
-                      // Add congestion if:
-                      //  (1a) 'interacting_path_num' is not a pseudo-net, and
-                      //  (1b) 'addCongOnlyForDiffPair' is -1 (ADD_CONGESTION_FOR_ALL_NETS),
-                      // OR:
-                      //  (2a) 'addCongOnlyForDiffPair' does not equal -1 (ADD_CONGESTION_FOR_ALL_NETS), and
-                      //  (2b) 'interacting_path_num' is a diff-pair path associated with pseudo-path number 'addCongOnlyForDiffPair'
-                      if (   (   (! user_inputs->isPseudoNet[interacting_path_num])                                       // Criteria (1a) above
-                              && (addCongOnlyForDiffPair == ADD_CONGESTION_FOR_ALL_NETS))                                 // Criteria (1b) above
-                          || (   (addCongOnlyForDiffPair != ADD_CONGESTION_FOR_ALL_NETS)                                  // Criteria (2a) above
-                              && (user_inputs->diffPairToPseudoNetMap[interacting_path_num] == addCongOnlyForDiffPair)))  // Criteria (2b) above
-                      {
-                        //
-                        // Add congestion to cell (x,y,z):
-                        //
-                        addCongestion(&(cellInfo[x][y][z]), interacting_path_num, congestion_DR_subset, congestion_shape_type,
-                                                routability->one_path_traversal[interacting_path_num]);
-
-                        #ifdef DEBUG_routability
-                        if (FOUND_XYZ)  {
-                          printf("  DEBUG: (thread %2d)  ** %d congestion added to (%d, %d, %d) with path %d, subset %d, and shape_type %d\n",
-                                 omp_get_thread_num(), routability->one_path_traversal[interacting_path_num], x, y, z, interacting_path_num,
-                                 congestion_DR_subset, congestion_shape_type);
-                        }
-                        #endif
-                      }  // End of if-block for non-pseudo-net
+                      // Record the congestion, which is added to cell (x,y,z) further below:
+                      recordCongestionDeposit(records, interacting_path_num, congestion_DR_subset, congestion_shape_type);
 
                     }  // End of for-loop for index 'path_index'
                   }  // End of for-loop for index 'target_shape_type'
@@ -4833,10 +6501,291 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
 
             #ifdef DEBUG_routability
             if (FOUND_XYZ)  {
-              printf("DEBUG: (thread %2d) Done adding congestion to (%d,%d,%d) based on 'congestion_nets' matrix.\n-------------\n",
+              printf("DEBUG: (thread %2d) Done recording congestion for (%d,%d,%d) based on 'congestion_nets' matrix.\n-------------\n",
                      omp_get_thread_num(), x, y, z);
             }
             #endif
+          }  // End of if-block for (! swap_zone)
+
+          // Save the results of this cell, so they can be re-applied in the next call
+          // if no nearby path changes:
+          if (incrementalDRC != NULL)  {
+            saveCellDRCRecords(incrementalDRC, cellIndex, records);
+          }
+        }  // End of if-block for (near_a_net == TRUE) and (recheckCell == TRUE)
+
+        //
+        // Apply the results of cell (x,y,z), which were either recorded above or
+        // recorded in a previous call and re-used because no nearby path changed:
+        //
+        if (cellInfo[x][y][z].near_a_net)  {
+
+          // Get the thread number used for this (x,y,z) location:
+          const short current_thread = omp_get_thread_num();
+
+          // For the current (x,y,z) coordinate, get the number of the design-rule set:
+          const short DR_num_at_source = cellInfo[x][y][z].designRuleSet;
+
+          // Get the metal-fill flags, the number of violations, the number of congestion
+          // deposits, and the address of the first violation:
+          unsigned int fillFlags;
+          int numViolations, numDeposits;
+          const unsigned int *violations;
+          if (recheckCell)  {
+            fillFlags     = DRC_records_per_thread[current_thread].fillFlags;
+            numViolations = DRC_records_per_thread[current_thread].numViolations;
+            numDeposits   = DRC_records_per_thread[current_thread].numDeposits;
+            violations    = DRC_records_per_thread[current_thread].units + 1;
+          }
+          else if (incrementalDRC->records[cellIndex] != 0)  {
+            const unsigned int *cellRecords = cellArrayAddress(incrementalDRC->records[cellIndex]);
+            fillFlags     = cellRecords[0] & 0x3F;
+            numViolations = (cellRecords[0] >> 6) & maxDRCRecordCount;
+            numDeposits   = cellRecords[0] >> 19;
+            violations    = cellRecords + 1;
+          }
+          else  {
+            fillFlags     = 0;
+            numViolations = 0;
+            numDeposits   = 0;
+            violations    = NULL;
+          }
+
+          // Set flags in the cellInfo matrix that determine how the PNG map
+          // will appear for this (x,y,z) location:
+          if (fillFlags)  {
+            if (fillFlags & DRC_RECORD_METAL_FILL)              cellInfo[x][y][z].routing_layer_metal_fill        = TRUE;
+            if (fillFlags & DRC_RECORD_PSEUDO_METAL_FILL)       cellInfo[x][y][z].pseudo_routing_layer_metal_fill = TRUE;
+            if (fillFlags & DRC_RECORD_VIA_ABOVE_FILL)          cellInfo[x][y][z].via_above_metal_fill            = TRUE;
+            if (fillFlags & DRC_RECORD_PSEUDO_VIA_ABOVE_FILL)   cellInfo[x][y][z].pseudo_via_above_metal_fill     = TRUE;
+            if (fillFlags & DRC_RECORD_VIA_BELOW_FILL)          cellInfo[x][y][z].via_below_metal_fill            = TRUE;
+            if (fillFlags & DRC_RECORD_PSEUDO_VIA_BELOW_FILL)   cellInfo[x][y][z].pseudo_via_below_metal_fill     = TRUE;
+          }
+
+          //
+          // Count, print, and flag each DRC violation at (x,y,z), and add congestion
+          // to the cell because of the violation:
+          //
+          for (int violation = 0; violation < numViolations; violation++)  {
+            const short path_number            = violations[2*violation] & 0xFFFF;
+            const short interacting_path_num   = violations[2*violation] >> 16;
+            const short shape_type             = violations[2*violation + 1] & 0xFF;
+            const short interacting_shape_type = (violations[2*violation + 1] >> 8) & 0xFF;
+            const short interacting_DR_num     = violations[2*violation + 1] >> 16;
+
+            // Get the design-rule subsets of the two paths at the source cell (x,y,z), and of the
+            // interacting path at its path-center, and the corresponding subset/shapeType indices:
+            const short DR_subset = user_inputs->designRuleSubsetMap[path_number][DR_num_at_source];
+            const short subset_shapeType_index = DR_subset * NUM_SHAPE_TYPES   +   shape_type;
+            const short interacting_DR_subset_at_source = user_inputs->designRuleSubsetMap[interacting_path_num][DR_num_at_source];
+            const short interacting_DR_subset_at_target = user_inputs->designRuleSubsetMap[interacting_path_num][interacting_DR_num];
+            const short interacting_subset_shapeType_at_target = interacting_DR_subset_at_target * NUM_SHAPE_TYPES + interacting_shape_type;
+            #ifdef DEBUG_routability
+            const short interacting_subset_shapeType = interacting_DR_subset_at_source * NUM_SHAPE_TYPES   +   interacting_shape_type;
+            #endif
+
+            // Determine whether the current DRC is a 'pseudo-DRC'. A pseudo-DRC is one in which
+            // one or both of the interacting nets is a pseudo-net.
+            int isPseudoDRC = (user_inputs->isPseudoNet[path_number] || user_inputs->isPseudoNet[interacting_path_num]);
+
+            // Increment the DRC counts for the current thread:
+            if (! isPseudoDRC)  {
+              non_pseudo_DRC_count_per_thread[current_thread]++;
+            }
+
+            #ifdef DEBUG_routability
+            if (FOUND_XYZ)  {
+              printf("DEBUG: (thread %2d) Incremented non_pseudo_DRC_count_per_thread[%d] to %d. num_printed_DRCs_per_thread[%d] = %d.\n",
+                     omp_get_thread_num(), current_thread, non_pseudo_DRC_count_per_thread[current_thread], current_thread,
+                     num_printed_DRCs_per_thread[current_thread]);
+            }
+            #endif
+
+            // Write non-pseudo DRC details to STDOUT if we have not printed more than maxPrintedDRCs_per_thread:
+            if (num_printed_DRCs_per_thread[current_thread] < maxPrintedDRCs_per_thread)  {
+
+              // Print out details of non-pseudo DRC violation:
+              if (! isPseudoDRC)  {
+
+                if (DEBUG_ON || ! beQuiet)  {
+                  printf("INFO: (thread %2d) Non-pseudo-DRC violation #%'d: Location (%d,%d,%d) within path number %d (shape type %d) is\n",
+                         current_thread, non_pseudo_DRC_count_per_thread[current_thread], x, y, z, path_number, shape_type);
+                  printf("      (thread %2d) within %.2f cells (%.2f microns) of the center of path number %d (with shape-type %d).\n", current_thread,
+                         user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target],
+                         user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target] * user_inputs->cell_size_um,
+                         interacting_path_num, interacting_shape_type);
+                }
+
+                num_printed_DRCs_per_thread[current_thread]++;
+
+                #ifdef DEBUG_routability
+                if (FOUND_XYZ)  {
+                  printf("DEBUG: (thread %2d)                           source_DR_num = %d\n", omp_get_thread_num(), DR_num_at_source);
+                  printf("DEBUG: (thread %2d)                             path_number = %d\n", omp_get_thread_num(), path_number);
+                  printf("DEBUG: (thread %2d)                               DR_subset = %d\n", omp_get_thread_num(), DR_subset);
+                  printf("DEBUG: (thread %2d)                              shape_type = %d\n", omp_get_thread_num(), shape_type);
+                  printf("DEBUG: (thread %2d)                  subset_shapeType_index = %d\n", omp_get_thread_num(), subset_shapeType_index);
+                  printf("DEBUG: (thread %2d)                      interacting_DR_num = %d\n", omp_get_thread_num(), interacting_DR_num);
+                  printf("DEBUG: (thread %2d)                    interacting_path_num = %d\n", omp_get_thread_num(), interacting_path_num);
+                  printf("DEBUG: (thread %2d)         interacting_DR_subset_at_source = %d\n", omp_get_thread_num(), interacting_DR_subset_at_source);
+                  printf("DEBUG: (thread %2d)         interacting_DR_subset_at_target = %d\n", omp_get_thread_num(), interacting_DR_subset_at_target);
+                  printf("DEBUG: (thread %2d)                  interacting_shape_type = %d\n", omp_get_thread_num(), interacting_shape_type);
+                  printf("DEBUG: (thread %2d)            interacting_subset_shapeType = %d\n", omp_get_thread_num(), interacting_subset_shapeType);
+                  printf("DEBUG: (thread %2d)  interacting_subset_shapeType_at_target = %d\n", omp_get_thread_num(), interacting_subset_shapeType_at_target);
+                  printf("DEBUG: (thread %2d)              DRC_radius[%d][%d][%d][%d] = %.3f cells\n", omp_get_thread_num(), DR_num_at_source,
+                          subset_shapeType_index, interacting_DR_num, interacting_subset_shapeType_at_target,
+                          user_inputs->DRC_radius[DR_num_at_source][subset_shapeType_index][interacting_DR_num][interacting_subset_shapeType_at_target]);
+                  printf("DEBUG: (thread %2d)         num_printed_DRCs_per_thread[%d] = %d after incrementing.\n", omp_get_thread_num(), current_thread,
+                          num_printed_DRCs_per_thread[current_thread]);
+                }
+                #endif
+
+              }  // End of if-block for (! isPseudoDRC)
+            }  // End of if-block for (num_printed_DRCs_per_thread < maxPrintedDRCs_per_thread)
+
+
+            //
+            // If the DRC is not a pseudo-DRC, then update the cellInfo matrix with DRC information for the current violation:
+            //
+            // Note: Comment out the following if-statement if you want to view the pseudo-DRCs in the PNG maps.
+            if (! isPseudoDRC)  {
+              cellInfo[x][y][z].DRC_flag          = TRUE;
+              if (shape_type == VIA_UP) {
+                cellInfo[x][y][z].via_above_DRC_flag   = TRUE;
+              }
+            }  // End of if-block for (! isPseudoDRC)
+
+            //
+            // Add a small amount of congestion to the cell with a non-pseudo-DRC. This causes such cells to
+            // have a slightly higher cost to traverse. So if the autorouter later finds two paths
+            // that otherwise could have equal costs, it will choose the one with no (or fewer) DRC cells:
+            //
+            #ifdef DEBUG_routability
+            if (FOUND_XYZ)  {
+              printf("DEBUG: (thread %2d) Adding %d congestion at (%d,%d,%d) for path/DR_subset/shape-type %d/%d/%d and %d/%d/%d due to DRC violations.\n",
+                     omp_get_thread_num(), DRC_congestion, x, y, z, path_number, DR_subset, shape_type, interacting_path_num, interacting_DR_subset_at_source,
+                     interacting_shape_type);
+            }
+            #endif
+            if (! isPseudoDRC)  {
+              addCongestion(&(cellInfo[x][y][z]), path_number,          DR_subset,                       shape_type,             DRC_congestion);
+              addCongestion(&(cellInfo[x][y][z]), interacting_path_num, interacting_DR_subset_at_source, interacting_shape_type, DRC_congestion);
+            }
+
+            #ifdef DEBUG_routability
+            if (FOUND_XYZ)  {
+              printf("DEBUG: (thread %2d) Done adding congestion due to DRC violations.\n", omp_get_thread_num());
+            }
+            #endif
+
+
+            //
+            // Capture the DRC details in appropriate arrays. For the 'crossing_matrix' array
+            // that's shared among all parallel threads, use the 'atomic update' OMP pragma
+            // to ensure that only 1 thread updates the variable at a time.
+            //
+            // printf("DEBUG: About to increment crossing_matrix values for element [%d,%d]...\n",
+            //         path_number, interacting_path_num);
+
+            // printf("DEBUG: About to increment crossing_matrix[%d][%d] from %d...\n", path_number,
+            //         interacting_path_num, routability->crossing_matrix[path_number][interacting_path_num]);
+            #pragma omp atomic update
+            routability->crossing_matrix[path_number][interacting_path_num]++;
+            // printf("done.\n");
+
+            // printf("DEBUG: About to increment crossing_matrix[%d][%d] from %d...\n", interacting_path_num,
+            //         path_number, routability->crossing_matrix[interacting_path_num][path_number]);
+            #pragma omp atomic update
+            routability->crossing_matrix[interacting_path_num][path_number]++;
+
+            // printf("DEBUG:    Done incrementing crossing_matrix elements.\n");
+
+
+            // If DRC is not a pseudo-DRC, then categorize the DRC by (1) via-to-via spacing violation, or
+            // (2) trace-to-trace spacing violation, or (3) trace-to-via spacing violation. These
+            // categories can later be used to modify the sensitivity during path-finding of different
+            // categories of congestion.
+            if ((shape_type != TRACE) && (interacting_shape_type != TRACE))  {
+              // We got here, so the two shape-types are vias. Increment the DRC count
+              // for via-to-via violations:
+              non_pseudo_via2via_DRC_count_per_thread[current_thread]++;
+            }
+            else if ((shape_type == TRACE) && (interacting_shape_type == TRACE))  {
+              // We got here, so the two shape-types are traces. Increment the DRC count
+              // for trace-to-trace violations:
+              non_pseudo_trace2trace_DRC_count_per_thread[current_thread]++;
+            }
+            else  {
+              // We got here, so one of the two shape-types is a trace, and the other is
+              // a via. Increment the DRC count for trace-to-via violations:
+              non_pseudo_trace2trace_DRC_count_per_thread[current_thread]++;
+            }
+
+
+            // If DRC is not a pseudo-DRC, then add its details to the 'DRC_details_per_thread' array:
+            // printf("DEBUG: About to check if non_pseudo_DRC_count_per_thread[%d] (%d) is <= maxRecordedDRCs (%d)...\n",
+            //         current_thread, non_pseudo_DRC_count_per_thread[current_thread], maxRecordedDRCs);
+            if (! isPseudoDRC)  {
+              if (non_pseudo_DRC_count_per_thread[current_thread] <= maxRecordedDRCs)  {
+                // printf("DEBUG: About to update DRC_details_per_thread[%d][%d]... ", current_thread,
+                //         non_pseudo_DRC_count_per_thread[current_thread]-1);
+
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].x                  = x;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].y                  = y;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].z                  = z;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].pathNum            = path_number;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].shapeType          = shape_type;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].offendingPathNum   = interacting_path_num;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].offendingShapeType = interacting_shape_type;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].minimumAllowedDistance =
+                             user_inputs->DRC_radius[DR_num_at_source][DR_subset*NUM_SHAPE_TYPES + shape_type][interacting_DR_num][interacting_DR_subset_at_source*NUM_SHAPE_TYPES + interacting_shape_type]
+                               * user_inputs->cell_size_um;
+                DRC_details_per_thread[current_thread][non_pseudo_DRC_count_per_thread[current_thread] - 1].minimumAllowedSpacing =
+                          user_inputs->designRules[DR_num_at_source][DR_subset].space_um[shape_type][interacting_shape_type];
+
+                // printf("DEBUG:    done.\n");
+              }  // End of if-block for numDRCs <= maxRecordedDRCs
+              // printf("DEBUG: Done checking if non_pseudo_DRC_count_per_thread[%d] (%d) is <= maxRecordedDRCs (%d)...\n",
+              //         current_thread, non_pseudo_DRC_count_per_thread[current_thread], maxRecordedDRCs);
+            }  // End of if-block for (! isPseudoDRC)
+          }  // End of for-loop for index 'violation'
+
+          //
+          // If 'addCongestionFlag' flag is set, then add the recorded congestion to this cell:
+          //
+          if ((addCongestionFlag) && (numDeposits > 0))  {
+            const unsigned int *deposits = violations + 2 * numViolations;
+            for (int deposit = 0; deposit < numDeposits; deposit++)  {
+              const short interacting_path_num  = deposits[deposit] & 0xFFFF;
+              const short congestion_DR_subset  = (deposits[deposit] >> 16) & 0xFF;
+              const short congestion_shape_type = deposits[deposit] >> 24;
+
+              // Add congestion if:
+              //  (1a) 'interacting_path_num' is not a pseudo-net, and
+              //  (1b) 'addCongOnlyForDiffPair' is -1 (ADD_CONGESTION_FOR_ALL_NETS),
+              // OR:
+              //  (2a) 'addCongOnlyForDiffPair' does not equal -1 (ADD_CONGESTION_FOR_ALL_NETS), and
+              //  (2b) 'interacting_path_num' is a diff-pair path associated with pseudo-path number 'addCongOnlyForDiffPair'
+              if (   (   (! user_inputs->isPseudoNet[interacting_path_num])                                       // Criteria (1a) above
+                      && (addCongOnlyForDiffPair == ADD_CONGESTION_FOR_ALL_NETS))                                 // Criteria (1b) above
+                  || (   (addCongOnlyForDiffPair != ADD_CONGESTION_FOR_ALL_NETS)                                  // Criteria (2a) above
+                      && (user_inputs->diffPairToPseudoNetMap[interacting_path_num] == addCongOnlyForDiffPair)))  // Criteria (2b) above
+              {
+                //
+                // Add congestion to cell (x,y,z):
+                //
+                addCongestion(&(cellInfo[x][y][z]), interacting_path_num, congestion_DR_subset, congestion_shape_type,
+                                        routability->one_path_traversal[interacting_path_num]);
+
+                #ifdef DEBUG_routability
+                if (FOUND_XYZ)  {
+                  printf("  DEBUG: (thread %2d)  ** %d congestion added to (%d, %d, %d) with path %d, subset %d, and shape_type %d\n",
+                         omp_get_thread_num(), routability->one_path_traversal[interacting_path_num], x, y, z, interacting_path_num,
+                         congestion_DR_subset, congestion_shape_type);
+                }
+                #endif
+              }  // End of if-block for non-pseudo-net
+            }  // End of for-loop for index 'deposit'
           }  // End of if-block for (addCongestionFlag == TRUE)
         }  // End of if-block for (near_a_net == TRUE)
       }  // End of for-loop for x-coordinate
@@ -4883,6 +6832,13 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
 
   }  // End of for-loop for z-coordinate
 
+  freePathCenterIndex(&pathCenterIndex);
+
+  // The recorded results of all cells are now up to date:
+  if (incrementalDRC != NULL)  {
+    incrementalDRC->numChecks++;
+  }
+
   if (DEBUG_ON || ! beQuiet)  {
     tim = time(NULL); now = localtime(&tim);
     printf("INFO: (thread %2d) Done checking for DRC violations by rastering over all (x,y,z) locations at %02d-%02d-%d, %02d:%02d:%02d.\n",
@@ -5394,6 +7350,18 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
   }
   free(DRC_details_per_thread);  DRC_details_per_thread = NULL;
 
+  // Free the records of each thread:
+  for (int i = 0; i < num_threads; i++)  {
+    free(DRC_records_per_thread[i].units);  DRC_records_per_thread[i].units = NULL;
+  }
+  free(DRC_records_per_thread);  DRC_records_per_thread = NULL;
+
+  // Free the working arrays of each thread:
+  for (int i = 0; i < num_threads; i++)  {
+    freeDRCScanScratch(&(DRC_scratch_per_thread[i]));
+  }
+  free(DRC_scratch_per_thread);  DRC_scratch_per_thread = NULL;
+
 
 }  // End of function 'calcRoutabilityMetrics'
 
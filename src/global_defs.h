@@ -110,6 +110,24 @@ enum {
   numIterationsToReEquilibrate  = 20, // Number of iterations to achieve a new equilibrium in routing
                                       // metrics after a change to the routing algorithm.
 
+  maxSearchGeneration = 32767, // Largest search-generation stamped into the 'whichList' array before
+                               // the array is fully cleared, limited by its 16-bit elements
+                               // (2 * 32767 + 1 = 65535).
+
+  maxGlobalRoutingIterations = 50, // Maximum number of negotiated-congestion iterations in the global-
+                                   // routing stage, which ends earlier if no tile-edge is over capacity.
+  globalRoutingCorridorTiles = 1,  // Number of tiles by which each net's global route is widened to form
+                                   // the corridor for findPath().
+
+  maxLandmarksPerLayer = 16,       // Maximum value of 'landmarks_per_layer' in the input file
+  landmarkUnreachable  = 0xFFFF,   // 16-bit landmark distance of a cell that cannot be reached from the landmark
+
+  dirtyTileSize = 16,  // Width and height (in cells) of the tiles in which changes of congestion are tracked
+                       // for the 'reroute_congestion_tolerance' input parameter
+
+  cellInfoTileBits = 3, // Base-2 logarithm of the width and height (in cells) of the tiles of the
+                        // 'cellInfo' matrix with the TILED_LAYOUT (2^3 = 8 cells)
+
   // Define 3 shape-types and their associated indices in various arrays:
   NUM_SHAPE_TYPES = 3, 
   TRACE           = 0,
@@ -201,6 +219,7 @@ enum {
   NxNW = 15,
   Up   = 16,
   Down = 17,
+  NO_PARENT = 31,  // Parent-direction code of the root cell of a search tree, which has no parent
 
   // Constants for coding the locations of terminals in function makePngPathMaps():
   START_TERM  = 1,   // start-terminal of a non-pseudo-net
@@ -233,7 +252,22 @@ enum {
   TR_CONG_SENS_DOWN  = 3,  // Decreased trace congestion sensitivity
   VIA_CONG_SENS_UP   = 4,  // Increased via congestion sensitivity
   VIA_CONG_SENS_DOWN = 5,  // Decreased via congestion sensitivity
-  ADD_PSEUDO_CONG    = 6   // Added TRACE pseudo-congestion near pseudo-vias
+  ADD_PSEUDO_CONG    = 6,  // Added TRACE pseudo-congestion near pseudo-vias
+
+  // Define constants for the memory layout of the 3D path-finding arrays and the 'cellInfo'
+  // matrix, selected with the 'pathFinding_layout' and 'cellInfo_layout' keywords in the
+  // input file:
+  Z_INNERMOST_LAYOUT = 0,  // The layers of each (x,y) location are adjacent in memory (default)
+  LAYER_MAJOR_LAYOUT = 1,  // Each routing layer is a contiguous plane in memory (path-finding arrays only)
+  TILED_LAYOUT       = 2,  // As Z_INNERMOST_LAYOUT, but the (x,y) locations of each square tile of the
+                           // map are adjacent in memory ('cellInfo' matrix only)
+
+  // Define constants for the data structure that holds the Open List in findPath(), selected
+  // with the 'openList_engine' keyword in the input file:
+  BINARY_HEAP_ENGINE = 0,  // Binary heap with decrease-key via the 'sortNumber' array (default)
+  RADIX_HEAP_ENGINE  = 1,  // Monotone radix heap with lazy deletion of outdated entries
+  numRadixHeapBuckets = 65 // Number of buckets in the radix heap: one for keys equal to the most
+                           // recently extracted key, plus one for each bit of a 64-bit key.
 
 };  // End of enumerated constants
 
@@ -248,33 +282,137 @@ typedef struct Coordinate_t  {
   unsigned int flag :  1;  // Bit used as a Boolean flag for various purposes.
 } Coordinate_t;  // End of struct definition 'Coordinate_t'
 
+//
+// Declare data structures for the radix-heap Open List. Each bucket is a growable array
+// of entries. An entry is never removed when a cell's F-cost is reduced; instead, a new
+// entry is added, and the outdated one is discarded when it reaches the top of the heap
+// after the cell has been moved to the Closed List.
+//
+typedef struct RadixHeapEntry_t  {
+  unsigned long Fcost;  // F-cost of the cell when the entry was added
+  Coordinate_t  coord;  // X/Y/Z coordinates of the cell
+} RadixHeapEntry_t;
+
+typedef struct RadixHeapBucket_t  {
+  RadixHeapEntry_t *entry;  // 1D array of entries in this bucket
+  int numEntries;           // Number of entries currently in the bucket
+  int maxEntries;           // Number of entries allocated for the bucket
+} RadixHeapBucket_t;
+
+typedef struct RadixHeap_t  {
+  unsigned long lastKey;  // Most recently extracted F-cost from the heap
+  RadixHeapBucket_t bucket[numRadixHeapBuckets];  // Bucket 0 holds entries whose F-cost equals
+                                                  // 'lastKey', and bucket 'b' holds entries whose
+                                                  // F-cost first differs from it in bit 'b-1'.
+} RadixHeap_t;
 
 //
-// Declare data structure for path-finding arrays:
+// Declare data structure for a rectangle of (x,y) locations, from (minX, minY) to
+// (maxX, maxY), inclusive:
+//
+typedef struct CellBox_t  {
+  int minX;
+  int maxX;
+  int minY;
+  int maxY;
+} CellBox_t;  // End of struct definition 'CellBox_t'
+
+//
+// Declare data structure for path-finding arrays. The arrays that span the 3D map
+// ('whichList', 'parentDirection', 'Gcost', and 'sortNumber') are each allocated as a
+// single, contiguous block of (mapWidth+1) x (mapHeight+1) x (numLayers+1) elements.
+// The element for cell (x,y,z) is located with function pathFindingIndex(), using
+// the strides that match the memory layout selected by 'pathFinding_layout' in the
+// input file. If findPath() can reach only a small window of the map, then the
+// arrays are indexed as if they spanned only this window (see setPathFindingWindow()),
+// so that the search uses a compact block of memory.
 //
 typedef struct PathFinding_t  {
-  unsigned char ***whichList;  // 3D array that specifies which path-finding list a cell is in.
-                               // All elements are initialized to 'notOpenOrClosedList'.
-                               //   whichList[x][y][z] = notOpenOrClosedList
-                               //                         or onOpenList
-                               //                          or onClosedList
+  unsigned short *whichList;  // 3D array that specifies which path-finding list a cell is in.
+                              // Values are stamped with the search-generation that wrote them:
+                              //   whichList[i] = 2 * searchGeneration      (onOpenList)
+                              //               or 2 * searchGeneration + 1  (onClosedList)
+                              // Any other value means that the cell is on neither list in the
+                              // current search, so the array need not be cleared between searches.
+  unsigned short searchGeneration;  // Generation number of the current call to findPath(), from 1
+                                    // to maxSearchGeneration. Incremented by initializePathFindingArrays().
+  unsigned char layout;   // Memory layout of the 3D arrays: Z_INNERMOST_LAYOUT or LAYER_MAJOR_LAYOUT
+  size_t strideX;         // Distance between elements of adjacent cells in the X-direction
+  size_t strideY;         // Distance between elements of adjacent cells in the Y-direction
+  size_t strideZ;         // Distance between elements of adjacent cells in the Z-direction
+  size_t windowOffset;    // Value of (x*strideX + y*strideY + z*strideZ) for the lowest corner of the window
+                          // that the arrays currently span. Zero if the arrays span the whole map.
+  size_t numCells;        // Number of elements in each of the 3D arrays
   Coordinate_t *openListCoords;  // 1D array that stores the X/Y/Z coordinates of an
                                  // item on the Open List.
-  Coordinate_t ***parentCoords;  // 3D array that contains the parent locations for each
-                                 // cell in the 3D matrix.
-                                 //     parentCoords[x][y][z] = coordinates of parent cell
+  unsigned char *parentDirection; // 3D array that contains the transition code (E, N, ..., Up, Down)
+                                 // of the move from each cell's parent to the cell. The parent's
+                                 // location is found with function parentCell() in global_defs.c.
   unsigned long *Fcost;   // 1D array that stores the F-cost of a cell on the Open list.
-  unsigned long ***Gcost; // 3D array that stores the G-cost of each cell in the 3D matrix.
+  unsigned long *Gcost;   // 3D array that stores the G-cost of each cell in the 3D matrix.
   unsigned long *Hcost;   // 1D array that stores the H-cost of a cell on the open list.
-  int *openList;          // 1D array that contains the ID number of open-list items
-  int ***sortNumber;  // 3D array that stores the current sort sequence (from binary heap)
+  int *openList;          // 1D array that contains the ID number of open-list items in the binary
+                          // heap. Not allocated for the radix-heap engine.
+  int *sortNumber;    // 3D array that stores the current sort sequence (from binary heap)
                       // for each (x,y,z) cell on the Open List. This array helps the A*
                       // algorithm quickly find the sort number for an arbitrary cell at
                       // (x,y,z) in the map. This lookup feature can reduce the run-time
-                      // significantly when the Open List is very large.
+                      // significantly when the Open List is very large. Not allocated
+                      // for the radix-heap engine.
+  unsigned char openListEngine;  // BINARY_HEAP_ENGINE or RADIX_HEAP_ENGINE
+  RadixHeap_t radixHeap;         // Open List for the radix-heap engine
+  //
+  // The following members are used only by the bidirectional search, which grows a second
+  // search tree backwards from the end-terminal. They mirror the arrays above, except that
+  // 'parentDirection_reverse' holds the move to the next cell toward the end-terminal. The 3D arrays are
+  // allocated the first time that a bidirectional search is run with this structure:
+  //
+  unsigned short *whichList_reverse;    // 3D array: whichList for the backward search
+  unsigned char  *parentDirection_reverse; // 3D array: transition code of the move to the next cell
+                                          // toward the end-terminal
+  unsigned long  *Gcost_reverse;        // 3D array: G-cost from each cell to the end-terminal
+  RadixHeap_t radixHeap_reverse;        // Open List for the backward search
+  int *spareSearchThreads;  // Counter, shared by all threads, of idle threads that a bidirectional search
+                            // may borrow to grow its two search trees in parallel. NULL disables this.
+  //
+  // Look-up tables of the routing directions allowed for the current path, indexed by the
+  // design-rule sets of the parent and child cells. They are populated at the start of each
+  // call to findPath() by function calcAllowedTransitionMasks():
+  //
+  int minimumRoutingDirections[maxDesignRuleSets][maxDesignRuleSets];     // Result of calcMinimumAllowedDirection()
+  unsigned int allowedTransitionMask[maxDesignRuleSets][maxDesignRuleSets]; // Bit 'i' is set if the i'th transition
+                                                                            // in findPath() is allowed
+  //
+  // Integer bounds of the radius-based routing restriction on each layer, populated at the start
+  // of each call to findPath(). Every cell inside 'radiusInnerBox' is within the allowed radius
+  // of the restriction's center-point, and every cell outside 'radiusOuterBox' is beyond it:
+  //
+  CellBox_t radiusInnerBox[maxRoutingLayers];
+  CellBox_t radiusOuterBox[maxRoutingLayers];
 } PathFinding_t;
 
 
+//-----------------------------------------------------------------------------
+// Name: pathFindingIndex
+// Desc: Return the index of cell (x,y,z) in the 3D arrays of a PathFinding_t
+//       structure. The strides are set by setPathFindingWindow() for the
+//       selected memory layout and the window of the map that the arrays span.
+//-----------------------------------------------------------------------------
+static inline size_t pathFindingIndex(const PathFinding_t *pathFinding, int x, int y, int z)  {
+  return(x * pathFinding->strideX  +  y * pathFinding->strideY  +  z * pathFinding->strideZ  -  pathFinding->windowOffset);
+}
+
+
+//-----------------------------------------------------------------------------
+// Name: pathFindingCoordIndex
+// Desc: Return the index of coordinate 'coord' in the 3D arrays of a
+//       PathFinding_t structure.
+//-----------------------------------------------------------------------------
+static inline size_t pathFindingCoordIndex(const PathFinding_t *pathFinding, Coordinate_t coord)  {
+  return(pathFindingIndex(pathFinding, coord.X, coord.Y, coord.Z));
+}
+
+
 
 //
 // Declare data structure for recording routing metrics associated with
@@ -338,6 +476,22 @@ typedef struct DRC_details_t  {
 } DRC_details_t ;  // End of struct 'DRC_details_t'
 
 
+//
+// Define structure for the set of design-rule violations that were found at a single cell,
+// each identified by its two path numbers and shape-types. The set is an open-addressing hash
+// table whose slots are listed in 'touchedSlots' as they're filled, so that clearing the set
+// takes time proportional to the number of violations rather than to the table size.
+//
+typedef struct DRCPairSet_t  {
+  unsigned int *keys;         // Key in each slot of the hash table, or 'emptyDRCPairKey' if the slot is empty
+  int *touchedSlots;          // Slot numbers of the keys in the set, in the order they were added
+  int numKeys;                // Number of keys in the set
+  int numSlots;               // Number of slots in the hash table (a power of 2)
+  int hashShift;              // Number of bits to right-shift the 32-bit hash to get a slot number
+
+} DRCPairSet_t;  // End of struct definition 'DRCPairSet_t'
+
+
 //
 // Declare data structure for routing metrics:
 //
@@ -435,6 +589,9 @@ typedef struct RoutingMetrics_t  {
                                        //   0 = FALSE = do not change the congestion-related G-cost
                                        //   1 = DECREASE = decrease the congestion-related G-cost
                                        //   2 = INCREASE = increase the congestion-related G-cost
+  unsigned char *bidirectional_search; // 1D array containing Boolean flags to tell findPath() whether to search from both
+                                       // the start- and end-terminals of each path. Set for paths that explored more than
+                                       // 'bidirectional_threshold' cells in the previous iteration.
   unsigned short *one_path_traversal; // Quantity of congestion to deposit from a given path into a traversed cell after each iteration.
                                       // Value depends on the path. one_path_traversal[path_num] = ONE_TRAVERSAL * (path-specific fraction)
   int *num_vias;         // 1D array containing number of vias in each path 
@@ -445,6 +602,8 @@ typedef struct RoutingMetrics_t  {
   int *iteration_cumulative_time; // Number of (wall-clock) seconds from launching Acorn to completing iteration #i,
                                   // including DRC-checking.
   unsigned long int *path_explored_cells;      // path_explored_cells[i] is number of cells explored to find path #i in most recent iteration.
+  Coordinate_t *path_search_min;  // path_search_min[i] and path_search_max[i] are the lowest and highest (x,y,z) coordinates
+  Coordinate_t *path_search_max;  // of the cells explored to find path #i in the most recent search for this path.
   unsigned long int *iteration_explored_cells; // Number of cells explored to find all paths in iteration #j
                                                // (sum of path_explored_cells).
   unsigned long int total_explored_cells;      // Number of cells explored to find all paths across all iterations
@@ -652,6 +811,25 @@ typedef struct InputValues_t  {
                             // deciding that it has found the optimal solution. Program may add to
                             // this threshold, based on the complexity of the design.
   int runsPerPngMap; // Number of iterations to run between writing PNG versions of the routing maps.
+  unsigned char pathFindingLayout; // Memory layout of the 3D path-finding arrays: Z_INNERMOST_LAYOUT
+                                   // or LAYER_MAJOR_LAYOUT.
+  unsigned char cellInfoLayout;    // Memory layout of the 'cellInfo' matrix: Z_INNERMOST_LAYOUT or
+                                   // TILED_LAYOUT.
+  unsigned char openListEngine;    // Data structure for the Open List in findPath(): BINARY_HEAP_ENGINE
+                                   // or RADIX_HEAP_ENGINE.
+  unsigned long bidirectional_threshold; // Paths that explored more than this number of cells in the previous
+                                         // iteration are found with a bidirectional search. Zero disables this.
+  float rerouteCorridorRadiusMicrons; // Radius (in microns) of the corridor around each net's previous path
+                                      // within which the net is re-routed. Zero disables the corridor.
+  int globalRoutingTileSize;  // Width and height (in cells) of the tiles used by the global-routing
+                              // stage. Zero disables global routing.
+  int landmarksPerLayer;      // Number of landmarks on each routing layer for the landmark-based
+                              // heuristic in findPath(). Zero disables the landmark heuristic.
+  int bidirectionalSearchThreads; // Maximum number of threads that grow the two search trees of a bidirectional
+                                  // search (1 or 2). Idle threads are borrowed only after all nets have started.
+  float rerouteCongestionTolerance; // Percentage change of the congestion in a tile, from one iteration to the
+                                    // next, above which nets near the tile are re-routed. DRC-free nets that
+                                    // are not near such tiles keep their paths. Zero disables this.
 
 
 
@@ -800,6 +978,52 @@ typedef struct Congestion_t  {
 } Congestion_t; // End of struct definition 'Congestion_t'
 
 
+//
+// Define structure that summarizes the TRACE congestion of non-pseudo nets in a
+// cell, so that congestion penalties can be looked up without scanning the cell's
+// congestion[] array. The summaries are built by function updateCongestionSummaries():
+//
+typedef struct CongestionSummary_t  {
+  unsigned int   pathBloomFilter;    // Bit (pathNum % 32) is set for each non-pseudo net with TRACE congestion in the cell
+  int            traceCongestion;    // Sum of the congestion penalties, as calculated in calc_congestion_penalty(), of all
+                                     // non-pseudo TRACE congestion in the cell
+  int            cornerCongestion;   // Sum of the congestion penalties, as calculated in calc_corner_congestion(), of all
+                                     // non-pseudo TRACE congestion in the cell
+  unsigned char  DR_subset;          // Design-rule subset of the non-pseudo TRACE congestion in the cell
+  unsigned char  isValid;            // FALSE if the non-pseudo TRACE congestion in the cell has more than one
+                                     // design-rule subset, in which case the summary may not be used
+} CongestionSummary_t; // End of struct definition 'CongestionSummary_t'
+
+
+//
+// Define structure for the static attributes of a cell that findPath() reads for every
+// child cell that it explores. The attributes are copied from the 'cellInfo' matrix into
+// a flat array of 4 bytes per cell by function updateCellRoutingInfo(), so that the
+// neighbors of a cell share cache lines instead of each occupying a separate 'CellInfo_t'
+// structure. Except for 'nearBarrier' and 'nearPinSwap', the members have the same
+// meaning as the members of 'CellInfo_t':
+//
+typedef struct CellRoutingInfo_t  {
+  unsigned int designRuleSet              :  4 ; // 0 to 15
+  unsigned int traceCostMultiplierIndex   :  4 ; // 0 to 15
+  unsigned int viaUpCostMultiplierIndex   :  3 ; // 0 to 7
+  unsigned int viaDownCostMultiplierIndex :  3 ; // 0 to 7
+  unsigned int forbiddenTraceBarrier      :  1 ; // Unwalkable barrier for traces
+  unsigned int forbiddenUpViaBarrier      :  1 ; // Unwalkable via above
+  unsigned int forbiddenDownViaBarrier    :  1 ; // Unwalkable via below
+  unsigned int swap_zone                  :  8 ; // Unique swap zone (1 to 255), or zero
+  unsigned int nearBarrier                :  1 ; // 1 if any bit of 'forbiddenProximityBarrier' is set
+  unsigned int nearPinSwap                :  1 ; // 1 if any bit of 'forbiddenProximityPinSwap' is set
+} CellRoutingInfo_t; // End of struct definition 'CellRoutingInfo_t'
+
+
+//
+// Define the handle of a cell's 'congestion' or 'pathCenters' array, which is stored in
+// the slabs of file 'cellArraySlabs.c'. Handle zero is an empty array:
+//
+typedef unsigned int CellArrayHandle_t;
+
+
 //
 // Define structure for recording the path number
 // and shape-type of paths at a given x/y/z location:
@@ -815,16 +1039,18 @@ typedef struct PathAndShapeInfo_t  {
 //
 typedef struct CellInfo_t {
 
-  // 8 bytes for following pointer (on 64-bit architecture):
-  Congestion_t  *congestion; // Pointer to 1-dimensional array, with each
-                             // element containing (1) pathTraversalsTimes100,
-                             // (2) pathNum, (3) design-rule subset, and (4) shapeType.
+  // 4 bytes for following handle, which is converted to an address by function
+  // cellCongestion() in file 'cellArraySlabs.h':
+  CellArrayHandle_t congestionHandle;  // Handle of 1-dimensional 'congestion' array, with each
+                                       // element containing (1) pathTraversalsTimes100,
+                                       // (2) pathNum, (3) design-rule subset, and (4) shapeType.
 
-  // 8 bytes for following pointer (on 64-bit architecture):
-  PathAndShapeInfo_t *pathCenters ;   // Pointer to 1-dimensional array, with each
-                                      // element containing (1) pathNum of 
-                                      // traversing center-line, and (2)  the
-                                      // shape-type of traversing shape (trace, up-via, down-via)
+  // 4 bytes for following handle, which is converted to an address by function
+  // cellPathCenters() in file 'cellArraySlabs.h':
+  CellArrayHandle_t pathCentersHandle; // Handle of 1-dimensional 'pathCenters' array, with each
+                                       // element containing (1) pathNum of
+                                       // traversing center-line, and (2)  the
+                                       // shape-type of traversing shape (trace, up-via, down-via)
 
 
 
@@ -910,9 +1136,78 @@ typedef struct CellInfo_t {
   _Bool        flag                            :  1 ; // Flag bit used to temporarily mark which cells have been
                                                       // processed during certain operations.
 
+  _Bool        congestionIsShared              :  1 ; // 1 if the 'congestion' array belongs to the cell of
+                                                      // another cellInfo map, such as the main map that a
+                                                      // diff-pair sub-map was copied from. A shared array is
+                                                      // copied before it's modified, and is never freed.
+
+  _Bool        pathCentersAreShared            :  1 ; // 1 if the 'pathCenters' array belongs to the cell of
+                                                      // another cellInfo map, with the same rules as for
+                                                      // 'congestionIsShared'.
+
 } CellInfo_t;  // End of struct definition 'CellInfo_t'
 
 
+//
+// Define structure to hold the memory of the sub-maps that optimizeDiffPairConnections()
+// uses for each diff-pair connection: one 'cellInfo' matrix for each of the two wiring
+// configurations, and one set of path-finding arrays for each of the two diff-pair nets,
+// which are routed by parallel threads. The memory is kept from connection to connection
+// and from iteration to iteration, and is enlarged only when a sub-map is larger than
+// every previous sub-map. The pool is created by initializeSubMapPool() and freed by
+// freeSubMapPool().
+//
+typedef struct SubMapPool_t  {
+  CellInfo_t ***cellInfo[2];           // X-direction pointers of the 'cellInfo' matrix for each wiring configuration
+  CellInfo_t  **cellInfoColumns[2];    // Y-direction pointers of each 'cellInfo' matrix
+  CellInfo_t   *cellInfoCells[2];      // Elements of each 'cellInfo' matrix
+  int           maxCellInfoWidth[2];   // Number of X-direction pointers allocated in cellInfo[i]
+  size_t        maxCellInfoColumns[2]; // Number of Y-direction pointers allocated in cellInfoColumns[i]
+  size_t        maxCellInfoCells[2];   // Number of elements allocated in cellInfoCells[i]
+
+  PathFinding_t pathFinding[2];        // Path-finding arrays for each of the two diff-pair nets
+  _Bool         pathFindingAllocated[2]; // TRUE if the arrays in pathFinding[i] have been allocated
+  size_t        maxOpenListItems[2];   // Number of elements allocated in the 1-dimensional arrays of pathFinding[i]
+} SubMapPool_t;  // End of struct definition 'SubMapPool_t'
+
+
+//
+// Define structure to hold the landmarks and their distance fields, which provide
+// lower bounds of the G-cost between any two cells for the landmark-based (ALT)
+// heuristic. The distance from landmark 'i' to cell (x,y,z) is
+//     quantum[i] * distance[((z * mapHeight + y) * mapWidth + x) * numLandmarks + i],
+// rounded down to a multiple of quantum[i], so each layer is a plane of 16-bit values
+// in which the distances from all landmarks to a given cell are adjacent in memory.
+// The structure is created once, before the first iteration, and is read-only thereafter.
+//
+typedef struct Landmarks_t  {
+  int numLandmarks;            // Total number of landmarks on all layers
+  Coordinate_t *coord;         // coord[i] = location of landmark 'i'
+  unsigned long *quantum;      // quantum[i] = G-cost per unit of the 16-bit distances from landmark 'i'
+  unsigned short *distance;    // Distances from each landmark to each cell, in units of 'quantum'. Cells
+                               // that cannot be reached from a landmark have the value 'landmarkUnreachable'.
+} Landmarks_t;  // End of struct definition 'Landmarks_t'
+
+
+//
+// Define structure for the design-rule-check results of the main map that are carried from
+// one call of calcRoutabilityMetrics() to the next. The results of a cell are checked again
+// only if the contiguous path of some net changed within the maximum interaction radius of the
+// cell. Otherwise, the cell's recorded results are re-applied. The per-cell arrays are indexed
+// by ((x * mapHeight) + y) * numLayers + z.
+//
+typedef struct IncrementalDRC_t  {
+  int numNets;                     // Number of nets, including pseudo-nets, in the per-net arrays
+  int numChecks;                   // Number of calls to calcRoutabilityMetrics() that recorded results
+  int *contigPathLength;           // Length of each net's contiguous path at the previous check
+  int *maxContigPathLength;        // Number of elements allocated in each array of 'contigPathCoords'
+  Coordinate_t **contigPathCoords; // Contiguous path of each net at the previous check
+  unsigned char *recheckCell;      // TRUE if the cell's results must be calculated again
+  CellArrayHandle_t *records;      // Handle of the cell's recorded results in the slabs of file
+                                   // 'cellArraySlabs.c', or zero if the cell has no recorded results
+} IncrementalDRC_t;  // End of struct definition 'IncrementalDRC_t'
+
+
 //
 //  Define structure that holds information about the overall map:
 //
@@ -921,6 +1216,7 @@ typedef struct MapInfo_t  {
   unsigned int mapWidth;         // Width of map, as measured in cells
   float mapDiagonal;             // Diagonal extent in map, as measured in cells
   unsigned int numLayers;        // Number of routing layers, excluding vias
+  unsigned char cellInfoLayout;  // Memory layout of the 'cellInfo' matrix: Z_INNERMOST_LAYOUT or TILED_LAYOUT
   unsigned int numPaths;         // Number of non-pseudo paths to route (= number of nets).
   unsigned int numPseudoPaths;   // Number of pseudo paths to route (= half the number of diff-pair paths)
   Coordinate_t *start_cells;     // Array of starting x/y/z coordinates (in cell units): start_cells[net_number].X = X-position in cells
@@ -960,10 +1256,52 @@ typedef struct MapInfo_t  {
   float maxInteractionRadiusSquaredOnLayer[maxRoutingLayers]; // = Square of 'maxInteractionRadiusCellsOnLayer', in units of cells squared, for a layer.
   float iterationDependentRatio; // This ratio will be initialized to 0.20 at the first iteration, and eventually reach 1.00 after an appropriate number
                                  // of iterations. It is used for slowly scaling up congestions and congestion sensitivities.
+  const CongestionSummary_t *congestionSummary; // Flat array of per-cell congestion summaries, indexed by ((x * mapHeight) + y) * numLayers + z.
+                                                // NULL unless the congestion in the map is unchanged since the summaries were built by
+                                                // function updateCongestionSummaries().
+  const Landmarks_t *landmarks;  // Landmarks and distance fields for the landmark-based heuristic in findPath(). NULL
+                                 // if the landmark heuristic is disabled, and for sub-maps.
+  const CellRoutingInfo_t *cellRoutingInfo; // Flat array of the static routing attributes of each cell, indexed like
+                                            // 'congestionSummary' and built by function updateCellRoutingInfo(). NULL
+                                            // for sub-maps, whose attributes are read from their 'cellInfo' matrix.
+  IncrementalDRC_t *incrementalDRC;  // Design-rule-check results from the previous call to calcRoutabilityMetrics(),
+                                     // so that only the cells near changed paths are checked again. NULL for sub-maps.
 
 } MapInfo_t;  // End of struct definition 'MapInfo_t'
 
 
+//-----------------------------------------------------------------------------
+// Name: getCellRoutingInfo
+// Desc: Return the static routing attributes of cell (x,y,z), which must be on
+//       a routing layer. The attributes are read from the flat array
+//       'mapInfo->cellRoutingInfo' if it exists, or from the 'cellInfo' matrix
+//       otherwise.
+//-----------------------------------------------------------------------------
+static inline CellRoutingInfo_t getCellRoutingInfo(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
+                                                   int x, int y, int z)  {
+
+  if (mapInfo->cellRoutingInfo)  {
+    return(mapInfo->cellRoutingInfo[((size_t)x * mapInfo->mapHeight + y) * mapInfo->numLayers + z]);
+  }
+
+  const CellInfo_t *cell = &(cellInfo[x][y][z]);
+  CellRoutingInfo_t routingInfo;
+  routingInfo.designRuleSet              = cell->designRuleSet;
+  routingInfo.traceCostMultiplierIndex   = cell->traceCostMultiplierIndex;
+  routingInfo.viaUpCostMultiplierIndex   = cell->viaUpCostMultiplierIndex;
+  routingInfo.viaDownCostMultiplierIndex = cell->viaDownCostMultiplierIndex;
+  routingInfo.forbiddenTraceBarrier      = cell->forbiddenTraceBarrier;
+  routingInfo.forbiddenUpViaBarrier      = cell->forbiddenUpViaBarrier;
+  routingInfo.forbiddenDownViaBarrier    = cell->forbiddenDownViaBarrier;
+  routingInfo.swap_zone                  = cell->swap_zone;
+  routingInfo.nearBarrier                = (cell->forbiddenProximityBarrier != 0);
+  routingInfo.nearPinSwap                = (cell->forbiddenProximityPinSwap != 0);
+
+  return(routingInfo);
+
+}  // End of function 'getCellRoutingInfo'
+
+
 //
 // Define structure that holds floating-point, two-dimensional vector:
 //
@@ -994,8 +1332,88 @@ typedef struct RoutingRestriction_t  {
   unsigned char restrictionFlag;  // Boolean value that specifies whether routing is restricted
                                   // on any layer.
 
+  // Optional corridor that restricts routing to a band around a net's path from the previous
+  // iteration. Bit (x,y) of 'corridorMap' is set if routing is allowed at (x,y) on each layer
+  // whose 'allowedLayers' element is TRUE. The corridor is used only if both 'restrictionFlag'
+  // and 'corridorFlag' are TRUE:
+  unsigned char *corridorMap;     // Bitmap with one bit per (x,y) location, stored row by row
+  int corridorMapWidth;           // Number of bits in each row of 'corridorMap'
+  unsigned char corridorFlag;     // Boolean value that specifies whether 'corridorMap' is used
+  CellBox_t corridorBox;          // Bounding box of the (x,y) locations whose bits are set in 'corridorMap'
+
 } RoutingRestriction_t;  // End of struct definition 'RoutingRestriction_t'
 
+
+//-----------------------------------------------------------------------------
+// Name: cellIsInCorridor
+// Desc: Return TRUE if the bit for location (x,y) is set in the 'corridorMap'
+//       of 'routingRestrictions'. Defined here so that findPath() can check
+//       the corridor for each child cell without the overhead of a function call.
+//-----------------------------------------------------------------------------
+static inline int cellIsInCorridor(const RoutingRestriction_t *routingRestrictions, int x, int y)  {
+  size_t bit = (size_t)y * routingRestrictions->corridorMapWidth + x;
+  return((routingRestrictions->corridorMap[bit >> 3] >> (bit & 7)) & 1);
+}
+
+
+//
+// Define structure to hold the results of the global-routing stage, which routes
+// each net on a coarse grid of tiles (G-cells) before the detailed routing by
+// findPath(). Tile (tileX, tileY, z) has index (z * numTilesY + tileY) * numTilesX + tileX
+// in each of the per-tile arrays. The 'East' and 'North' arrays describe the edge
+// between a tile and its neighbor to the east (+X) or north (+Y) on the same layer.
+//
+typedef struct GlobalRouting_t  {
+  int tileSize;    // Width and height of each tile, in cells. Zero disables global routing.
+  int numTilesX;   // Number of tiles in the X-direction
+  int numTilesY;   // Number of tiles in the Y-direction
+  int numLayers;   // Number of routing layers
+  int numTiles;    // Total number of tiles on all layers
+
+  double *lateralCost; // Average trace-cost of the walkable cells in each tile. Zero if the tile
+                       // contains no walkable cells.
+  double *viaUpCost;   // Average cost of the upward vias that are allowed in each tile. Zero if
+                       // no upward via is allowed in the tile.
+  float *capacityEast;  // Number of pairs of walkable cells across the edge, in cell units
+  float *capacityNorth;
+  float *usageEast;     // Sum of the track-pitches (in cell units) of the nets that cross the edge
+  float *usageNorth;
+  float *historyEast;   // Accumulated overflow-cost of the edge from previous iterations
+  float *historyNorth;
+  unsigned char *designRuleEast;  // Design-rule set at the mid-point of the edge
+  unsigned char *designRuleNorth;
+  float pitchCells[maxDesignRuleSets][maxDesignRuleSubsets]; // Trace width plus spacing, in cell units
+
+  int numNets;       // Number of elements in 'netTiles' and 'numNetTiles'
+  int **netTiles;    // netTiles[net][i] = index of the i'th tile in the global route of 'net'
+  int *numNetTiles;  // Number of tiles in the global route of each net. Zero if the net has no
+                     // global route.
+
+} GlobalRouting_t;  // End of struct definition 'GlobalRouting_t'
+
+
+//
+// Define structure to track the regions of the map in which the congestion changed
+// significantly since the previous iteration. The map is divided into tiles of
+// 'dirtyTileSize' x 'dirtyTileSize' cells on each layer. Tile (tileX, tileY, z) has
+// index (z * numTilesY + tileY) * numTilesX + tileX in each of the per-tile arrays.
+//
+typedef struct DirtyTiles_t  {
+  int numTilesX;   // Number of tiles in the X-direction
+  int numTilesY;   // Number of tiles in the Y-direction
+  int numLayers;   // Number of routing layers
+  int numTiles;    // Total number of tiles on all layers
+  int numDirtyTiles;  // Number of tiles whose 'isDirty' flag is set
+
+  double *congestionCost;  // Sum of the congestion in each tile, weighted by the trace- or via-congestion
+                           // multiplier that was in effect when the sum was calculated
+  unsigned char *isDirty;  // TRUE if 'congestionCost' of the tile changed by more than the tolerance
+                           // in the most recent call to function updateDirtyTiles()
+
+} DirtyTiles_t;  // End of struct definition 'DirtyTiles_t'
+
+
+
 //
 // Define structure to describe a via-stack, which is used in multiple functions.
 //
@@ -1293,6 +1711,24 @@ ViaStack_t findNearbyLayerTransition_wrapper(const int pathNum, int pathLengths[
 void add_path_center_info(CellInfo_t *cellInfo, int pathNum, int shape_type);
 
 
+//-----------------------------------------------------------------------------
+// Name: unshareCongestion
+// Desc: If the 'congestion' array of cell 'cellInfo' is shared with another
+//       cellInfo map, then replace it with a private copy so that it can be
+//       modified or freed without affecting the other map.
+//-----------------------------------------------------------------------------
+void unshareCongestion(CellInfo_t *cellInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: unsharePathCenters
+// Desc: If the 'pathCenters' array of cell 'cellInfo' is shared with another
+//       cellInfo map, then replace it with a private copy so that it can be
+//       modified or freed without affecting the other map.
+//-----------------------------------------------------------------------------
+void unsharePathCenters(CellInfo_t *cellInfo);
+
+
 //-----------------------------------------------------------------------------
 // Name: getIndexOfTraversingPath
 // Desc: Determine whether path 'pathNum' with shape type 'shapeType' and design-
@@ -1401,13 +1837,22 @@ void addCongestionAroundTerminal(const int pathNum, const Coordinate_t centerPoi
 //       If Boolean parameter 'disableRandomCosts' is TRUE, then findPath()
 //       disables any randomized changes to the congestion-related G-cost.
 //
+//       If 'previousPathCoords' is not NULL, then it contains a previous path
+//       with 'previousPathLength' cells between the same terminals, such as
+//       the path from the previous iteration. The G-cost of this path under
+//       the current congestion is an upper bound for the new path, so cells
+//       whose F-cost reaches this bound are not added to the Open List. If no
+//       cheaper path exists, then the previous path is returned again.
+//       'previousPathCoords' may be the same array as '*pathCoords'.
+//
 //-----------------------------------------------------------------------------
 unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
                        int pathNum, const Coordinate_t startCoord, const Coordinate_t endCoord,
                        Coordinate_t *pathCoords[], int *pathLength, InputValues_t *user_inputs,
                        RoutingMetrics_t *routability, PathFinding_t *pathFinding, const int record_explored_cells,
                        const int record_elapsed_time, const int useDijkstra, const RoutingRestriction_t *routingRestrictions,
-                       const int disableRandomCosts, const int recognizeSelfCongestion);
+                       const int disableRandomCosts, const int recognizeSelfCongestion,
+                       const Coordinate_t *previousPathCoords, const int previousPathLength);
 
 
 //-----------------------------------------------------------------------------
@@ -1432,6 +1877,11 @@ unsigned long findPath(const MapInfo_t *mapInfo, CellInfo_t ***const cellInfo,
 //       to STDOUT. This can be useful when calculating routability metrics for
 //       many small sub-maps. If 'parallelProcessing' is TRUE, then processing is
 //       performed in multiple threads.
+//
+//       If 'mapInfo->incrementalDRC' is not NULL, then only the cells near nets
+//       whose contiguous paths changed since the previous call are checked for
+//       design-rule violations and congestion. The recorded results of the other
+//       cells are re-applied, which produces the same results as checking them.
 //-----------------------------------------------------------------------------
 void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                             Coordinate_t *pathCoords[], int contiguousPathLength[],
@@ -1441,5 +1891,23 @@ void calcRoutabilityMetrics(const MapInfo_t *mapInfo, const int pathLength[],
                             int exitIfInvalidJump, int beQuiet, int parallelProcessing);
 
 
+//-----------------------------------------------------------------------------
+// Name: allocateIncrementalDRC
+// Desc: Allocate the arrays of 'incrementalDRC' for the main map described by
+//       'mapInfo', such that the first call to calcRoutabilityMetrics() checks
+//       every cell. The memory must later be freed by function
+//       freeIncrementalDRC().
+//-----------------------------------------------------------------------------
+void allocateIncrementalDRC(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeIncrementalDRC
+// Desc: Free the memory allocated by function allocateIncrementalDRC(), including
+//       the recorded results of each cell.
+//-----------------------------------------------------------------------------
+void freeIncrementalDRC(IncrementalDRC_t *incrementalDRC, const MapInfo_t *mapInfo);
+
+
 
 #endif
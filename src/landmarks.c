@@ -0,0 +1,530 @@
+#include "global_defs.h"
+#include "landmarks.h"
+
+
+//
+// Define 'DEBUG_createLandmarks' and re-compile if you want verbose
+// debugging print-statements enabled:
+//
+// #define DEBUG_createLandmarks 1
+#undef DEBUG_createLandmarks
+
+
+//
+// Define structure for the trace- and via-costs of each cost-multiplier index, as
+// set by function set_costs_to_userDefined_values(). The distance fields are based
+// on these costs, rather than on the costs in 'user_inputs', which are reduced to
+// their base values during the first iteration:
+//
+typedef struct LandmarkCosts_t  {
+  unsigned long cellCost[maxTraceCostMultipliers];
+  unsigned long diagCost[maxTraceCostMultipliers];
+  unsigned long knightCost[maxTraceCostMultipliers];
+  unsigned long vertCost[maxViaCostMultipliers];
+} LandmarkCosts_t;
+
+
+//
+// Offsets (deltaX, deltaY, deltaZ) of the moves that are considered when calculating
+// the distances from each landmark: 4 north/south/east/west moves, 4 diagonal moves,
+// 8 knight's moves, and 2 vias. These are all the moves that findPath() can make.
+//
+static const int numLandmarkMoves = 18;
+static const signed char landmarkMoveDelta[18][3] = {
+  { 1,  0,  0}, {-1,  0,  0}, { 0,  1,  0}, { 0, -1,  0},
+  { 1,  1,  0}, { 1, -1,  0}, {-1,  1,  0}, {-1, -1,  0},
+  { 2,  1,  0}, { 2, -1,  0}, {-2,  1,  0}, {-2, -1,  0},
+  { 1,  2,  0}, { 1, -2,  0}, {-1,  2,  0}, {-1, -2,  0},
+  { 0,  0,  1}, { 0,  0, -1}
+};
+
+
+//-----------------------------------------------------------------------------
+// Name: landmarkCellIndex
+// Desc: Return the index of cell (x, y, z) in the per-cell arrays of this file,
+//       in which each layer is a contiguous plane of mapWidth x mapHeight cells.
+//-----------------------------------------------------------------------------
+static inline long landmarkCellIndex(const MapInfo_t *mapInfo, int x, int y, int z)  {
+
+  return(((long)z * mapInfo->mapHeight + y) * mapInfo->mapWidth + x);
+
+}  // End of function 'landmarkCellIndex'
+
+
+//-----------------------------------------------------------------------------
+// Name: calcLandmarkMoveCost
+// Desc: Return a lower bound of the cost that calc_distance_G_cost() assigns to
+//       a move between cell (x, y, z) and cell (x+deltaX, y+deltaY, z+deltaZ),
+//       in either direction. The bound is the smaller of the costs of the two
+//       directions in which the move is allowed by the barriers and via
+//       blockages. Returns ULONG_MAX if the move is allowed in neither
+//       direction for any net, or if either cell is in a pin-swap zone. The
+//       neighboring cell must be within the map.
+//-----------------------------------------------------------------------------
+static unsigned long calcLandmarkMoveCost(CellInfo_t ***cellInfo, const LandmarkCosts_t *costs,
+                                          int x, int y, int z, int deltaX, int deltaY, int deltaZ)  {
+
+  const int a = x + deltaX;
+  const int b = y + deltaY;
+  const int c = z + deltaZ;
+
+  // Pin-swap zones are excluded from the distance fields. Within them, the costs
+  // are smaller by a factor of 2^NON_PIN_SWAP_EXPONENT, so a zone that belongs to
+  // a different net would otherwise be a shortcut that findPath() cannot take:
+  if (cellInfo[x][y][z].swap_zone || cellInfo[a][b][c].swap_zone)  {
+    return(ULONG_MAX);
+  }
+
+  //
+  // Vias are allowed in both directions, unless either cell blocks the via. The
+  // up-via cost of the lower cell is the same as the down-via cost of the upper cell:
+  //
+  if (deltaZ != 0)  {
+    const int lowerZ = min(z, c);
+    const int upperZ = max(z, c);
+    if (cellInfo[x][y][lowerZ].forbiddenUpViaBarrier || cellInfo[x][y][upperZ].forbiddenDownViaBarrier)  {
+      return(ULONG_MAX);
+    }
+    return(min(costs->vertCost[cellInfo[x][y][upperZ].viaDownCostMultiplierIndex],
+               costs->vertCost[cellInfo[x][y][lowerZ].viaUpCostMultiplierIndex]));
+  }  // End of if-block for vias
+
+  //
+  // Lateral moves may not enter a trace barrier, so the move is only allowed in
+  // the direction(s) whose target cell is not a barrier:
+  //
+  const int enterNeighbor = ! cellInfo[a][b][c].forbiddenTraceBarrier;
+  const int enterCell     = ! cellInfo[x][y][z].forbiddenTraceBarrier;
+  if ((! enterNeighbor) && (! enterCell))  {
+    return(ULONG_MAX);
+  }
+  const int neighborCostIndex = cellInfo[a][b][c].traceCostMultiplierIndex;
+  const int cellCostIndex     = cellInfo[x][y][z].traceCostMultiplierIndex;
+
+  // North/south/east/west moves:
+  if (abs(deltaX) + abs(deltaY) == 1)  {
+    unsigned long cost = ULONG_MAX;
+    if (enterNeighbor)
+      cost = costs->cellCost[neighborCostIndex];
+    if (enterCell)
+      cost = min(cost, costs->cellCost[cellCostIndex]);
+    return(cost);
+  }
+
+  // Diagonal and knight's moves do not cut across the corners of barriers. The corner
+  // cells are the same for both directions of the move:
+  int corner_1_X, corner_1_Y, corner_2_X, corner_2_Y;
+  if (abs(deltaX) == 2)  {
+    corner_1_X = x + deltaX / 2;   corner_1_Y = b;
+    corner_2_X = x + deltaX / 2;   corner_2_Y = y;
+  }
+  else if (abs(deltaY) == 2)  {
+    corner_1_X = a;                corner_1_Y = y + deltaY / 2;
+    corner_2_X = x;                corner_2_Y = y + deltaY / 2;
+  }
+  else  {
+    corner_1_X = a;                corner_1_Y = y;
+    corner_2_X = x;                corner_2_Y = b;
+  }
+  if (cellInfo[corner_1_X][corner_1_Y][z].forbiddenTraceBarrier || cellInfo[corner_2_X][corner_2_Y][z].forbiddenTraceBarrier)  {
+    return(ULONG_MAX);
+  }
+
+  // Diagonal moves:
+  if (abs(deltaX) + abs(deltaY) == 2)  {
+    unsigned long cost = ULONG_MAX;
+    if (enterNeighbor)
+      cost = costs->diagCost[neighborCostIndex];
+    if (enterCell)
+      cost = min(cost, costs->diagCost[cellCostIndex]);
+    return(cost);
+  }
+
+  // Knight's moves cost the average of the target cell's knight-cost and the larger
+  // knight-cost of the two intermediate (corner) cells:
+  unsigned long targetCost = ULONG_MAX;
+  if (enterNeighbor)
+    targetCost = costs->knightCost[neighborCostIndex];
+  if (enterCell)
+    targetCost = min(targetCost, costs->knightCost[cellCostIndex]);
+  unsigned long intermediateCost = max(costs->knightCost[cellInfo[corner_1_X][corner_1_Y][z].traceCostMultiplierIndex],
+                                       costs->knightCost[cellInfo[corner_2_X][corner_2_Y][z].traceCostMultiplierIndex]);
+  return((targetCost + intermediateCost) / 2);
+
+}  // End of function 'calcLandmarkMoveCost'
+
+
+//-----------------------------------------------------------------------------
+// Name: siftLandmarkHeapUp
+// Desc: Move the cell at position 'position' of the indexed binary min-heap
+//       'heapCell' toward the top of the heap until its distance is not smaller
+//       than that of its parent. The heap is ordered by the values of 'distance',
+//       and 'heapPosition' holds the position of each cell in the heap.
+//-----------------------------------------------------------------------------
+static void siftLandmarkHeapUp(int heapCell[], int heapPosition[], const unsigned long distance[], int position)  {
+
+  int cell = heapCell[position];
+  while (position > 0)  {
+    int parent = (position - 1) / 2;
+    if (distance[heapCell[parent]] <= distance[cell])  {
+      break;
+    }
+    heapCell[position] = heapCell[parent];
+    heapPosition[heapCell[position]] = position;
+    position = parent;
+  }  // End of while-loop for sifting the cell upward
+  heapCell[position] = cell;
+  heapPosition[cell] = position;
+
+}  // End of function 'siftLandmarkHeapUp'
+
+
+//-----------------------------------------------------------------------------
+// Name: popLandmarkHeap
+// Desc: Remove and return the cell with the smallest distance from the indexed
+//       binary min-heap 'heapCell', which contains '*heapSize' cells and must
+//       not be empty.
+//-----------------------------------------------------------------------------
+static int popLandmarkHeap(int heapCell[], int heapPosition[], const unsigned long distance[], int *heapSize)  {
+
+  int topCell = heapCell[0];
+  heapPosition[topCell] = -1;
+  (*heapSize)--;
+  if (*heapSize == 0)  {
+    return(topCell);
+  }
+
+  int cell = heapCell[*heapSize];
+  int position = 0;
+  while (1)  {
+    int child = 2 * position + 1;
+    if (child >= *heapSize)  {
+      break;
+    }
+    if ((child + 1 < *heapSize) && (distance[heapCell[child + 1]] < distance[heapCell[child]]))  {
+      child++;
+    }
+    if (distance[cell] <= distance[heapCell[child]])  {
+      break;
+    }
+    heapCell[position] = heapCell[child];
+    heapPosition[heapCell[position]] = position;
+    position = child;
+  }  // End of while-loop for sifting the last cell downward
+  heapCell[position] = cell;
+  heapPosition[cell] = position;
+
+  return(topCell);
+
+}  // End of function 'popLandmarkHeap'
+
+
+//-----------------------------------------------------------------------------
+// Name: calcLandmarkDistances
+// Desc: Calculate the lower bound of the G-cost from landmark number
+//       'landmarkNum' to every cell in the map with Dijkstra's algorithm, and
+//       store the results in the landmark's 16-bit slots of the 'distance'
+//       array of 'landmarks'. The work-space arrays 'cellDistance', 'heapCell'
+//       and 'heapPosition' must each have one element per cell in the map.
+//-----------------------------------------------------------------------------
+static void calcLandmarkDistances(Landmarks_t *landmarks, int landmarkNum, const MapInfo_t *mapInfo,
+                                  CellInfo_t ***cellInfo, const LandmarkCosts_t *costs,
+                                  unsigned long cellDistance[], int heapCell[], int heapPosition[])  {
+
+  const long numCells = (long)mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers;
+  const int  cellsPerLayer = mapInfo->mapWidth * mapInfo->mapHeight;
+
+  for (long i = 0; i < numCells; i++)  {
+    cellDistance[i] = ULONG_MAX;
+    heapPosition[i] = -1;
+  }
+
+  const Coordinate_t landmark = landmarks->coord[landmarkNum];
+  int heapSize = 1;
+  heapCell[0] = landmarkCellIndex(mapInfo, landmark.X, landmark.Y, landmark.Z);
+  heapPosition[heapCell[0]] = 0;
+  cellDistance[heapCell[0]] = 0;
+
+  unsigned long maxDistance = 0;
+  while (heapSize > 0)  {
+    const int cell = popLandmarkHeap(heapCell, heapPosition, cellDistance, &heapSize);
+    maxDistance = cellDistance[cell];
+
+    const int z = cell / cellsPerLayer;
+    const int y = (cell % cellsPerLayer) / mapInfo->mapWidth;
+    const int x = cell % mapInfo->mapWidth;
+
+    for (int move = 0; move < numLandmarkMoves; move++)  {
+      const int a = x + landmarkMoveDelta[move][0];
+      const int b = y + landmarkMoveDelta[move][1];
+      const int c = z + landmarkMoveDelta[move][2];
+      if ((a < 0) || (b < 0) || (c < 0) || (a >= mapInfo->mapWidth) || (b >= mapInfo->mapHeight) || (c >= mapInfo->numLayers))  {
+        continue;
+      }
+
+      const int neighbor = landmarkCellIndex(mapInfo, a, b, c);
+      if ((cellDistance[neighbor] != ULONG_MAX) && (heapPosition[neighbor] < 0))  {
+        continue;  // Neighbor's distance is already final
+      }
+
+      const unsigned long moveCost = calcLandmarkMoveCost(cellInfo, costs, x, y, z, landmarkMoveDelta[move][0],
+                                                          landmarkMoveDelta[move][1], landmarkMoveDelta[move][2]);
+      if ((moveCost == ULONG_MAX) || (cellDistance[cell] + moveCost >= cellDistance[neighbor]))  {
+        continue;
+      }
+
+      cellDistance[neighbor] = cellDistance[cell] + moveCost;
+      if (heapPosition[neighbor] < 0)  {
+        heapCell[heapSize] = neighbor;
+        heapSize++;
+        siftLandmarkHeapUp(heapCell, heapPosition, cellDistance, heapSize - 1);
+      }
+      else  {
+        siftLandmarkHeapUp(heapCell, heapPosition, cellDistance, heapPosition[neighbor]);
+      }
+    }  // End of for-loop for index 'move'
+  }  // End of while-loop for (heapSize > 0)
+
+  //
+  // Choose the quantum such that the largest finite distance fits in 16 bits without
+  // colliding with 'landmarkUnreachable'. Distances are rounded down, so the stored
+  // values remain lower bounds:
+  //
+  const unsigned long quantum = maxDistance / (landmarkUnreachable - 1) + 1;
+  landmarks->quantum[landmarkNum] = quantum;
+  const int numLandmarks = landmarks->numLandmarks;
+  for (long i = 0; i < numCells; i++)  {
+    landmarks->distance[i * numLandmarks + landmarkNum]
+        = (cellDistance[i] == ULONG_MAX) ? landmarkUnreachable : (unsigned short)(cellDistance[i] / quantum);
+  }
+
+  #ifdef DEBUG_createLandmarks
+  printf("DEBUG: (thread %2d) Landmark %d at (%d,%d,%d) has a maximum distance of %'lu and a quantum of %'lu.\n",
+         omp_get_thread_num(), landmarkNum, landmark.X, landmark.Y, landmark.Z, maxDistance, quantum);
+  #endif
+
+}  // End of function 'calcLandmarkDistances'
+
+
+//-----------------------------------------------------------------------------
+// Name: findWalkableCellNearest
+// Desc: Return in '*nearestCell' the cell on layer 'z' that is neither a
+//       trace barrier nor in a pin-swap zone, and is closest to location (x, y).
+//       Returns FALSE if no such cell exists on the layer.
+//-----------------------------------------------------------------------------
+static int findWalkableCellNearest(Coordinate_t *nearestCell, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                                   int x, int y, int z)  {
+
+  long minDistanceSquared = LONG_MAX;
+  for (int a = 0; a < mapInfo->mapWidth; a++)  {
+    for (int b = 0; b < mapInfo->mapHeight; b++)  {
+      if (cellInfo[a][b][z].forbiddenTraceBarrier || cellInfo[a][b][z].swap_zone)  {
+        continue;
+      }
+      long distanceSquared = (long)(a - x) * (a - x) + (long)(b - y) * (b - y);
+      if (distanceSquared < minDistanceSquared)  {
+        minDistanceSquared = distanceSquared;
+        nearestCell->X = a;
+        nearestCell->Y = b;
+        nearestCell->Z = z;
+      }
+    }  // End of for-loop for index 'b'
+  }  // End of for-loop for index 'a'
+
+  return(minDistanceSquared != LONG_MAX);
+
+}  // End of function 'findWalkableCellNearest'
+
+
+//-----------------------------------------------------------------------------
+// Name: createLandmarks
+// Desc: Select 'user_inputs->landmarksPerLayer' landmarks on each routing
+//       layer, and calculate the lower bound of the G-cost between each
+//       landmark and every cell in the map. The landmarks are selected from
+//       the walkable cells nearest the map's corners and from the nets'
+//       terminals, such that the landmarks on each layer are far apart. The
+//       lower bounds are the shortest-path costs through the map, using the
+//       trace- and via-costs of each cell, including the user-defined cost
+//       multipliers, without any congestion. Only the user-defined barriers
+//       and via blockages restrict the moves, so the bounds are valid for every
+//       net that does not start in a pin-swap zone, in iterations that use the
+//       user-defined cost multipliers.
+//       Cells in pin-swap zones are not reachable from any landmark. The
+//       bounds are stored as 16-bit values in one plane per layer, in which
+//       the values of all landmarks for a cell are adjacent. The memory must
+//       later be freed by function freeLandmarks().
+//-----------------------------------------------------------------------------
+void createLandmarks(Landmarks_t *landmarks, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                     const InputValues_t *user_inputs)  {
+
+  time_t tim = time(NULL);
+  struct tm *now = localtime(&tim);
+  printf("\nDate-stamp before creating landmarks: %02d-%02d-%d, %02d:%02d:%02d *************************\n",
+         now->tm_mon+1, now->tm_mday, now->tm_year+1900, now->tm_hour, now->tm_min, now->tm_sec);
+
+  landmarks->coord = malloc(user_inputs->landmarksPerLayer * mapInfo->numLayers * sizeof(Coordinate_t));
+  const int maxCandidates = 4 + 2 * mapInfo->numPaths;
+  Coordinate_t *candidate = malloc(maxCandidates * sizeof(Coordinate_t));
+  if ((landmarks->coord == NULL) || (candidate == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the landmark coordinates in function 'createLandmarks'.\n\n");
+    exit(1);
+  }
+
+  //
+  // On each layer, collect the candidate landmarks, i.e., the walkable cells nearest to the
+  // four corners of the map and the nets' terminals on the layer, outside of pin-swap zones. Starting from the corner
+  // at (0,0), repeatedly select the candidate that is farthest from the landmarks that were
+  // already selected on the layer:
+  //
+  landmarks->numLandmarks = 0;
+  for (int z = 0; z < mapInfo->numLayers; z++)  {
+    int numCandidates = 0;
+    const int cornerX[4] = {0, mapInfo->mapWidth - 1, 0,                      mapInfo->mapWidth - 1 };
+    const int cornerY[4] = {0, 0,                     mapInfo->mapHeight - 1, mapInfo->mapHeight - 1};
+    for (int corner = 0; corner < 4; corner++)  {
+      if (findWalkableCellNearest(&(candidate[numCandidates]), mapInfo, cellInfo, cornerX[corner], cornerY[corner], z))  {
+        numCandidates++;
+      }
+    }
+    for (int pathNum = 0; pathNum < mapInfo->numPaths; pathNum++)  {
+      const Coordinate_t terminal[2] = {mapInfo->start_cells[pathNum], mapInfo->end_cells[pathNum]};
+      for (int i = 0; i < 2; i++)  {
+        if (   (terminal[i].Z == z) && (! cellInfo[terminal[i].X][terminal[i].Y][z].forbiddenTraceBarrier)
+            && (! cellInfo[terminal[i].X][terminal[i].Y][z].swap_zone))  {
+          candidate[numCandidates++] = terminal[i];
+        }
+      }  // End of for-loop for index 'i'
+    }  // End of for-loop for index 'pathNum'
+
+    const int firstLandmarkOnLayer = landmarks->numLandmarks;
+    for (int i = 0; i < user_inputs->landmarksPerLayer; i++)  {
+      int  farthestCandidate = -1;
+      long farthestDistanceSquared = 0;
+      for (int j = 0; j < numCandidates; j++)  {
+        long minDistanceSquared = LONG_MAX;
+        for (int k = firstLandmarkOnLayer; k < landmarks->numLandmarks; k++)  {
+          long deltaX = candidate[j].X - landmarks->coord[k].X;
+          long deltaY = candidate[j].Y - landmarks->coord[k].Y;
+          minDistanceSquared = min(minDistanceSquared, deltaX * deltaX + deltaY * deltaY);
+        }
+        if (minDistanceSquared > farthestDistanceSquared)  {
+          farthestDistanceSquared = minDistanceSquared;
+          farthestCandidate = j;
+        }
+      }  // End of for-loop for index 'j'
+
+      // Stop if every candidate has already been selected as a landmark:
+      if (farthestCandidate < 0)  {
+        break;
+      }
+      landmarks->coord[landmarks->numLandmarks] = candidate[farthestCandidate];
+      landmarks->numLandmarks++;
+    }  // End of for-loop for index 'i'
+  }  // End of for-loop for index 'z'
+
+  free(candidate);  candidate = NULL;
+
+  //
+  // Allocate the distance fields, and calculate the distances from each landmark in parallel.
+  // Each thread allocates its own work-space for Dijkstra's algorithm:
+  //
+  const long numCells = (long)mapInfo->mapWidth * mapInfo->mapHeight * mapInfo->numLayers;
+  landmarks->quantum  = malloc(landmarks->numLandmarks * sizeof(unsigned long));
+  landmarks->distance = malloc(numCells * landmarks->numLandmarks * sizeof(unsigned short));
+  if ((landmarks->quantum == NULL) || (landmarks->distance == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the distance fields of %d landmarks in function 'createLandmarks'.\n\n",
+           landmarks->numLandmarks);
+    exit(1);
+  }
+
+  // Calculate the user-defined costs for each cost-multiplier index:
+  LandmarkCosts_t costs;
+  for (int cost_index = 0; cost_index < maxTraceCostMultipliers; cost_index++)  {
+    int multiplier = (cost_index == 0) ? 1 : user_inputs->traceCostMultiplier[cost_index];
+    costs.cellCost[cost_index]   = user_inputs->baseCellCost   * multiplier;
+    costs.diagCost[cost_index]   = user_inputs->baseDiagCost   * multiplier;
+    costs.knightCost[cost_index] = user_inputs->baseKnightCost * multiplier;
+  }
+  for (int cost_index = 0; cost_index < maxViaCostMultipliers; cost_index++)  {
+    costs.vertCost[cost_index] = user_inputs->baseVertCost * user_inputs->viaCostMultiplier[cost_index];
+  }
+
+  #pragma omp parallel
+  {
+    unsigned long *cellDistance = malloc(numCells * sizeof(unsigned long));
+    int *heapCell               = malloc(numCells * sizeof(int));
+    int *heapPosition           = malloc(numCells * sizeof(int));
+    if ((cellDistance == NULL) || (heapCell == NULL) || (heapPosition == NULL))  {
+      printf("\n\nERROR: Failed to allocate memory for the work-space arrays in function 'createLandmarks'.\n\n");
+      exit(1);
+    }
+
+    #pragma omp for schedule(dynamic, 1)
+    for (int landmarkNum = 0; landmarkNum < landmarks->numLandmarks; landmarkNum++)  {
+      calcLandmarkDistances(landmarks, landmarkNum, mapInfo, cellInfo, &costs, cellDistance, heapCell, heapPosition);
+    }
+
+    free(cellDistance);  cellDistance = NULL;
+    free(heapCell);      heapCell     = NULL;
+    free(heapPosition);  heapPosition = NULL;
+  }  // End of parallel block
+
+  printf("INFO: Created %d landmarks for the landmark heuristic, using %'.1f MB for their distance fields.\n",
+         landmarks->numLandmarks, numCells * landmarks->numLandmarks * sizeof(unsigned short) / 1.0E6);
+
+  tim = time(NULL);
+  now = localtime(&tim);
+  printf("Date-stamp after creating landmarks: %02d-%02d-%d, %02d:%02d:%02d *************************\n",
+         now->tm_mon+1, now->tm_mday, now->tm_year+1900, now->tm_hour, now->tm_min, now->tm_sec);
+
+}  // End of function 'createLandmarks'
+
+
+//-----------------------------------------------------------------------------
+// Name: calc_landmark_heuristic
+// Desc: Return a lower bound of the G-cost between cell (x,y,z) and the target
+//       cell (targetX, targetY, targetZ), based on the triangle inequality
+//       for the distances from each landmark to the two cells. Returns zero if
+//       no landmark can reach both cells. The bound is not valid for nets that
+//       start in a pin-swap zone, because such nets can route cheaply through
+//       their pin-swap zone.
+//-----------------------------------------------------------------------------
+unsigned long calc_landmark_heuristic(const Landmarks_t *landmarks, const MapInfo_t *mapInfo,
+                                      const int x, const int y, const int z,
+                                      const int targetX, const int targetY, const int targetZ)  {
+
+  const int numLandmarks = landmarks->numLandmarks;
+  const unsigned short *cellDistance   = &(landmarks->distance[landmarkCellIndex(mapInfo, x, y, z) * numLandmarks]);
+  const unsigned short *targetDistance = &(landmarks->distance[landmarkCellIndex(mapInfo, targetX, targetY, targetZ) * numLandmarks]);
+
+  unsigned long H_value = 0;
+  for (int i = 0; i < numLandmarks; i++)  {
+    if ((cellDistance[i] == landmarkUnreachable) || (targetDistance[i] == landmarkUnreachable))  {
+      continue;
+    }
+
+    // Each stored distance was rounded down by less than one quantum, so the difference
+    // between the two distances is reduced by one quantum to remain a lower bound:
+    int quantizedDifference = abs((int)cellDistance[i] - (int)targetDistance[i]) - 1;
+    if (quantizedDifference > 0)  {
+      H_value = max(H_value, quantizedDifference * landmarks->quantum[i]);
+    }
+  }  // End of for-loop for index 'i'
+
+  return(H_value);
+
+}  // End of function 'calc_landmark_heuristic'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeLandmarks
+// Desc: Free the memory allocated by function createLandmarks().
+//-----------------------------------------------------------------------------
+void freeLandmarks(Landmarks_t *landmarks)  {
+
+  free(landmarks->coord);     landmarks->coord    = NULL;
+  free(landmarks->quantum);   landmarks->quantum  = NULL;
+  free(landmarks->distance);  landmarks->distance = NULL;
+  landmarks->numLandmarks = 0;
+
+}  // End of function 'freeLandmarks'
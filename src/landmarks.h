@@ -0,0 +1,49 @@
+#ifndef LANDMARKS_H
+
+#define LANDMARKS_H
+
+
+//-----------------------------------------------------------------------------
+// Name: createLandmarks
+// Desc: Select 'user_inputs->landmarksPerLayer' landmarks on each routing
+//       layer, and calculate the lower bound of the G-cost between each
+//       landmark and every cell in the map. The landmarks are selected from
+//       the walkable cells nearest the map's corners and from the nets'
+//       terminals, such that the landmarks on each layer are far apart. The
+//       lower bounds are the shortest-path costs through the map, using the
+//       trace- and via-costs of each cell, including the user-defined cost
+//       multipliers, without any congestion. Only the user-defined barriers
+//       and via blockages restrict the moves, so the bounds are valid for every
+//       net that does not start in a pin-swap zone, in iterations that use the
+//       user-defined cost multipliers.
+//       Cells in pin-swap zones are not reachable from any landmark. The
+//       bounds are stored as 16-bit values in one plane per layer, in which
+//       the values of all landmarks for a cell are adjacent. The memory must
+//       later be freed by function freeLandmarks().
+//-----------------------------------------------------------------------------
+void createLandmarks(Landmarks_t *landmarks, const MapInfo_t *mapInfo, CellInfo_t ***cellInfo,
+                     const InputValues_t *user_inputs);
+
+
+//-----------------------------------------------------------------------------
+// Name: calc_landmark_heuristic
+// Desc: Return a lower bound of the G-cost between cell (x,y,z) and the target
+//       cell (targetX, targetY, targetZ), based on the triangle inequality
+//       for the distances from each landmark to the two cells. Returns zero if
+//       no landmark can reach both cells. The bound is not valid for nets that
+//       start in a pin-swap zone, because such nets can route cheaply through
+//       their pin-swap zone.
+//-----------------------------------------------------------------------------
+unsigned long calc_landmark_heuristic(const Landmarks_t *landmarks, const MapInfo_t *mapInfo,
+                                      const int x, const int y, const int z,
+                                      const int targetX, const int targetY, const int targetZ);
+
+
+//-----------------------------------------------------------------------------
+// Name: freeLandmarks
+// Desc: Free the memory allocated by function createLandmarks().
+//-----------------------------------------------------------------------------
+void freeLandmarks(Landmarks_t *landmarks);
+
+
+#endif
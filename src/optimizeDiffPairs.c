@@ -1,6 +1,7 @@
 #include "global_defs.h"
 #include "processDiffPairs.h"
 #include "aStarLibrary.h"
+#include "cellArraySlabs.h"
 
 
 
@@ -390,20 +391,20 @@ static void swap_PN_congestion(int pseudoPathNum, int path_1_num, int path_2_num
         // congestion elements at (x,y,z) and swap the congestion between the two diff-pair paths:
         for (int path_index = 0; path_index < cellInfo[x][y][z].numTraversingPaths; path_index++)  {
 
-          int congestion_path_number = cellInfo[x][y][z].congestion[path_index].pathNum;
+          int congestion_path_number = cellCongestion(&(cellInfo[x][y][z]))[path_index].pathNum;
 
           // Compare the path number of the congestion to the path number of diff-pair #1.
           // If they're equal, then re-assign the congestion path number to that of
           // diff-pair path #2:
           if (congestion_path_number == path_1_num)  {
-            cellInfo[x][y][z].congestion[path_index].pathNum = path_2_num;
+            cellCongestion(&(cellInfo[x][y][z]))[path_index].pathNum = path_2_num;
           }  // End of if-block for congestion matching path_1_num
 
           // Compare the path number of the congestion to the path number of diff-pair #2.
           // If they're equal, then re-assign the congestion path number to that of
           // diff-pair path #1:
           if (congestion_path_number == path_2_num)  {
-            cellInfo[x][y][z].congestion[path_index].pathNum = path_1_num;
+            cellCongestion(&(cellInfo[x][y][z]))[path_index].pathNum = path_1_num;
           }  // End of if-block for congestion matching path_2_num
 
         }  // End of for-loop for index 'path_index'
@@ -494,18 +495,18 @@ static int getTraceCongestionAtConnectionTerminal(int pathNum, int partnerPathNu
 
           // Recognize only the congestion with the same design-rule subset as the diff-pairs'
           // subset, and only with shape-type 'TRACE', excluding VIA_UP and VIA_DOWN congestion:
-          if (   (cellInfo[x][y][centerZ].congestion[path_index].shapeType == TRACE)
-              && (cellInfo[x][y][centerZ].congestion[path_index].DR_subset == center_DR_subset_mapped_to_point))  {
+          if (   (cellCongestion(&(cellInfo[x][y][centerZ]))[path_index].shapeType == TRACE)
+              && (cellCongestion(&(cellInfo[x][y][centerZ]))[path_index].DR_subset == center_DR_subset_mapped_to_point))  {
 
             // Get the path number of the congestion for the current path index:
-            int congestion_pathNum   = cellInfo[x][y][centerZ].congestion[path_index].pathNum;
+            int congestion_pathNum   = cellCongestion(&(cellInfo[x][y][centerZ]))[path_index].pathNum;
 
             // Add the 'congestion' (pathTraversalsTimes100) to the appropriate summation variables:
             if (congestion_pathNum == pathNum)  {
-              *pathTraversalsTimes100_path += cellInfo[x][y][centerZ].congestion[path_index].pathTraversalsTimes100;
+              *pathTraversalsTimes100_path += cellCongestion(&(cellInfo[x][y][centerZ]))[path_index].pathTraversalsTimes100;
             }
             else if (congestion_pathNum == partnerPathNum)  {
-              *pathTraversalsTimes100_partner += cellInfo[x][y][centerZ].congestion[path_index].pathTraversalsTimes100;
+              *pathTraversalsTimes100_partner += cellCongestion(&(cellInfo[x][y][centerZ]))[path_index].pathTraversalsTimes100;
             }
           }  // End of if-block for shapeType == TRACE
         }  // End of for-loop for index 'path_index'
@@ -1207,6 +1208,7 @@ static void populate_subMapInfo(MapInfo_t *subMapInfo, const ShoulderConnection_
   // subMapInfo variable:
   subMapInfo->numPaths = mapInfo->numPaths;
   subMapInfo->numPseudoPaths = mapInfo->numPseudoPaths;
+  subMapInfo->cellInfoLayout = mapInfo->cellInfoLayout;
 
   // Initialize the iteration count to zero; it will be incremented prior to each
   // call to findPath():
@@ -1227,6 +1229,22 @@ static void populate_subMapInfo(MapInfo_t *subMapInfo, const ShoulderConnection_
   // this multiplier will remain constant through the small number of iterations:
   subMapInfo->iterationDependentRatio = 1.00;
 
+  // The sub-map's congestion changes between calls to findPath(), so it has no
+  // per-cell congestion summaries:
+  subMapInfo->congestionSummary = NULL;
+
+  // The landmarks' distance fields describe the main map, so they cannot be
+  // used in the sub-map:
+  subMapInfo->landmarks = NULL;
+
+  // The sub-map's barriers differ between its wiring configurations, so findPath()
+  // reads the static routing attributes from each configuration's 'cellInfo' matrix:
+  subMapInfo->cellRoutingInfo = NULL;
+
+  // The design-rule-check results of the main map cannot be re-used in the sub-map,
+  // so every cell of the sub-map is checked:
+  subMapInfo->incrementalDRC = NULL;
+
   subMapInfo->max_iterations = subMap_maxIterations;
 
   // Allocate memory from the heap for arrays in the new 'subMapInfo' variable:
@@ -1267,7 +1285,11 @@ static void populate_subMapInfo(MapInfo_t *subMapInfo, const ShoulderConnection_
 //       from path numbers excludePath_1 and excludePath_2 is NOT copied over
 //       to the subMap_cellInfo matrix. But wherever these two paths were
 //       routed, the map is populated with 'forbidden' cells that are
-//       off-limits for routing.
+//       off-limits for routing. A sub-map cell whose congestion or
+//       path-center array would be an exact copy of the main map's array
+//       shares that array instead, which is flagged in the sub-map cell.
+//       The main map's congestion and path-centers must therefore not be
+//       modified before the sub-map is freed.
 //-----------------------------------------------------------------------------
 //
 // Define 'DEBUG_copyCellInfo' and re-compile if you want verbose debugging
@@ -1362,57 +1384,59 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
 
 
         //
-        // Iterate over the paths that traverse the larger 'cellInfo' map at (x,y,z). If the path number
-        // is not equal to excludePath_1 or excludePath_2, then copy the path's congestion to the sub-map
-        // matrix at (i,j,k):
+        // Count the congestion elements at (x,y,z) of the larger 'cellInfo' map that belong to
+        // excludePath_1 or excludePath_2. If there are none, then the sub-map cell shares the
+        // main map's 'congestion' array instead of copying it. This is safe because the main
+        // map's congestion is not modified while the sub-map exists, and because the sub-map
+        // calls unshareCongestion() before it modifies a shared array:
         //
-        subMap_cellInfo[i][j][k].numTraversingPaths = 0;
+        int numKeptPaths = 0;
         for (int pathIndex = 0; pathIndex < cellInfo[x][y][z].numTraversingPaths; pathIndex++)  {
+          if (   (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum != excludePath_1)
+              && (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum != excludePath_2))  {
+            numKeptPaths++;
+          }
+        }  // End of for-loop for index 'pathIndex'
+
+        subMap_cellInfo[i][j][k].numTraversingPaths = 0;
+        if (numKeptPaths == cellInfo[x][y][z].numTraversingPaths)  {
+          subMap_cellInfo[i][j][k].congestionHandle   = cellInfo[x][y][z].congestionHandle;
+          subMap_cellInfo[i][j][k].numTraversingPaths = numKeptPaths;
+          subMap_cellInfo[i][j][k].congestionIsShared = (numKeptPaths > 0);
+        }
+        else if (numKeptPaths > 0)  {
+          // Allocate memory for all the elements of the 'congestion' array in the sub-map:
+          subMap_cellInfo[i][j][k].congestionHandle = allocateCongestion(numKeptPaths);
+        }  // End of if/else-block for sharing or allocating the 'congestion' array
+
+        //
+        // If the congestion array is not shared, then iterate over the paths that traverse the larger
+        // 'cellInfo' map at (x,y,z). If the path number is not equal to excludePath_1 or excludePath_2,
+        // then copy the path's congestion to the sub-map matrix at (i,j,k):
+        //
+        for (int pathIndex = 0;    (pathIndex < cellInfo[x][y][z].numTraversingPaths)
+                                && (numKeptPaths < cellInfo[x][y][z].numTraversingPaths); pathIndex++)  {
 
           // Check whether the path-number of the traversing path is one of the two
           // diff-pair paths that should *not* be copied:
-          if (   (cellInfo[x][y][z].congestion[pathIndex].pathNum != excludePath_1)
-              && (cellInfo[x][y][z].congestion[pathIndex].pathNum != excludePath_2))  {
-
-            // Allocate memory for the additional element in the 'congestion' array :
-            if (subMap_cellInfo[i][j][k].numTraversingPaths == 0)  {
-
-              // Allocate memory for the first element in the 'congestion' array in the sub-map:
-              subMap_cellInfo[i][j][k].congestion = malloc(sizeof(Congestion_t));
-              if (subMap_cellInfo[i][j][k].congestion == 0)  {
-                printf("\n\nERROR: Failed to allocate memory for congestion in 'subMap_cellInfo' matrix at location (%d,%d,%d) in function 'copyCellInfo.\n",
-                       i, j, k);
-                printf(    "       Please inform the software developer of this fatal error message.\n\n");
-                exit(1);
-              }  // End of if-block
-            }
-            else  {
-              // Re-allocate memory to grow the 'congestion' array in the sub-map:
-              subMap_cellInfo[i][j][k].congestion = realloc(subMap_cellInfo[i][j][k].congestion,
-                                                   (subMap_cellInfo[i][j][k].numTraversingPaths + 1) * sizeof(Congestion_t));
-              if (subMap_cellInfo[i][j][k].congestion == 0)  {
-                printf("\n\nERROR: Failed to re-allocate memory for congestion in 'subMap_cellInfo' matrix at location (%d,%d,%d) in function 'copyCellInfo.\n",
-                       i, j, k);
-                printf(    "       Please inform the software developer of this fatal error message.\n\n");
-                exit(1);
-              }  // End of if-block
-            }  // End of if/else block for allocating memory for additional 'congestion' array element
+          if (   (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum != excludePath_1)
+              && (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum != excludePath_2))  {
 
             //
             // Copy 'congestion' elements from congestion-index 'pathIndex' of the main cellInfo 3D
             // matrix to congestion-index 'subMap_cellInfo[i][j][k].numTraversingPaths' of the sub-map:
             //
-            subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].pathNum
-                   = cellInfo[x][y][z].congestion[pathIndex].pathNum;
+            cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].pathNum
+                   = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum;
 
-            subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].DR_subset
-                   = cellInfo[x][y][z].congestion[pathIndex].DR_subset;
+            cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].DR_subset
+                   = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].DR_subset;
 
-            subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].shapeType
-                   = cellInfo[x][y][z].congestion[pathIndex].shapeType;
+            cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].shapeType
+                   = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].shapeType;
 
-            subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].pathTraversalsTimes100
-                   = cellInfo[x][y][z].congestion[pathIndex].pathTraversalsTimes100;
+            cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].pathTraversalsTimes100
+                   = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathTraversalsTimes100;
 
             #ifdef DEBUG_copyCellInfo
             if (DEBUG_ON)  {
@@ -1421,13 +1445,13 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
               printf(  "DEBUG: (thread %2d)     Destination: (%d,%d,%d), index %d of sub-map\n", omp_get_thread_num(), i, j, k,
                      subMap_cellInfo[i][j][k].numTraversingPaths);
               printf(  "DEBUG: (thread %2d)                     congestion[%d].pathNum: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPaths,
-                     subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].pathNum);
+                     cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].pathNum);
               printf(  "DEBUG: (thread %2d)      congestion[%d].pathTraversalsTimes100: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPaths,
-                     subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].pathTraversalsTimes100);
+                     cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].pathTraversalsTimes100);
               printf(  "DEBUG: (thread %2d)                   congestion[%d].DR_subset: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPaths,
-                     subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].DR_subset);
+                     cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].DR_subset);
               printf(  "DEBUG: (thread %2d)                   congestion[%d].shapeType: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPaths,
-                     subMap_cellInfo[i][j][k].congestion[subMap_cellInfo[i][j][k].numTraversingPaths].shapeType);
+                     cellCongestion(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPaths].shapeType);
             }
             #endif
 
@@ -1442,13 +1466,13 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
               printf(  "DEBUG: (thread %2d)          Source: (%d,%d,%d), index %d of main map\n", omp_get_thread_num(), x, y, z, pathIndex);
               printf(  "DEBUG: (thread %2d)     Destination: (%d,%d,%d) of sub-map\n", omp_get_thread_num(), i, j, k);
               printf(  "DEBUG: (thread %2d)                     congestion[%d].pathNum: %d\n", omp_get_thread_num(), pathIndex,
-                     cellInfo[x][y][z].congestion[pathIndex].pathNum);
+                     cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum);
               printf(  "DEBUG: (thread %2d)      congestion[%d].pathTraversalsTimes100: %d\n", omp_get_thread_num(), pathIndex,
-                     cellInfo[x][y][z].congestion[pathIndex].pathTraversalsTimes100);
+                     cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathTraversalsTimes100);
               printf(  "DEBUG: (thread %2d)                   congestion[%d].DR_subset: %d\n", omp_get_thread_num(), pathIndex,
-                     cellInfo[x][y][z].congestion[pathIndex].DR_subset);
+                     cellCongestion(&(cellInfo[x][y][z]))[pathIndex].DR_subset);
               printf(  "DEBUG: (thread %2d)                   congestion[%d].shapeType: %d\n", omp_get_thread_num(), pathIndex,
-                     cellInfo[x][y][z].congestion[pathIndex].shapeType);
+                     cellCongestion(&(cellInfo[x][y][z]))[pathIndex].shapeType);
             }
           }  // End of else-block for path number being one of the two excluded paths
           #endif
@@ -1456,19 +1480,39 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
         }  // End of for-loop for index 'pathIndex' (0 to numTraversingPaths)
 
         //
-        // Iterate over the path-centers that traverse the larger 'cellInfo' map at (x,y,z). If the path number
-        // is not equal to excludePath_1 or excludePath_2, then copy it to the sub-map matrix at (i,j,k):
+        // Share the main map's 'pathCenters' array in the same way as the 'congestion' array if
+        // none of its path-centers belong to excludePath_1 or excludePath_2:
         //
-        subMap_cellInfo[i][j][k].numTraversingPathCenters = 0;
+        int numKeptPathCenters = 0;
         for (int pathCenterIndex = 0; pathCenterIndex < cellInfo[x][y][z].numTraversingPathCenters; pathCenterIndex++)  {
+          if (   (cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum != excludePath_1)
+              && (cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum != excludePath_2))  {
+            numKeptPathCenters++;
+          }
+        }  // End of for-loop for index 'pathCenterIndex'
+
+        subMap_cellInfo[i][j][k].numTraversingPathCenters = 0;
+        if (numKeptPathCenters == cellInfo[x][y][z].numTraversingPathCenters)  {
+          subMap_cellInfo[i][j][k].pathCentersHandle        = cellInfo[x][y][z].pathCentersHandle;
+          subMap_cellInfo[i][j][k].numTraversingPathCenters = numKeptPathCenters;
+          subMap_cellInfo[i][j][k].pathCentersAreShared     = (numKeptPathCenters > 0);
+        }
+
+        //
+        // If the path-centers array is not shared, then iterate over the path-centers that traverse the
+        // larger 'cellInfo' map at (x,y,z). If the path number is not equal to excludePath_1 or
+        // excludePath_2, then copy it to the sub-map matrix at (i,j,k):
+        //
+        for (int pathCenterIndex = 0;    (pathCenterIndex < cellInfo[x][y][z].numTraversingPathCenters)
+                                      && (numKeptPathCenters < cellInfo[x][y][z].numTraversingPathCenters); pathCenterIndex++)  {
 
           // Check whether the path-number of the traversing path-center is one of the two
           // diff-pair paths that should *not* be copied:
-          if (   (cellInfo[x][y][z].pathCenters[pathCenterIndex].pathNum != excludePath_1)
-              && (cellInfo[x][y][z].pathCenters[pathCenterIndex].pathNum != excludePath_2))  {
+          if (   (cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum != excludePath_1)
+              && (cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum != excludePath_2))  {
 
-            add_path_center_info(&(subMap_cellInfo[i][j][k]), cellInfo[x][y][z].pathCenters[pathCenterIndex].pathNum,
-                                 cellInfo[x][y][z].pathCenters[pathCenterIndex].shapeType);
+            add_path_center_info(&(subMap_cellInfo[i][j][k]), cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum,
+                                 cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].shapeType);
 
             #ifdef DEBUG_copyCellInfo
             if (DEBUG_ON)  {
@@ -1477,9 +1521,9 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
               printf(  "DEBUG: (thread %2d)     Destination: (%d,%d,%d), index %d of sub-map\n", omp_get_thread_num(), i, j, k,
                      subMap_cellInfo[i][j][k].numTraversingPathCenters - 1);
               printf(  "DEBUG: (thread %2d)             pathCenters[%d].pathNum: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPathCenters,
-                     subMap_cellInfo[i][j][k].pathCenters[subMap_cellInfo[i][j][k].numTraversingPathCenters - 1].pathNum);
+                     cellPathCenters(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPathCenters - 1].pathNum);
               printf(  "DEBUG: (thread %2d)           pathCenters[%d].shapeType: %d\n", omp_get_thread_num(), subMap_cellInfo[i][j][k].numTraversingPathCenters,
-                     subMap_cellInfo[i][j][k].pathCenters[subMap_cellInfo[i][j][k].numTraversingPathCenters - 1].shapeType);
+                     cellPathCenters(&(subMap_cellInfo[i][j][k]))[subMap_cellInfo[i][j][k].numTraversingPathCenters - 1].shapeType);
             }
             #endif
 
@@ -1492,9 +1536,9 @@ static void copyCellInfo(CellInfo_t ***cellInfo, CellInfo_t ***subMap_cellInfo,
               printf(  "DEBUG: (thread %2d)          Source: (%d,%d,%d), index %d of main map\n", omp_get_thread_num(), x, y, z, pathCenterIndex);
               printf(  "DEBUG: (thread %2d)     Destination: (%d,%d,%d) of sub-map\n", omp_get_thread_num(), i, j, k);
               printf(  "DEBUG: (thread %2d)                     pathCenters[%d].pathNum: %d\n", omp_get_thread_num(), pathCenterIndex,
-                     cellInfo[x][y][z].pathCenters[pathCenterIndex].pathNum);
+                     cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].pathNum);
               printf(  "DEBUG: (thread %2d)                   pathCenters[%d].shapeType: %d\n", omp_get_thread_num(), pathCenterIndex,
-                     cellInfo[x][y][z].pathCenters[pathCenterIndex].shapeType);
+                     cellPathCenters(&(cellInfo[x][y][z]))[pathCenterIndex].shapeType);
             }
           }  // End of else-block for path-center number being one of the two excluded paths
           #endif
@@ -1580,11 +1624,14 @@ static void evaporateDiffPairCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellIn
         while (pathIndex < cellInfo[x][y][z].numTraversingPaths)  {
 
           // Check if the congestion is from pathNum_1 or pathNum_2:
-          if (   (cellInfo[x][y][z].congestion[pathIndex].pathNum == pathNum_1)
-              || (cellInfo[x][y][z].congestion[pathIndex].pathNum == pathNum_2))  {
+          if (   (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum == pathNum_1)
+              || (cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathNum == pathNum_2))  {
+
+            // The congestion array is about to be modified, so it must not be shared with another map:
+            unshareCongestion(&(cellInfo[x][y][z]));
 
             // Get current congestion, i.e., number of path-traversals multiplied by 100:
-            original_congestion = cellInfo[x][y][z].congestion[pathIndex].pathTraversalsTimes100;
+            original_congestion = cellCongestion(&(cellInfo[x][y][z]))[pathIndex].pathTraversalsTimes100;
 
             // Calculate new congestion for this cell by multiplying the current
             // congestion by 'retainFactor', and truncating to the next lowest integer:
@@ -1607,10 +1654,10 @@ static void evaporateDiffPairCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellIn
               for (int oldPathIndex = pathIndex + 1; oldPathIndex < cellInfo[x][y][z].numTraversingPaths; oldPathIndex++)  {
 
                 // Assign path number, DR_subset, shape type, and congestion to (oldPathIndex - 1):
-                cellInfo[x][y][z].congestion[oldPathIndex - 1].pathNum                = cellInfo[x][y][z].congestion[oldPathIndex].pathNum;
-                cellInfo[x][y][z].congestion[oldPathIndex - 1].DR_subset              = cellInfo[x][y][z].congestion[oldPathIndex].DR_subset;
-                cellInfo[x][y][z].congestion[oldPathIndex - 1].shapeType              = cellInfo[x][y][z].congestion[oldPathIndex].shapeType;
-                cellInfo[x][y][z].congestion[oldPathIndex - 1].pathTraversalsTimes100 = cellInfo[x][y][z].congestion[oldPathIndex].pathTraversalsTimes100;
+                cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex - 1].pathNum                = cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex].pathNum;
+                cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex - 1].DR_subset              = cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex].DR_subset;
+                cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex - 1].shapeType              = cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex].shapeType;
+                cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex - 1].pathTraversalsTimes100 = cellCongestion(&(cellInfo[x][y][z]))[oldPathIndex].pathTraversalsTimes100;
 
               }  // End of for-loop for index 'oldPathIndex'
 
@@ -1635,17 +1682,8 @@ static void evaporateDiffPairCongestion(MapInfo_t *mapInfo, CellInfo_t ***cellIn
         // for 'cellInfo[x][y][z].congestion' array so the array requires fewer elements:
         if (cellInfo[x][y][z].numTraversingPaths != origNumTraversingPaths)  {
           num_cells_resized++;
-          if (cellInfo[x][y][z].numTraversingPaths)  {
-            cellInfo[x][y][z].congestion = realloc(cellInfo[x][y][z].congestion,
-                                                   cellInfo[x][y][z].numTraversingPaths * sizeof(Congestion_t));
-          }  // End of if-block for having non-zero number of elements in congestion[] array
-          else  {
-            // There is no longer any congestion at (x,y,z), so free the
-            // memory in the 1-dimensional 'congestion' matrix for this
-            // (x,y,z) location:
-            free(cellInfo[x][y][z].congestion);
-            cellInfo[x][y][z].congestion = NULL; // Set pointer to NULL as a precaution
-          }  // End of else-block for having zero elements in congestion[] array
+          cellInfo[x][y][z].congestionHandle = resizeCongestion(cellInfo[x][y][z].congestionHandle, origNumTraversingPaths,
+                                                                cellInfo[x][y][z].numTraversingPaths);
         }  // End of if-block for the (new) number of traversing paths being different (less than) the original
 
       }  // End of loop for index 'x'
@@ -2202,8 +2240,8 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
   while (pathIndex < cellInfo->numTraversingPaths)  {
 
     // Get the path number and shape-type of the congestion for the current path index:
-    int congestion_pathNum   = cellInfo->congestion[pathIndex].pathNum;
-    int congestion_shapeType = cellInfo->congestion[pathIndex].shapeType;
+    int congestion_pathNum   = cellCongestion(cellInfo)[pathIndex].pathNum;
+    int congestion_shapeType = cellCongestion(cellInfo)[pathIndex].shapeType;
 
     // If the congestion satisfies all of the following three criteria, then convert this congestion to
     // path 'pathNum' with the same shape-type and design-rule subset:
@@ -2212,9 +2250,9 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
     //   (c) the congestion amount is non-zero.
     if (   (congestion_pathNum == partnerPath)                            // Criterion (a) in above list
         && (congestion_shapeType == shapeType)                            // Criterion (b) in above list
-        && (cellInfo->congestion[pathIndex].pathTraversalsTimes100 > 0))  // Criterion (c) in above list
+        && (cellCongestion(cellInfo)[pathIndex].pathTraversalsTimes100 > 0))  // Criterion (c) in above list
     {
-      int congestion_DRsubset  = cellInfo->congestion[pathIndex].DR_subset;
+      int congestion_DRsubset  = cellCongestion(cellInfo)[pathIndex].DR_subset;
 
       // Check whether the cell already contains congestion with the same
       // shape-type and design-rule subset, but with path number 'pathNum':
@@ -2229,7 +2267,7 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
         // shape-type 'congestion_shapeType' and design-rule subset 'congestion_DRsubset'. We therefore
         // can simply convert the information at this pathIndex from path 'partnerPath' to
         // path 'pathNum':
-        cellInfo->congestion[pathIndex].pathNum = pathNum;
+        cellCongestion(cellInfo)[pathIndex].pathNum = pathNum;
 
       }  // End of if-block for found_path_index == -1
       else  {
@@ -2242,8 +2280,8 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
                found_path_index, pathNum, congestion_DRsubset, congestion_shapeType);
         #endif
 
-        unsigned int old_congestion = cellInfo->congestion[found_path_index].pathTraversalsTimes100;
-        unsigned int new_congestion = old_congestion + cellInfo->congestion[pathIndex].pathTraversalsTimes100;
+        unsigned int old_congestion = cellCongestion(cellInfo)[found_path_index].pathTraversalsTimes100;
+        unsigned int new_congestion = old_congestion + cellCongestion(cellInfo)[pathIndex].pathTraversalsTimes100;
         assignCongestionByPathIndex(cellInfo, found_path_index, new_congestion);
 
         // For the subsequent paths that traverse the cell, move the path number and its congestion 'down' by 1.
@@ -2252,10 +2290,10 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
         for (int oldPathIndex = pathIndex + 1; oldPathIndex < cellInfo->numTraversingPaths; oldPathIndex++)  {
 
           // Assign path number, DR_subset, shape type, and congestion to (oldPathIndex - 1):
-          cellInfo->congestion[oldPathIndex - 1].pathNum                = cellInfo->congestion[oldPathIndex].pathNum;
-          cellInfo->congestion[oldPathIndex - 1].DR_subset              = cellInfo->congestion[oldPathIndex].DR_subset;
-          cellInfo->congestion[oldPathIndex - 1].shapeType              = cellInfo->congestion[oldPathIndex].shapeType;
-          cellInfo->congestion[oldPathIndex - 1].pathTraversalsTimes100 = cellInfo->congestion[oldPathIndex].pathTraversalsTimes100;
+          cellCongestion(cellInfo)[oldPathIndex - 1].pathNum                = cellCongestion(cellInfo)[oldPathIndex].pathNum;
+          cellCongestion(cellInfo)[oldPathIndex - 1].DR_subset              = cellCongestion(cellInfo)[oldPathIndex].DR_subset;
+          cellCongestion(cellInfo)[oldPathIndex - 1].shapeType              = cellCongestion(cellInfo)[oldPathIndex].shapeType;
+          cellCongestion(cellInfo)[oldPathIndex - 1].pathTraversalsTimes100 = cellCongestion(cellInfo)[oldPathIndex].pathTraversalsTimes100;
 
         }  // End of for-loop for index 'oldPathIndex'
 
@@ -2278,17 +2316,7 @@ static void convertCongestionAtCell(int pathNum, int partnerPath, int shapeType,
   // If any paths' congestion was zero'd out, then re-size (or free) the array
   // for 'congestion->congestion' array so the array requires fewer elements:
   if (cellInfo->numTraversingPaths != origNumTraversingPaths)  {
-    if (cellInfo->numTraversingPaths)  {
-      cellInfo->congestion = realloc(cellInfo->congestion,
-                                             cellInfo->numTraversingPaths * sizeof(Congestion_t));
-
-    }  // End of if-block for having non-zero number of elements in congestion[] array
-    else  {
-      // There is no longer any congestion at the cell, so free the
-      // memory in the 1-dimensional 'congestion' matrix for this cell:
-      free(cellInfo->congestion);
-      cellInfo->congestion = NULL; // Set pointer to NULL as a precaution
-    }  // End of else-block for having zero elements in congestion[] array
+    cellInfo->congestionHandle = resizeCongestion(cellInfo->congestionHandle, origNumTraversingPaths, cellInfo->numTraversingPaths);
   }  // End of if-block for the (new) number of traversing paths being different (less than) the original
 
 }  // End of function 'convertCongestionAtCell'
@@ -2602,8 +2630,8 @@ static void convertCongestionAlongPath(int pathNum, int partnerPath, int pathLen
 
 void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[], CellInfo_t ***cellInfo,
                                  MapInfo_t *mapInfo, InputValues_t *user_inputs, RoutingMetrics_t *routability,
-                                 RoutingMetrics_t subMapRoutability[2], RoutingRestriction_t *noRoutingRestrictions,
-                                 int num_threads)  {
+                                 RoutingMetrics_t subMapRoutability[2], SubMapPool_t *subMapPool,
+                                 RoutingRestriction_t *noRoutingRestrictions, int num_threads)  {
 
   // Define the number of sub-iterations required to have the same 'swap' value for diff-pair
   // connections before this function stops running additional sub-iterations:
@@ -3004,7 +3032,7 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
 
           // For each of the 2 diff-pair paths, create pointers to the large arrays used by
           // the path-finding function, findPath().
-          PathFinding_t subMapPathFinding[2];
+          PathFinding_t *subMapPathFinding[2];
 
           //
           // Iterate over both wire-configurations to allocate/initialize memory for arrays
@@ -3061,9 +3089,9 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
             initializePathfinder(num_routed_nets, subMapPathLengths[wire_config], subMapPathCoords[wire_config],
                                  subMapContiguousPathLengths[wire_config], subMapContigPathCoords[wire_config]);
 
-            // For the current wire-configuration, allocate memory for the subMap_cellInfo 3D matrix
-            // that will be used during path-finding:
-            subMap_cellInfo[wire_config] = allocateCellInfo(&subMapInfo);
+            // For the current wire-configuration, get the subMap_cellInfo 3D matrix that will be
+            // used during path-finding. Its memory is re-used from previous connections:
+            subMap_cellInfo[wire_config] = allocatePooledCellInfo(subMapPool, wire_config, &subMapInfo);
 
             // For the current wire-configuratino, initialize to zero the elements of the sub-map
             // cellInfo 3D matrix before starting the iterative path-finding:
@@ -3107,11 +3135,13 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
 
           }  // End of for-loop for index 'wire_config'
 
-          // For each of the two diff-pair paths in the connection allocate memory for the large arrays
-          // used by the path-finding function, findPath(). These arrays get re-initialized within
-          // findPath() itself.
+          // For each of the two diff-pair paths in the connection, get the large arrays used by the
+          // path-finding function, findPath(). These arrays are re-used from previous connections,
+          // and get re-initialized within findPath() itself.
           for (int pathIndex = 0; pathIndex < 2; pathIndex++) {
-            allocatePathFindingArrays(&subMapPathFinding[pathIndex], &subMapInfo);
+            subMapPathFinding[pathIndex] = allocatePooledPathFindingArrays(subMapPool, pathIndex, &subMapInfo,
+                                                                           user_inputs->pathFindingLayout,
+                                                                           user_inputs->openListEngine);
           }
 
 
@@ -3409,6 +3439,7 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
                 RoutingRestriction_t connectionRouteRestrictions;
                 if (mapSizeMultiplier == 1)  {
                   connectionRouteRestrictions.restrictionFlag = TRUE;
+                  connectionRouteRestrictions.corridorFlag    = FALSE;
                   for (int layer = 0; layer < maxRoutingLayers; layer++)  {
                     connectionRouteRestrictions.allowedLayers[layer] = FALSE;
                     connectionRouteRestrictions.allowedRadiiMicrons[layer] = 0.0;
@@ -3543,8 +3574,8 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
                 Gcost[config][pathIndex] = findPath(&subMapInfo, subMap_cellInfo[config], pathNums[pathIndex], startCoord[pathIndex],
                                                     endCoord[config][pathIndex], &(subMapPathCoords[config][pathNums[pathIndex]]),
                                                     &subMapPathLengths[config][pathNums[pathIndex]], user_inputs,
-                                                    &(subMapRoutability[config]), &subMapPathFinding[pathIndex],
-                                                    0, FALSE, FALSE, &connectionRouteRestrictions, TRUE, FALSE);
+                                                    &(subMapRoutability[config]), subMapPathFinding[pathIndex],
+                                                    0, FALSE, FALSE, &connectionRouteRestrictions, TRUE, FALSE, NULL, 0);
 
 
                 #ifdef DEBUG_optimizeDiffPairConnections
@@ -3894,7 +3925,7 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
             //   if (subMap_cellInfo[14][24][0].numTraversingPaths >= 4)  {
             //
             //     printf("DEBUG: (thread %2d)     subMap_cellInfo[14][24][0].congestion[3].pathTraversalsTimes100 = %d\n", omp_get_thread_num(),
-            //            subMap_cellInfo[14][24][0].congestion[3].pathTraversalsTimes100);
+            //            cellCongestion(&(subMap_cellInfo[14][24][0]))[3].pathTraversalsTimes100);
             //   }
             // }
 
@@ -3961,8 +3992,9 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
             // Free memory used by 'pathCoords' and 'contigPathCoords' array of arrays:
             endPathfinder(num_routed_nets, subMapPathCoords[wire_config], subMapContigPathCoords[wire_config]);
 
-            // Free the memory that was allocated above for the subMap_cellInfo 3D matrix:
-            freeMemory_cellInfo(&subMapInfo, subMap_cellInfo[wire_config]);
+            // Return the subMap_cellInfo 3D matrix to the pool, freeing the congestion
+            // and path-centers that were allocated in its cells:
+            releasePooledCellInfo(&subMapInfo, subMap_cellInfo[wire_config]);
 
             // Free arrays for paths that were allocated within this block:
             free(subMapPathLengths[wire_config]);             subMapPathLengths[wire_config]           = NULL;
@@ -3973,12 +4005,6 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
           }  // End of for-loop for index 'wire_config'
 
 
-          // For each of the two diff-pair paths in the connection, free memory for the large arrays
-          // used by the path-finding function, findPath():
-          for (int pathIndex = 0; pathIndex < 2; pathIndex++) {
-            freePathFindingArrays(&subMapPathFinding[pathIndex], &subMapInfo);
-          }
-
           // Free memory from the heap for variable 'subMapInfo' that was allocated
           // earlier in this block:
           freeMemory_mapInfo(&subMapInfo);
@@ -4023,6 +4049,15 @@ void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[],
   // The above line represents the end of parallel processing
   //
 
+  // Report the memory of the sub-map pool, and the memory footprint of the process:
+  if (maxConnectionsPerPath)  {
+    int currRealMem = 0, peakRealMem = 0, currVirtMem = 0, peakVirtMem = 0;
+    getMemory(&currRealMem, &peakRealMem, &currVirtMem, &peakVirtMem);
+    printf("INFO: Diff-pair sub-maps use %lu kB of pooled memory. Process memory: %d kB resident (peak %d kB),\n",
+           getSubMapPoolMemory(subMapPool) / 1024, currRealMem, peakRealMem);
+    printf("      %d kB virtual (peak %d kB).\n\n", currVirtMem, peakVirtMem);
+  }
+
   //
   // Iterate over all pseudo-paths to find the optimal set of connections at each
   // trace-to-terminal and trace-to-via connection:
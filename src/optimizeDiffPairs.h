@@ -11,12 +11,13 @@
 //       diff-pair is P/N-swappable. This function modifies the pathCoords[][]
 //       array and the pathLengths[] array. For P/N-swappable diff-pairs, this
 //       function may also modify mapInfo->start_cells[] and
-//       mapInfo->diff_pair_terms_swapped[].
+//       mapInfo->diff_pair_terms_swapped[]. The sub-maps of the connections
+//       use the memory in 'subMapPool', which is kept between calls.
 //-----------------------------------------------------------------------------
 void optimizeDiffPairConnections(Coordinate_t *pathCoords[], int pathLengths[], CellInfo_t ***cellInfo,
                                  MapInfo_t *mapInfo, InputValues_t *user_inputs, RoutingMetrics_t *routability,
-                                 RoutingMetrics_t subMapRoutability[2], RoutingRestriction_t *noRoutingRestrictions,
-                                 int num_threads);
+                                 RoutingMetrics_t subMapRoutability[2], SubMapPool_t *subMapPool,
+                                 RoutingRestriction_t *noRoutingRestrictions, int num_threads);
 
 
 #endif
@@ -2576,6 +2576,15 @@ void parse_input_file(char *input_filename, InputValues_t *user_inputs, MapInfo_
   user_inputs->baseVertCostMicrons      = defaultVertCost;
   user_inputs->baseVertCost             = defaultVertCost;
   user_inputs->runsPerPngMap            = defaultRunsPerPngMap;
+  user_inputs->pathFindingLayout        = Z_INNERMOST_LAYOUT;
+  user_inputs->cellInfoLayout           = Z_INNERMOST_LAYOUT;
+  user_inputs->openListEngine           = BINARY_HEAP_ENGINE;
+  user_inputs->bidirectional_threshold  = 0;
+  user_inputs->rerouteCorridorRadiusMicrons = 0.0;
+  user_inputs->globalRoutingTileSize    = 0;
+  user_inputs->landmarksPerLayer        = 0;
+  user_inputs->rerouteCongestionTolerance = 0.0;
+  user_inputs->bidirectionalSearchThreads = 1;
   user_inputs->pinSwapCellCost          = defaultCellCost;
   user_inputs->baseCellCost             = (long)(defaultCellCost * pow(2.0, NON_PIN_SWAP_EXPONENT));
 
@@ -3314,6 +3323,121 @@ void parse_input_file(char *input_filename, InputValues_t *user_inputs, MapInfo_
       else if (strcasecmp(key, "runsPerPngMap") == 0) 
         user_inputs->runsPerPngMap = strtof(value, NULL);
  
+      // "bidirectional_threshold = ..."
+      else if (strcasecmp(key, "bidirectional_threshold") == 0)
+        user_inputs->bidirectional_threshold = strtoul(value, NULL, 10);
+
+      // "bidirectional_search_threads = ..."
+      else if (strcasecmp(key, "bidirectional_search_threads") == 0)  {
+        user_inputs->bidirectionalSearchThreads = strtol(value, NULL, 10);
+        if ((user_inputs->bidirectionalSearchThreads < 1) || (user_inputs->bidirectionalSearchThreads > 2))  {
+          printf("\n\nERROR: An illegal value was specified for a 'bidirectional_search_threads' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       The value must be 1 or 2. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'bidirectional_search_threads' token
+
+      // "openList_engine = ..."
+      else if (strcasecmp(key, "openList_engine") == 0)  {
+        if (strcasecmp(value, "BINARY_HEAP") == 0)  {
+          user_inputs->openListEngine = BINARY_HEAP_ENGINE;
+        }
+        else if (strcasecmp(value, "RADIX_HEAP") == 0)  {
+          user_inputs->openListEngine = RADIX_HEAP_ENGINE;
+        }
+        else  {
+          printf("\n\nERROR: An illegal value was specified for an 'openList_engine' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       Allowed values are BINARY_HEAP and RADIX_HEAP. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'openList_engine' token
+
+      // "pathFinding_layout = ..."
+      else if (strcasecmp(key, "pathFinding_layout") == 0)  {
+        if (strcasecmp(value, "Z_INNERMOST") == 0)  {
+          user_inputs->pathFindingLayout = Z_INNERMOST_LAYOUT;
+        }
+        else if (strcasecmp(value, "LAYER_MAJOR") == 0)  {
+          user_inputs->pathFindingLayout = LAYER_MAJOR_LAYOUT;
+        }
+        else  {
+          printf("\n\nERROR: An illegal value was specified for a 'pathFinding_layout' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       Allowed values are Z_INNERMOST and LAYER_MAJOR. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'pathFinding_layout' token
+
+      // "cellInfo_layout = ..."
+      else if (strcasecmp(key, "cellInfo_layout") == 0)  {
+        if (strcasecmp(value, "Z_INNERMOST") == 0)  {
+          user_inputs->cellInfoLayout = Z_INNERMOST_LAYOUT;
+        }
+        else if (strcasecmp(value, "TILED") == 0)  {
+          user_inputs->cellInfoLayout = TILED_LAYOUT;
+        }
+        else  {
+          printf("\n\nERROR: An illegal value was specified for a 'cellInfo_layout' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       Allowed values are Z_INNERMOST and TILED. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'cellInfo_layout' token
+
+      // "reroute_corridor_radius = ..." (in microns)
+      else if (strcasecmp(key, "reroute_corridor_radius") == 0)  {
+        user_inputs->rerouteCorridorRadiusMicrons = strtof(value, NULL);
+        if (user_inputs->rerouteCorridorRadiusMicrons < 0.0)  {
+          printf("\n\nERROR: A negative value was specified for a 'reroute_corridor_radius' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       The value must be zero or positive. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'reroute_corridor_radius' token
+
+      // "global_routing_tile_size = ..." (in cells)
+      else if (strcasecmp(key, "global_routing_tile_size") == 0)  {
+        user_inputs->globalRoutingTileSize = strtol(value, NULL, 10);
+        if (user_inputs->globalRoutingTileSize < 0)  {
+          printf("\n\nERROR: A negative value was specified for a 'global_routing_tile_size' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       The value must be zero or positive. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'global_routing_tile_size' token
+
+      // "landmarks_per_layer = ..."
+      else if (strcasecmp(key, "landmarks_per_layer") == 0)  {
+        user_inputs->landmarksPerLayer = strtol(value, NULL, 10);
+        if ((user_inputs->landmarksPerLayer < 0) || (user_inputs->landmarksPerLayer > maxLandmarksPerLayer))  {
+          printf("\n\nERROR: An illegal value was specified for a 'landmarks_per_layer' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       The value must be between 0 and %d. Please correct the input file\n", maxLandmarksPerLayer);
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'landmarks_per_layer' token
+
+      // "reroute_congestion_tolerance = ..."
+      else if (strcasecmp(key, "reroute_congestion_tolerance") == 0)  {
+        user_inputs->rerouteCongestionTolerance = strtof(value, NULL);
+        if (user_inputs->rerouteCongestionTolerance < 0.0)  {
+          printf("\n\nERROR: A negative value was specified for a 'reroute_congestion_tolerance' statement:\n\n");
+          printf(    "          %s = %s\n\n", key, value);
+          printf(    "       The value must be zero or positive. Please correct the input file\n");
+          printf(    "       and re-start the program.\n\n");
+          exit(1);
+        }
+      }  // End of if/else block for 'reroute_congestion_tolerance' token
+
       // "preEvaporationIterations = ..."
       else if (strcasecmp(key, "preEvaporationIterations") == 0)  {
         user_inputs->preEvaporationIterations = strtof(value, NULL);
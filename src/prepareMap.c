@@ -890,6 +890,191 @@ void defineProximityZones(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
 }  // End of function 'defineProximityZones'
 
 
+//
+// Define structure for the cells covered by the shape of one DR_zone, trace_cost_zone,
+// or via_cost_zone statement. The shape is stored as one span of Y-coordinates in each
+// column of the map: the cells of column 'x' are (x, minY[x]) through (x, maxY[x]),
+// inclusive, and the column contains no cells of the shape if minY[x] > maxY[x].
+// Columns outside of the range 'minX' to 'maxX' contain no cells of the shape.
+//
+typedef struct ZoneSpans_t  {
+  int minX;
+  int maxX;
+  int *minY;  // Array of 'mapWidth' elements
+  int *maxY;  // Array of 'mapWidth' elements
+} ZoneSpans_t;  // End of struct definition 'ZoneSpans_t'
+
+
+//-----------------------------------------------------------------------------
+// Name: allocateZoneSpans
+// Desc: Allocate the arrays of a ZoneSpans_t structure for a map with the
+//       width in 'mapInfo'. The memory must later be freed with function
+//       freeZoneSpans().
+//-----------------------------------------------------------------------------
+static void allocateZoneSpans(ZoneSpans_t *spans, const MapInfo_t *mapInfo)  {
+
+  spans->minY = malloc(mapInfo->mapWidth * sizeof(int));
+  spans->maxY = malloc(mapInfo->mapWidth * sizeof(int));
+  if ((spans->minY == NULL) || (spans->maxY == NULL))  {
+    printf("\n\nERROR: Failed to allocate memory for the column-spans of a zone in a map %d cells wide.\n",
+           mapInfo->mapWidth);
+    printf(    "       Please inform the software developer of this fatal error.\n\n");
+    exit(1);
+  }
+  spans->minX = 0;
+  spans->maxX = -1;
+
+}  // End of function 'allocateZoneSpans'
+
+
+//-----------------------------------------------------------------------------
+// Name: freeZoneSpans
+// Desc: Free the memory allocated by function allocateZoneSpans().
+//-----------------------------------------------------------------------------
+static void freeZoneSpans(ZoneSpans_t *spans)  {
+
+  free(spans->minY);  spans->minY = NULL;
+  free(spans->maxY);  spans->maxY = NULL;
+
+}  // End of function 'freeZoneSpans'
+
+
+//-----------------------------------------------------------------------------
+// Name: calcZoneSpans
+// Desc: Calculate the cells in the map that are covered by a zone with shape
+//       'shape' (ALL, RECT, CIR, or TRI, case insensitive) and parameters
+//       'params', which are in cell units. The cells are returned in 'spans'
+//       as one span of Y-coordinates per column, clipped to the map, so the
+//       caller can assign every cell of the zone without testing whether it's
+//       in the map or in the shape. A cell is in a circle if its squared
+//       distance from the center doesn't exceed the squared radius. A cell is
+//       in a triangle according to the Barycentric Technique, and a triangle's
+//       cells in each column are contiguous because the triangle is convex.
+//       Returns FALSE if the shape is not recognized, or TRUE otherwise.
+//-----------------------------------------------------------------------------
+static int calcZoneSpans(ZoneSpans_t *spans, const char *shape, const int *params,
+                         const MapInfo_t *mapInfo)  {
+
+  const int maxMapX = mapInfo->mapWidth  - 1;
+  const int maxMapY = mapInfo->mapHeight - 1;
+
+  //
+  // Handle ALL and RECT shapes:
+  //
+  if ((strcasecmp(shape, "ALL") == 0) || (strcasecmp(shape, "RECT") == 0))  {
+    int x1 = 0;
+    int y1 = 0;
+    int x2 = maxMapX;
+    int y2 = maxMapY;
+    if (strcasecmp(shape, "RECT") == 0)  {
+      x1 = min(params[0], params[2]);  // x1 is x-coordinate of lower-left RECT corner
+      y1 = min(params[1], params[3]);  // y1 is y-coordinate of lower-left RECT corner
+      x2 = max(params[0], params[2]);  // x2 is x-coordinate of upper-right RECT corner
+      y2 = max(params[1], params[3]);  // y2 is y-coordinate of upper-right RECT corner
+    }
+
+    spans->minX = max(x1, 0);
+    spans->maxX = min(x2, maxMapX);
+    for (int x = spans->minX; x <= spans->maxX; x++)  {
+      spans->minY[x] = max(y1, 0);
+      spans->maxY[x] = min(y2, maxMapY);
+    }  // End of for-loop for index 'x'
+  }  // End of if-clause for shape == 'ALL' or 'RECT'
+
+  //
+  // Handle CIR shapes:
+  //
+  else if (strcasecmp(shape, "CIR") == 0)  {
+    int x_cent = params[0]; // X-coordinate of circle's center
+    int y_cent = params[1]; // Y-coordinate of circle's center
+    int radius = params[2]; // Radius of circle
+    int radius_squared = radius * radius;
+
+    spans->minX = max(x_cent - radius, 0);
+    spans->maxX = min(x_cent + radius, maxMapX);
+    for (int x = spans->minX; x <= spans->maxX; x++)  {
+      // Find the largest delta-Y for which delta-X^2 + delta-Y^2 <= R^2, correcting
+      // any rounding error of the floating-point square-root:
+      int remainder = radius_squared - (x - x_cent)*(x - x_cent);
+      int deltaY = (int)sqrt((double)remainder);
+      while ((deltaY + 1) * (deltaY + 1) <= remainder)
+        deltaY++;
+      while (deltaY * deltaY > remainder)
+        deltaY--;
+
+      spans->minY[x] = max(y_cent - deltaY, 0);
+      spans->maxY[x] = min(y_cent + deltaY, maxMapY);
+    }  // End of for-loop for index 'x'
+  }  // End of else-clause for shape == 'CIR'
+
+  //
+  // Handle TRI shapes:
+  //
+  else if (strcasecmp(shape, "TRI") == 0)  {
+    // Capture parameters in variables that describe the X/Y coordinates
+    // of the triangle's 3 vertices: A, B, and C
+    int x_A = params[0]; // X-coordinate of vertex 'A'
+    int y_A = params[1]; // Y-coordinate of vertex 'A'
+    int x_B = params[2]; // X-coordinate of vertex 'B'
+    int y_B = params[3]; // Y-coordinate of vertex 'B'
+    int x_C = params[4]; // X-coordinate of vertex 'C'
+    int y_C = params[5]; // Y-coordinate of vertex 'C'
+
+    // Determine the rectangle that circumscribes the triangle, clipped to the map:
+    spans->minX = max(min(x_A, min(x_B, x_C)), 0);
+    spans->maxX = min(max(x_A, max(x_B, x_C)), maxMapX);
+    const int y_min = max(min(y_A, min(y_B, y_C)), 0);
+    const int y_max = min(max(y_A, max(y_B, y_C)), maxMapY);
+
+    // Use Barycentric Technique to determine whether points are within
+    // the triangle defined by vertices A, B, and C. This technique is
+    // described at following web page:
+    //    http://www.blackpawn.com/texts/pointinpoly/default.html
+    int X_c_a = x_C - x_A; // X-component of vector from A to C
+    int Y_c_a = y_C - y_A; // Y-component of vector from A to C
+    int X_b_a = x_B - x_A; // X-component of vector from A to B
+    int Y_b_a = y_B - y_A; // Y-component of vector from A to B
+
+    // Calculate dot-products of vectors. Use long long integers to avoid
+    // truncating. The dot-product values can get large.
+    long long dot_ca_ca = (X_c_a * X_c_a) + (Y_c_a * Y_c_a); // Dot-product of vector CA with itself
+    long long dot_ca_ba = (X_c_a * X_b_a) + (Y_c_a * Y_b_a); // Dot-product of vector CA with vector BA
+    long long dot_ba_ba = (X_b_a * X_b_a) + (Y_b_a * Y_b_a); // Dot-product of vector BA with itself
+    float denominator = (float)(dot_ca_ca * dot_ba_ba - dot_ca_ba * dot_ca_ba);
+
+    for (int x = spans->minX; x <= spans->maxX; x++)  {
+      // Start with an empty span in this column:
+      spans->minY[x] = 0;
+      spans->maxY[x] = -1;
+
+      for (int y = y_min; y <= y_max; y++)  {
+        int X_p_a = x - x_A; // X-component of vector from P to A
+        int Y_p_a = y - y_A; // Y-component of vector from P to A
+        long long dot_ca_pa = (X_c_a * X_p_a) + (Y_c_a * Y_p_a); // Dot product of vector CA with vector PA
+        long long dot_ba_pa = (X_b_a * X_p_a) + (Y_b_a * Y_p_a); // Dot product of vector BA with vector PA
+        float u = (float)((dot_ba_ba * dot_ca_pa) - (dot_ca_ba * dot_ba_pa)) / denominator;
+        float v = (float)((dot_ca_ca * dot_ba_pa) - (dot_ca_ba * dot_ca_pa)) / denominator;
+
+        // Point P at (x,y) is within the triangle only if (u >= 0) and (v >= 0) and (u + v < 1):
+        if ((u >= 0.0) && (v >= 0.0) && (u + v < 1.0))  {
+          if (spans->maxY[x] < spans->minY[x])  {
+            spans->minY[x] = y;
+          }
+          spans->maxY[x] = y;
+        }
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
+  }  // End of else-clause for shape == 'TRI'
+
+  else  {
+    return(FALSE);
+  }
+
+  return(TRUE);
+
+}  // End of function 'calcZoneSpans'
+
+
 //-----------------------------------------------------------------------------
 // Name: defineCellDesignRules
 // Desc: Modifies the 'cellInfo' 3D matrix based on the DR_zone
@@ -943,7 +1128,10 @@ void defineCellDesignRules(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
     }  // End of for-loop for index 'routing_layer_num'
     return;
   }  // End of if-block for (num_DR_zones == 0)
-  
+
+  // Allocate the column-spans of each zone's cells:
+  ZoneSpans_t spans;
+  allocateZoneSpans(&spans, mapInfo);
 
   // 
   // Cycle through the DR_zone statements and modify the 'cellInfo' matrix
@@ -1030,217 +1218,27 @@ void defineCellDesignRules(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
 
 
     //
-    // Handle 'DR_zone <DR name> <layer> ALL' and 'DR_zone <DR name> <layer> RECT' commands:
-    //
-    if ((strcasecmp(shape, "ALL") == 0) || (strcasecmp(shape, "RECT") == 0))  {
-      int x1, y1, x2, y2;
-      if (strcasecmp(shape, "ALL") == 0) {
-        x1 = 0;
-        y1 = 0;
-        x2 = mapInfo->mapWidth;
-        y2 = mapInfo->mapHeight;
-      }
-      else {
-        x1 = min(params[0], params[2]);  // x1 is x-coordinate of lower-left RECT corner
-        y1 = min(params[1], params[3]);  // y1 is y-coordinate of lower-left RECT corner 
-        x2 = max(params[0], params[2]);  // x2 is x-coordinate of upper-right RECT corner
-        y2 = max(params[1], params[3]);  // y2 is y-coordinate of upper-right RECT corner
-      }
-
-
-      //
-      // Raster over the rectangle of interest:
-      //
-      routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
-      // printf("DEBUG: About to raster over RECT shape from (%d, %d, %d) to (%d, %d, %d).\n", x1, y1, routing_layer_num, x2, y2, routing_layer_num);
-      for (x = x1; x <= x2; x++)  {
-        for (y = y1; y <= y2; y++)  {
-
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // printf("DEBUG: About to assign designRuleSet #%d to location (%d, %d, %d) within a rectangle.\n", DR_set_number, x, y, routing_layer_num);
-
-          // Define this cell's desgn-rule set number:
-          cellInfo[x][y][routing_layer_num].designRuleSet = DR_set_number;
-
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-    }  // End of if-clause for command type == 'ALL' or 'RECT'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> CIR' command:
-    //
-    else if (strcasecmp(shape, "CIR") == 0)  {
-      #ifdef DEBUG_defineCellDesignRules
-      printf("DEBUG: Found CIR statement with parameters %d, %d, and %d\n",
-             params[0], params[1], params[2]);
-      #endif
-
-      int x_cent = params[0]; // X-coordinate of circle's center
-      int y_cent = params[1]; // Y-coordinate of circle's center
-      int radius = params[2]; // Radius of circle
-      int radius_squared = radius * radius;
-
-      // Raster over the square that circumscribes the circle:
-      int x_min, y_min, x_max, y_max;
-      x_min = x_cent - radius; // = Xo - R
-      y_min = y_cent - radius; // = Yo - R
-      x_max = x_cent + radius; // = Xo + R
-      y_max = y_cent + radius; // = Yo + R
-      for (x = x_min; x <= x_max; x++)  {
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Only proceed if X/Y point is within the circle: delta-X^2 + delta-Y^2 < R^2
-          if ((x - x_cent)*(x - x_cent) + (y - y_cent)*(y - y_cent) <= radius_squared)  {
-
-            // Layer is a routing layer (not a via layer):
-            routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
-
-            // Define this cell's desgn-rule set number:
-            cellInfo[x][y][routing_layer_num].designRuleSet = DR_set_number;
-
-            #ifdef DEBUG_defineCellDesignRules
-            int x_window_min = 114;
-            int x_window_max = 116;
-            int y_window_min = 104;
-            int y_window_max = 106;
-            int z_window_min = 0;
-            int z_window_max = 2;
-            if (   (x >= x_window_min) && (y >= y_window_min) && (routing_layer_num >= z_window_min)
-                && (x <= x_window_max) && (y <= y_window_max) && (routing_layer_num <= z_window_max))  {
-              printf("DEBUG: Assigned designRuleSet #%d to location (%d,%d,%d) within a circle.\n", DR_set_number, x, y, routing_layer_num);
-            }
-            #endif
-
-          }  // End of if-block for X/Y point within circle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'CIR'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> TRI' command:
+    // Calculate the cells within the zone's shape, and assign the design-rule set number to each of them:
     //
-    else if (strcasecmp(shape, "TRI") == 0)  {
-      #ifdef DEBUG_defineCellDesignRules
-      printf("DEBUG: Found TRI statement with parameters %d, %d, %d, %d, %d, %d\n",
-             params[0], params[1], params[2], params[3], params[4], params[5]);
-      #endif
-
-      // Capture parameters in variables that describe the X/Y coordinates
-      // of the triangle's 3 vertices: A, B, and C
-      int x_A = params[0]; // X-coordinate of vertex 'A'
-      int y_A = params[1]; // Y-coordinate of vertex 'A'
-      int x_B = params[2]; // X-coordinate of vertex 'B'
-      int y_B = params[3]; // Y-coordinate of vertex 'B'
-      int x_C = params[4]; // X-coordinate of vertex 'C'
-      int y_C = params[5]; // Y-coordinate of vertex 'C'
-
-      // Determine the minimum and maximum X- and Y-values,
-      // (x_min, y_min) and (x_max, y_max), respectively:
-      int x_min = x_A; int y_min = x_A;
-      int x_max = x_A; int y_max = x_A;
-      if (x_B < x_min) x_min = x_B;
-      if (x_C < x_min) x_min = x_C;
-      if (x_B > x_max) x_max = x_B;
-      if (x_C > x_max) x_max = x_C;
-      if (y_B < y_min) y_min = y_B;
-      if (y_C < y_min) y_min = y_C;
-      if (y_B > y_max) y_max = y_B;
-      if (y_C > y_max) y_max = y_C;
-      #ifdef DEBUG_defineCellDesignRules
-      printf("DEBUG: Lower-left point is (%d,%d). Upper-right point is (%d,%d)\n",
-              x_min, y_min, x_max, y_max);
-      #endif
-
-      // Use Barycentric Technique to determine whether points are within
-      // the triangle defined by vertices A, B, and C. This technique is
-      // described at following web page: 
-      //    http://www.blackpawn.com/texts/pointinpoly/default.html
-      int X_c_a = x_C - x_A; // X-component of vector from A to C
-      int Y_c_a = y_C - y_A; // Y-component of vector from A to C
-      int X_b_a = x_B - x_A; // X-component of vector from A to B
-      int Y_b_a = y_B - y_A; // Y-component of vector from A to B
-
-      // Calculate dot-products of vectors. Use long long integers to avoid
-      // truncating. The dot-product values can get large.
-      long long dot_ca_ca = (X_c_a * X_c_a) + (Y_c_a * Y_c_a); // Dot-product of vector CA with itself
-                                                          // ('dot00' from above web page)
-      long long dot_ca_ba = (X_c_a * X_b_a) + (Y_c_a * Y_b_a); // Dot-product of vector CA with vector
-                                                          // BA ('dot01' from above web page)
-      long long dot_ba_ba = (X_b_a * X_b_a) + (Y_b_a * Y_b_a); // Dot-product of vector BA with itself 
-                                                         // ('dot11' from above web page)
-      int X_p_a, Y_p_a; // X- and Y-components of vector from A to point P
-      long long dot_ca_pa;    // Dot product of vector CA with vector PA
-      long long dot_ba_pa;    // Dot product of vector BA with vector PA
-      float u, v, denominator; // Vectors u and v, as defined in above web page.
-                               // 'denominator is temporary variable.
-
-      // Raster over the rectangle that circumscribes the triangle:
-      for (x = x_min; x <= x_max; x++)  {
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Calculate more vector quantities necessary to determine whether point P
-          // is inside of triangle:
-          X_p_a = x - x_A; // X-component of vector from P to A
-          Y_p_a = y - y_A; // Y-component of vector from P to A
-          dot_ca_pa = (X_c_a * X_p_a) + (Y_c_a * Y_p_a); // Dot product of vector CA with vector PA
-                                                         // ('dot02' from above web page)
-          dot_ba_pa = (X_b_a * X_p_a) + (Y_b_a * Y_p_a); // Dot product of vector BA with vector PA 
-                                                         // ('dot12' from above web page)
-          #ifdef DEBUG_defineCellDesignRules
-          printf("DEBUG: dot_ca_ca=%lli, dot_ba_ba=%lli, dot_ca_ba=%lli, dot_ca_ba^2=%lli\n",
-                 dot_ca_ca, dot_ba_ba, dot_ca_ba, dot_ca_ba*dot_ca_ba);
-          #endif
-
-          denominator = (float)(dot_ca_ca * dot_ba_ba - dot_ca_ba * dot_ca_ba);
-          u = (float)((dot_ba_ba * dot_ca_pa) - (dot_ca_ba * dot_ba_pa)) / denominator;
-          v = (float)((dot_ca_ca * dot_ba_pa) - (dot_ca_ba * dot_ca_pa)) / denominator;
-          #ifdef DEBUG_defineCellDesignRules
-          printf("DEBUG: At point (%d,%d), denominator=%5.2f, u=%5.2f, v=%5.2f, u+v=%5.2f\n",
-                 x, y, denominator, u, v, u+v);
-          #endif
-
-          // Only proceed if point P at (x,y) is within the triangle. This is true only
-          // if (u >= 0) and (v >= 0) and (u + v < 1).
-          if ((u >= 0.0) && (v >= 0.0) && (u + v < 1.0)) {
-            #ifdef DEBUG_defineCellDesignRules
-            printf("DEBUG: Point (%d,%d) is within triangle.\n", x, y);
-            #endif
-
-            routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
- 
-            // Define this cell's desgn-rule set number:
-
-            #ifdef DEBUG_defineCellDesignRules
-            printf("DEBUG: About to assign designRuleSet #%d to location (%d, %d, %d) within a triangle.\n", DR_set_number, x, y, routing_layer_num);
-            #endif
-
-            cellInfo[x][y][routing_layer_num].designRuleSet = DR_set_number;
-
-          }  // End of if-block for X/Y point within triangle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'TRI'
-
-    else {
+    if (! calcZoneSpans(&spans, shape, params, mapInfo))  {
       printf("\n\nERROR: Program encountered a DR_zone command with shape-type '%s' that is not\n", shape);
       printf("       recognized. Allowed types are ALL, RECT, CIR, and TRI (case insensitive).\n");
       printf("       Please fix input file. Program is exiting.\n\n");
       exit(1);
     }
+
+    routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
+    for (x = spans.minX; x <= spans.maxX; x++)  {
+      for (y = spans.minY[x]; y <= spans.maxY[x]; y++)  {
+        // Define this cell's design-rule set number:
+        cellInfo[x][y][routing_layer_num].designRuleSet = DR_set_number;
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
       
   }  // End of for-loop for index 'DR_zone'
 
+  freeZoneSpans(&spans);
+
   //
   // DEBUG code follows:
   //
@@ -1309,7 +1307,10 @@ void defineCellCosts(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
       }  // End of for-loop for index 'y'
     }  // End of for-loop for index 'x'
   }  // End of for-loop for index 'routing_layer_num'
-  
+
+  // Allocate the column-spans of each zone's cells:
+  ZoneSpans_t spans;
+  allocateZoneSpans(&spans, mapInfo);
 
   // 
   // Cycle through the trace_cost_zone statements and modify the 'cellInfo' matrix
@@ -1362,199 +1363,38 @@ void defineCellCosts(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
 
 
     //
-    // Handle 'trace_cost_zone <cost index>  <layer> ALL' and 'trace_cost_zone <cost index> <layer> RECT' commands:
+    // Calculate the cells within the zone's shape, and assign the trace-cost index to each of them:
     //
-    if ((strcasecmp(shape, "ALL") == 0) || (strcasecmp(shape, "RECT") == 0))  {
-      int x1, y1, x2, y2;
-      if (strcasecmp(shape, "ALL") == 0) {
-        x1 = 0;
-        y1 = 0;
-        x2 = mapInfo->mapWidth;
-        y2 = mapInfo->mapHeight;
-      }
-      else {
-        x1 = min(params[0], params[2]);  // x1 is x-coordinate of lower-left RECT corner
-        y1 = min(params[1], params[3]);  // y1 is y-coordinate of lower-left RECT corner 
-        x2 = max(params[0], params[2]);  // x2 is x-coordinate of upper-right RECT corner
-        y2 = max(params[1], params[3]);  // y2 is y-coordinate of upper-right RECT corner
-      }
+    if (! calcZoneSpans(&spans, shape, params, mapInfo))  {
+      printf("\n\nERROR: Program encountered a trace_cost_zone command with shape-type '%s' that is not\n", shape);
+      printf("       recognized. Allowed types are ALL, RECT, CIR, and TRI (case insensitive).\n");
+      printf("       Please fix input file. Program is exiting.\n\n");
+      exit(1);
+    }
 
-      //
-      // Raster over the rectangle of interest:
-      //
-      for (x = x1; x <= x2; x++)  {
-        for (y = y1; y <= y2; y++)  {
+    routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
+    for (x = spans.minX; x <= spans.maxX; x++)  {
+      for (y = spans.minY[x]; y <= spans.maxY[x]; y++)  {
+        // Define this cell's trace-cost index:
+        cellInfo[x][y][routing_layer_num].traceCostMultiplierIndex = zone_index;
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
+      
+  }  // End of for-loop for index 'cost_zone'
 
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
 
-          // printf("DEBUG: Handling RECT shape at location (%d, %d).\n", x, y);
 
-          routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
+  // 
+  // Now do the same thing for the VIA_cost_zones. That is, cycle through the 
+  // via_cost_zone statements and modify the 'cellInfo' matrix
+  // accordingly. Note that the order of the cost-zone statements matters!!
+  //
+  for (int cost_zone = 0; cost_zone < num_via_zones; cost_zone++)  {
 
-          // Define this cell's trace-cost index:
-          cellInfo[x][y][routing_layer_num].traceCostMultiplierIndex = zone_index;
-
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-    }  // End of if-clause for command type == 'ALL' or 'RECT'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> CIR' command:
-    //
-    else if (strcasecmp(shape, "CIR") == 0)  {
-      // printf("DEBUG: Found CIR statement with parameters %d, %d, and %d\n",
-      //        params[0], params[1], params[2]);
-
-      int x_cent = params[0]; // X-coordinate of circle's center
-      int y_cent = params[1]; // Y-coordinate of circle's center
-      int radius = params[2]; // Radius of circle
-      int radius_squared = radius * radius;
-
-      // Raster over the square that circumscribes the circle:
-      int x_min, y_min, x_max, y_max;
-      x_min = x_cent - radius; // = Xo - R
-      y_min = y_cent - radius; // = Yo - R
-      x_max = x_cent + radius; // = Xo + R
-      y_max = y_cent + radius; // = Yo + R
-      for (x = x_min; x <= x_max; x++)  {
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Only proceed if X/Y point is within the circle: delta-X^2 + delta-Y^2 < R^2
-          if ((x - x_cent)*(x - x_cent) + (y - y_cent)*(y - y_cent) <= radius_squared)  {
-
-            // Layer is a routing layer (not a via layer):
-            routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
-
-            // Define this cell's trace-cost index:
-            cellInfo[x][y][routing_layer_num].traceCostMultiplierIndex = zone_index;
-
-          }  // End of if-block for X/Y point within circle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'CIR'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> TRI' command:
-    //
-    else if (strcasecmp(shape, "TRI") == 0)  {
-      // printf("DEBUG: Found TRI statement with parameters %d, %d, %d, %d, %d, %d\n",
-      //        params[0], params[1], params[2], params[3], params[4], params[5]);
-
-      // Capture parameters in variables that describe the X/Y coordinates
-      // of the triangle's 3 vertices: A, B, and C
-      int x_A = params[0]; // X-coordinate of vertex 'A'
-      int y_A = params[1]; // Y-coordinate of vertex 'A'
-      int x_B = params[2]; // X-coordinate of vertex 'B'
-      int y_B = params[3]; // Y-coordinate of vertex 'B'
-      int x_C = params[4]; // X-coordinate of vertex 'C'
-      int y_C = params[5]; // Y-coordinate of vertex 'C'
-
-      // Determine the minimum and maximum X- and Y-values,
-      // (x_min, y_min) and (x_max, y_max), respectively:
-      int x_min = x_A; int y_min = x_A;
-      int x_max = x_A; int y_max = x_A;
-      if (x_B < x_min) x_min = x_B;
-      if (x_C < x_min) x_min = x_C;
-      if (x_B > x_max) x_max = x_B;
-      if (x_C > x_max) x_max = x_C;
-      if (y_B < y_min) y_min = y_B;
-      if (y_C < y_min) y_min = y_C;
-      if (y_B > y_max) y_max = y_B;
-      if (y_C > y_max) y_max = y_C;
-      // printf("DEBUG: Lower-left point is (%d,%d). Upper-right point is (%d,%d)\n",
-      //         x_min, y_min, x_max, y_max);
-
-      // Use Barycentric Technique to determine whether points are within
-      // the triangle defined by vertices A, B, and C. This technique is
-      // described at following web page: 
-      //    http://www.blackpawn.com/texts/pointinpoly/default.html
-      int X_c_a = x_C - x_A; // X-component of vector from A to C
-      int Y_c_a = y_C - y_A; // Y-component of vector from A to C
-      int X_b_a = x_B - x_A; // X-component of vector from A to B
-      int Y_b_a = y_B - y_A; // Y-component of vector from A to B
-
-      // Calculate dot-products of vectors. Use long long integers to avoid
-      // truncating. The dot-product values can get large.
-      long long dot_ca_ca = (X_c_a * X_c_a) + (Y_c_a * Y_c_a); // Dot-product of vector CA with itself
-                                                          // ('dot00' from above web page)
-      long long dot_ca_ba = (X_c_a * X_b_a) + (Y_c_a * Y_b_a); // Dot-product of vector CA with vector
-                                                          // BA ('dot01' from above web page)
-      long long dot_ba_ba = (X_b_a * X_b_a) + (Y_b_a * Y_b_a); // Dot-product of vector BA with itself 
-                                                         // ('dot11' from above web page)
-      int X_p_a, Y_p_a; // X- and Y-components of vector from A to point P
-      long long dot_ca_pa;    // Dot product of vector CA with vector PA
-      long long dot_ba_pa;    // Dot product of vector BA with vector PA
-      float u, v, denominator; // Vectors u and v, as defined in above web page.
-                               // 'denominator is temporary variable.
-
-      // Raster over the rectangle that circumscribes the triangle:
-      for (x = x_min; x <= x_max; x++)  {
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Calculate more vector quantities necessary to determine whether point P
-          // is inside of triangle:
-          X_p_a = x - x_A; // X-component of vector from P to A
-          Y_p_a = y - y_A; // Y-component of vector from P to A
-          dot_ca_pa = (X_c_a * X_p_a) + (Y_c_a * Y_p_a); // Dot product of vector CA with vector PA
-                                                         // ('dot02' from above web page)
-          dot_ba_pa = (X_b_a * X_p_a) + (Y_b_a * Y_p_a); // Dot product of vector BA with vector PA 
-                                                         // ('dot12' from above web page)
-          // printf("DEBUG: dot_ca_ca=%lli, dot_ba_ba=%lli, dot_ca_ba=%lli, dot_ca_ba^2=%lli\n",
-          //        dot_ca_ca, dot_ba_ba, dot_ca_ba, dot_ca_ba*dot_ca_ba);
-
-          denominator = (float)(dot_ca_ca * dot_ba_ba - dot_ca_ba * dot_ca_ba);
-          u = (float)((dot_ba_ba * dot_ca_pa) - (dot_ca_ba * dot_ba_pa)) / denominator;
-          v = (float)((dot_ca_ca * dot_ba_pa) - (dot_ca_ba * dot_ca_pa)) / denominator;
-          // printf("DEBUG: At point (%d,%d), denominator=%5.2f, u=%5.2f, v=%5.2f, u+v=%5.2f\n", 
-          //        x, y, denominator, u, v, u+v);
-
-          // Only proceed if point P at (x,y) is within the triangle. This is true only
-          // if (u >= 0) and (v >= 0) and (u + v < 1).
-          if ((u >= 0.0) && (v >= 0.0) && (u + v < 1.0)) {
-            // printf("DEBUG: Point (%d,%d) is within triangle.\n", x, y);
-
-            routing_layer_num = all_layer_num / 2; // Routing layer number is half the value of all-layer number
- 
-            // Define this cell's trace-cost index:
-            cellInfo[x][y][routing_layer_num].traceCostMultiplierIndex = zone_index;
-
-          }  // End of if-block for X/Y point within triangle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'TRI'
-
-    else {
-      printf("\n\nERROR: Program encountered a trace_cost_zone command with shape-type '%s' that is not\n", shape);
-      printf("       recognized. Allowed types are ALL, RECT, CIR, and TRI (case insensitive).\n");
-      printf("       Please fix input file. Program is exiting.\n\n");
-      exit(1);
-    }
-      
-  }  // End of for-loop for index 'cost_zone'
-
-
-
-  // 
-  // Now do the same thing for the VIA_cost_zones. That is, cycle through the 
-  // via_cost_zone statements and modify the 'cellInfo' matrix
-  // accordingly. Note that the order of the cost-zone statements matters!!
-  //
-  for (int cost_zone = 0; cost_zone < num_via_zones; cost_zone++)  {
-
-    // To simplify coding, copy the cost zone's index number, shape, and layer to temporary variables.
-    zone_index = user_inputs->via_cost_zone_index[cost_zone];
-    strcpy(shape,      user_inputs->via_cost_zone_shape[cost_zone]);
-    strcpy(layer_name, user_inputs->via_cost_zone_layer[cost_zone]);
+    // To simplify coding, copy the cost zone's index number, shape, and layer to temporary variables.
+    zone_index = user_inputs->via_cost_zone_index[cost_zone];
+    strcpy(shape,      user_inputs->via_cost_zone_shape[cost_zone]);
+    strcpy(layer_name, user_inputs->via_cost_zone_layer[cost_zone]);
 
     // If cost-zone statement contains numeric parameters, convert them from  
     // floating-point values to integer cell coordinates:
@@ -1598,197 +1438,30 @@ void defineCellCosts(CellInfo_t ***cellInfo, MapInfo_t *mapInfo,
 
 
     //
-    // Handle 'via_cost_zone <cost index>  <layer> ALL' and 'via_cost_zone <cost index> <layer> RECT' commands:
-    //
-    if ((strcasecmp(shape, "ALL") == 0) || (strcasecmp(shape, "RECT") == 0))  {
-      int x1, y1, x2, y2;
-      if (strcasecmp(shape, "ALL") == 0) {
-        x1 = 0;
-        y1 = 0;
-        x2 = mapInfo->mapWidth;
-        y2 = mapInfo->mapHeight;
-      }
-      else {
-        x1 = min(params[0], params[2]);  // x1 is x-coordinate of lower-left RECT corner
-        y1 = min(params[1], params[3]);  // y1 is y-coordinate of lower-left RECT corner 
-        x2 = max(params[0], params[2]);  // x2 is x-coordinate of upper-right RECT corner
-        y2 = max(params[1], params[3]);  // y2 is y-coordinate of upper-right RECT corner
-      }
-
-      //
-      // Raster over the rectangle of interest:
-      //
-      for (x = x1; x <= x2; x++)  {
-        for (y = y1; y <= y2; y++)  {
-
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // printf("DEBUG: Handling RECT shape at location (%d, %d).\n", x, y);
-
-          // Routing layer numbers of affected layers are half the via-layer number, +/- 1:
-          routing_layer_above = (all_layer_num + 1) / 2;
-          routing_layer_below = (all_layer_num - 1) / 2;
-         
-          // Define the affected cells' via-cost indices:
-          cellInfo[x][y][routing_layer_below].viaUpCostMultiplierIndex   = zone_index;
-          cellInfo[x][y][routing_layer_above].viaDownCostMultiplierIndex = zone_index;
-
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-    }  // End of if-clause for command type == 'ALL' or 'RECT'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> CIR' command:
-    //
-    else if (strcasecmp(shape, "CIR") == 0)  {
-      // printf("DEBUG: Found CIR statement with parameters %d, %d, and %d\n",
-      //        params[0], params[1], params[2]);
-
-      int x_cent = params[0]; // X-coordinate of circle's center
-      int y_cent = params[1]; // Y-coordinate of circle's center
-      int radius = params[2]; // Radius of circle
-      int radius_squared = radius * radius;
-
-      // Raster over the square that circumscribes the circle:
-      int x_min, y_min, x_max, y_max;
-      x_min = x_cent - radius; // = Xo - R
-      y_min = y_cent - radius; // = Yo - R
-      x_max = x_cent + radius; // = Xo + R
-      y_max = y_cent + radius; // = Yo + R
-      for (x = x_min; x <= x_max; x++)  {
-
-        int delta_x_squared = (x - x_cent)*(x - x_cent);
-
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Only proceed if X/Y point is within the circle: deltaX^2 + deltaY^2 < R^2
-          if (delta_x_squared + (y - y_cent)*(y - y_cent) <= radius_squared)  {
-
-            // Routing layer numbers of affected layers are half the via-layer number, +/- 1:
-            routing_layer_above = (all_layer_num + 1) / 2;
-            routing_layer_below = (all_layer_num - 1) / 2;
-         
-            // Define the affected cells' via-cost indices:
-            cellInfo[x][y][routing_layer_below].viaUpCostMultiplierIndex   = zone_index;
-            cellInfo[x][y][routing_layer_above].viaDownCostMultiplierIndex = zone_index;
-
-          }  // End of if-block for X/Y point within circle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'CIR'
-
-    //
-    // Handle 'DR_zone <DR name> <layer> TRI' command:
+    // Calculate the cells within the zone's shape, and assign the via-cost index to each of them:
     //
-    else if (strcasecmp(shape, "TRI") == 0)  {
-      // printf("DEBUG: Found TRI statement with parameters %d, %d, %d, %d, %d, %d\n",
-      //        params[0], params[1], params[2], params[3], params[4], params[5]);
-
-      // Capture parameters in variables that describe the X/Y coordinates
-      // of the triangle's 3 vertices: A, B, and C
-      int x_A = params[0]; // X-coordinate of vertex 'A'
-      int y_A = params[1]; // Y-coordinate of vertex 'A'
-      int x_B = params[2]; // X-coordinate of vertex 'B'
-      int y_B = params[3]; // Y-coordinate of vertex 'B'
-      int x_C = params[4]; // X-coordinate of vertex 'C'
-      int y_C = params[5]; // Y-coordinate of vertex 'C'
-
-      // Determine the minimum and maximum X- and Y-values,
-      // (x_min, y_min) and (x_max, y_max), respectively:
-      int x_min = x_A; int y_min = x_A;
-      int x_max = x_A; int y_max = x_A;
-      if (x_B < x_min) x_min = x_B;
-      if (x_C < x_min) x_min = x_C;
-      if (x_B > x_max) x_max = x_B;
-      if (x_C > x_max) x_max = x_C;
-      if (y_B < y_min) y_min = y_B;
-      if (y_C < y_min) y_min = y_C;
-      if (y_B > y_max) y_max = y_B;
-      if (y_C > y_max) y_max = y_C;
-      // printf("DEBUG: Lower-left point is (%d,%d). Upper-right point is (%d,%d)\n",
-      //         x_min, y_min, x_max, y_max);
-
-      // Use Barycentric Technique to determine whether points are within
-      // the triangle defined by vertices A, B, and C. This technique is
-      // described at following web page: 
-      //    http://www.blackpawn.com/texts/pointinpoly/default.html
-      int X_c_a = x_C - x_A; // X-component of vector from A to C
-      int Y_c_a = y_C - y_A; // Y-component of vector from A to C
-      int X_b_a = x_B - x_A; // X-component of vector from A to B
-      int Y_b_a = y_B - y_A; // Y-component of vector from A to B
-
-      // Calculate dot-products of vectors. Use long long integers to avoid
-      // truncating. The dot-product values can get large.
-      long long dot_ca_ca = (X_c_a * X_c_a) + (Y_c_a * Y_c_a); // Dot-product of vector CA with itself
-                                                          // ('dot00' from above web page)
-      long long dot_ca_ba = (X_c_a * X_b_a) + (Y_c_a * Y_b_a); // Dot-product of vector CA with vector
-                                                          // BA ('dot01' from above web page)
-      long long dot_ba_ba = (X_b_a * X_b_a) + (Y_b_a * Y_b_a); // Dot-product of vector BA with itself 
-                                                         // ('dot11' from above web page)
-      int X_p_a, Y_p_a; // X- and Y-components of vector from A to point P
-      long long dot_ca_pa;    // Dot product of vector CA with vector PA
-      long long dot_ba_pa;    // Dot product of vector BA with vector PA
-      float u, v, denominator; // Vectors u and v, as defined in above web page.
-                               // 'denominator is temporary variable.
-
-      // Raster over the rectangle that circumscribes the triangle:
-      for (x = x_min; x <= x_max; x++)  {
-        for (y = y_min; y <= y_max; y++)  {
-          // Skip this point if it's outside the map area:
-          if (XY_coords_are_outside_of_map(x, y, mapInfo))
-            continue;
-
-          // Calculate more vector quantities necessary to determine whether point P
-          // is inside of triangle:
-          X_p_a = x - x_A; // X-component of vector from P to A
-          Y_p_a = y - y_A; // Y-component of vector from P to A
-          dot_ca_pa = (X_c_a * X_p_a) + (Y_c_a * Y_p_a); // Dot product of vector CA with vector PA
-                                                         // ('dot02' from above web page)
-          dot_ba_pa = (X_b_a * X_p_a) + (Y_b_a * Y_p_a); // Dot product of vector BA with vector PA 
-                                                         // ('dot12' from above web page)
-          // printf("DEBUG: dot_ca_ca=%lli, dot_ba_ba=%lli, dot_ca_ba=%lli, dot_ca_ba^2=%lli\n",
-          //        dot_ca_ca, dot_ba_ba, dot_ca_ba, dot_ca_ba*dot_ca_ba);
-
-          denominator = (float)(dot_ca_ca * dot_ba_ba - dot_ca_ba * dot_ca_ba);
-          u = (float)((dot_ba_ba * dot_ca_pa) - (dot_ca_ba * dot_ba_pa)) / denominator;
-          v = (float)((dot_ca_ca * dot_ba_pa) - (dot_ca_ba * dot_ca_pa)) / denominator;
-          // printf("DEBUG: At point (%d,%d), denominator=%5.2f, u=%5.2f, v=%5.2f, u+v=%5.2f\n", 
-          //        x, y, denominator, u, v, u+v);
-
-          // Only proceed if point P at (x,y) is within the triangle. This is true only
-          // if (u >= 0) and (v >= 0) and (u + v < 1).
-          if ((u >= 0.0) && (v >= 0.0) && (u + v < 1.0)) {
-            // printf("DEBUG: Point (%d,%d) is within triangle.\n", x, y);
-
-            // Routing layer numbers of affected layers are half the via-layer number, +/- 1:
-            routing_layer_above = (all_layer_num + 1) / 2;
-            routing_layer_below = (all_layer_num - 1) / 2;
-         
-            // Define the affected cells' via-cost indices:
-            cellInfo[x][y][routing_layer_below].viaUpCostMultiplierIndex   = zone_index;
-            cellInfo[x][y][routing_layer_above].viaDownCostMultiplierIndex = zone_index;
-
-          }  // End of if-block for X/Y point within triangle
-        }  // End of for-loop for index 'y'
-      }  // End of for-loop for index 'x'
-
-    }  // End of else-clause for command type == 'TRI'
-
-    else {
+    if (! calcZoneSpans(&spans, shape, params, mapInfo))  {
       printf("\n\nERROR: Program encountered a via_cost_zone command with shape-type '%s' that is not\n", shape);
       printf("       recognized. Allowed types are ALL, RECT, CIR, and TRI (case insensitive).\n");
       printf("       Please fix input file. Program is exiting.\n\n");
       exit(1);
     }
+
+    // Routing layer numbers of affected layers are half the via-layer number, +/- 1:
+    routing_layer_above = (all_layer_num + 1) / 2;
+    routing_layer_below = (all_layer_num - 1) / 2;
+    for (x = spans.minX; x <= spans.maxX; x++)  {
+      for (y = spans.minY[x]; y <= spans.maxY[x]; y++)  {
+        // Define the affected cells' via-cost indices:
+        cellInfo[x][y][routing_layer_below].viaUpCostMultiplierIndex   = zone_index;
+        cellInfo[x][y][routing_layer_above].viaDownCostMultiplierIndex = zone_index;
+      }  // End of for-loop for index 'y'
+    }  // End of for-loop for index 'x'
       
   }  // End of for-loop for index 'cost_zone'
 
+  freeZoneSpans(&spans);
+
   return;
 
 }  // End of function 'defineCellCosts'
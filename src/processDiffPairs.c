@@ -50,6 +50,7 @@ void calcGapRoutingRestrictions(RoutingRestriction_t *routeRestrictions,
   // Set to TRUE the Boolean flag that specifies that routing-restrictions will be
   // used when findPath() is called:
   routeRestrictions->restrictionFlag = TRUE;
+  routeRestrictions->corridorFlag    = FALSE;
 
   // Initialize to FALSE the 'allowedLayers' element for each layer. Some will later
   // be converted to TRUE:
@@ -1791,7 +1792,7 @@ static void fillGapsInDiffPairPaths(Coordinate_t *pathCoords[], int pathLengths[
 
             pathCost = findPath(mapInfo, cellInfo, pathNum, prev_segment, pathCoords[pathNum][segment], &insertedCoords,
                                 &num_inserted_segments_in_gap, user_inputs, routability, &pathFinding[thread_num],
-                                2, FALSE, TRUE, &gapFillRestrictions, FALSE, FALSE);
+                                2, FALSE, TRUE, &gapFillRestrictions, FALSE, FALSE, NULL, 0);
 
             //
             // If no path was found, increase the value of 'routing_radius_multiplier' and try again in
@@ -1923,7 +1924,7 @@ static void fillGapsInDiffPairPaths(Coordinate_t *pathCoords[], int pathLengths[
 void postProcessDiffPairs(Coordinate_t *pathCoords[], int pathLengths[], InputValues_t *user_inputs,
                           CellInfo_t ***cellInfo, MapInfo_t *mapInfo, RoutingMetrics_t *routability,
                           PathFinding_t *pathFinding, RoutingMetrics_t subMapRoutability[2],
-                          RoutingRestriction_t *noRoutingRestrictions, int num_threads)  {
+                          SubMapPool_t *subMapPool, RoutingRestriction_t *noRoutingRestrictions, int num_threads)  {
 
   // Variables for time-stamps:
   time_t tim = time(NULL);
@@ -2230,7 +2231,7 @@ void postProcessDiffPairs(Coordinate_t *pathCoords[], int pathLengths[], InputVa
   // terminals and vias:
   // printf("DEBUG: Before calling optimizeDiffPairConnections, omp_get_num_threads = %d\n", omp_get_num_threads());
   optimizeDiffPairConnections(pathCoords, pathLengths, cellInfo, mapInfo, user_inputs, routability, subMapRoutability,
-                              noRoutingRestrictions, num_threads);
+                              subMapPool, noRoutingRestrictions, num_threads);
 
   #ifdef DEBUG_postProcess
   if (DEBUG_ON)  {
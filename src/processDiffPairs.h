@@ -71,7 +71,7 @@ void update_swapZone_startTerms(const int path, Coordinate_t *pathCoords[], int
 void postProcessDiffPairs(Coordinate_t *pathCoords[], int pathLengths[], InputValues_t *user_inputs,
                           CellInfo_t ***cellInfo, MapInfo_t *mapInfo, RoutingMetrics_t *routability,
                           PathFinding_t *pathFinding, RoutingMetrics_t subMapRoutability[2],
-                          RoutingRestriction_t *noRoutingRestrictions, int num_threads);
+                          SubMapPool_t *subMapPool, RoutingRestriction_t *noRoutingRestrictions, int num_threads);
 
 
 
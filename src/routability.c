@@ -1,5 +1,6 @@
 #include "global_defs.h"
 #include "aStarLibrary.h"
+#include "cellArraySlabs.h"
 
 
 //-----------------------------------------------------------------------------
@@ -163,6 +164,13 @@ void createRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapInfo)
     exit (1);
   }
 
+  // Allocate memory for 1-dimensional 'bidirectional_search' array:
+  routability->bidirectional_search = malloc(sizeof(char) * max_routed_nets);
+  if (routability->bidirectional_search == 0)  {
+    printf("Error: Failed to allocate memory for 'bidirectional_search' array.\n");
+    exit (1);
+  }
+
   // Allocate memory for the 1-dimensional 'path_elapsed_time' array:
   // printf("DEBUG: About to allocate path_elapsed_time for %d max_routed_nets.\n", max_routed_nets);
   routability->path_elapsed_time = malloc(sizeof(int) * max_routed_nets);
@@ -185,6 +193,14 @@ void createRoutability(RoutingMetrics_t *routability, const MapInfo_t *mapInfo)
     exit (1);
   }  // End of if-block
 
+  // Allocate memory for the 1-dimensional 'path_search_min' and 'path_search_max' arrays:
+  routability->path_search_min = malloc(sizeof(Coordinate_t) * max_routed_nets);
+  routability->path_search_max = malloc(sizeof(Coordinate_t) * max_routed_nets);
+  if ((routability->path_search_min == 0) || (routability->path_search_max == 0))  {
+    printf("Error: Failed to allocate memory for 'path_search_min' and 'path_search_max' arrays.\n");
+    exit (1);
+  }  // End of if-block
+
   // Allocate memory for 1-dimensional 'iteration_explored_cells' array
   routability->iteration_explored_cells = malloc(sizeof(long) * (mapInfo->max_iterations + 1));
   if (routability->iteration_explored_cells == 0)  {
@@ -468,12 +484,19 @@ void freeMemory_routability(RoutingMetrics_t *routability, const MapInfo_t *mapI
   // Free memory for 1-dimensional 'randomize_congestion' array
   free(routability->randomize_congestion);      routability->randomize_congestion = NULL;
 
+  // Free memory for 1-dimensional 'bidirectional_search' array
+  free(routability->bidirectional_search);      routability->bidirectional_search = NULL;
+
   // Free memory for 1-dimensional 'iteration_cumulative_time' array
   free(routability->iteration_cumulative_time);  routability->iteration_cumulative_time = NULL;
 
   // Free memory for the 1-dimensional 'path_explored_cells' array:
   free(routability->path_explored_cells);             routability->path_explored_cells = NULL;
 
+  // Free memory for the 1-dimensional 'path_search_min' and 'path_search_max' arrays:
+  free(routability->path_search_min);                 routability->path_search_min = NULL;
+  free(routability->path_search_max);                 routability->path_search_max = NULL;
+
   // Free memory for 1-dimensional 'iteration_explored_cells' array
   free(routability->iteration_explored_cells);        routability->iteration_explored_cells = NULL;
 
@@ -514,8 +537,8 @@ void print_cell_congestion(CellInfo_t *cellInfo)  {
     // Iterate over the paths whose congestion traverses this cell:
     for (int path_index = 0; path_index < num_paths; path_index++)  {
       printf("DEBUG: (thread %2d)   %3d: path=%d, subset=%d, shapeType=%d, pathTraversalsTimes100=%'9d\n",
-             omp_get_thread_num(), path_index, cellInfo->congestion[path_index].pathNum, cellInfo->congestion[path_index].DR_subset,
-             cellInfo->congestion[path_index].shapeType, cellInfo->congestion[path_index].pathTraversalsTimes100);
+             omp_get_thread_num(), path_index, cellCongestion(cellInfo)[path_index].pathNum, cellCongestion(cellInfo)[path_index].DR_subset,
+             cellCongestion(cellInfo)[path_index].shapeType, cellCongestion(cellInfo)[path_index].pathTraversalsTimes100);
     }  // End of for-loop for index 'path_index'
   }
   else  {